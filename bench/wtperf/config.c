@@ -177,10 +177,15 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 	int ret;
 
 	group = scan = NULL;
-	/* Allocate the workload array. */
+	/*
+	 * Allocate the workload array, discarding any configured earlier: the
+	 * threads configured with -o replace those in a configuration file.
+	 */
+	free(cfg->workload);
 	if ((cfg->workload = calloc(WORKLOAD_MAX, sizeof(WORKLOAD))) == NULL)
 		return (enomem(cfg));
 	cfg->workload_cnt = 0;
+	cfg->workers_cnt = 0;
 
 	/*
 	 * The thread configuration may be in multiple groups, that is, we have
@@ -0,0 +1,35 @@
+#!/bin/sh
+
+# wtperf_txn_scale.sh - measure transaction begin/commit throughput as the
+# number of threads grows.
+#
+# Runs the txn-scale.wtperf workload (one update per transaction) once for
+# each thread count and prints the number of transactions committed per
+# second.  This script should be invoked with the path of the wtperf binary,
+# optionally followed by the thread counts to run.
+#
+if test "$#" -lt "1"; then
+	echo "Usage: `basename $0` wtperf-binary [thread count ...]"
+	exit 1
+fi
+wtperf=$1
+shift
+threads=${*:-"1 2 4 8 16 32"}
+
+home=./WT_TEST
+optfile=`dirname $0`/txn-scale.wtperf
+outfile=./wtperf.out
+
+for t in $threads; do
+	rm -rf $home
+	mkdir $home
+	$wtperf -h $home -O $optfile \
+	    -o "threads=((count=$t,updates=1,ops_per_txn=1))" > $outfile 2>&1
+	if test "$?" -ne "0"; then
+		echo "wtperf failed, see $outfile"
+		exit 1
+	fi
+	rate=`sed -n 's/.*Executed.*update operations.* \([0-9]*\) ops\/sec/\1/p' \
+	    $home/test.stat`
+	echo "threads $t: $rate transactions/sec"
+done
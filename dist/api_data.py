@@ -74,6 +74,11 @@ lsm_config = [
         Config('bloom', 'true', r'''
             create bloom filters on LSM tree chunks as they are merged''',
             type='boolean'),
+        Config('bloom_blocked', 'true', r'''
+            create blocked bloom filters, which are read into memory and
+            checked with a single cache miss per lookup; see
+            @ref lsm_bloom for more information''',
+            type='boolean'),
         Config('bloom_config', '', r'''
             config string used when creating Bloom filter files, passed
             to WT_SESSION::create'''),
@@ -88,6 +93,13 @@ lsm_config = [
             create a bloom filter on the oldest LSM tree chunk. Only
             supported if bloom filters are enabled''',
             type='boolean'),
+        Config('bloom_prefix', '0', r'''
+            the length of the key prefix also added to LSM bloom filters,
+            so cursors configured with \c prefix_search can skip chunks
+            without keys beginning with the search key.  The length is
+            in bytes of the packed key, zero disables prefix bloom
+            filters; see @ref lsm_bloom_prefix for more information''',
+            min='0', max='1024'),
         Config('chunk_count_limit', '0', r'''
             the maximum number of chunks to allow in an LSM tree. This
             option automatically times out old data. As new chunks are
@@ -106,6 +118,10 @@ lsm_config = [
             larger than this value.  This overrides the \c memory_page_max
             setting''',
             min='512K', max='500MB'),
+        Config('level_multiplier', '10', r'''
+            the ratio between the sizes of adjacent levels when the
+            \c merge_policy is \c "leveled"''',
+            min='2', max='100'),
         Config('merge_max', '15', r'''
             the maximum number of chunks to include in a merge operation''',
             min='2', max='100'),
@@ -113,6 +129,28 @@ lsm_config = [
             the minimum number of chunks to include in a merge operation. If
             set to 0 or 1 half the value of merge_max is used''',
             max='100'),
+        Config('merge_partitions', '1', r'''
+            the maximum number of key ranges a merge is split into, each
+            merged into its own chunk by a separate LSM worker thread; see
+            @ref lsm_merge_partitions for more information''',
+            min='1', max='64'),
+        Config('merge_policy', 'tiered', r'''
+            the policy used to choose chunks to merge.  The \c "tiered"
+            policy merges chunks of similar sizes; the \c "leveled" policy
+            keeps chunks in levels of increasing size, with no overlapping
+            keys in a level, reducing read and space amplification at the
+            cost of more writes; see @ref lsm_leveled for more
+            information''',
+            choices=['leveled', 'tiered']),
+        Config('throttle_backlog', '0', r'''
+            the number of chunks waiting to be flushed or merged that
+            throttling aims to maintain: updates are delayed in proportion
+            to how far the backlog expected at the next chunk switch is
+            over this number.  If set to 0, two chunks waiting to be
+            flushed (if \c auto_throttle is configured) plus two
+            minimum merges of chunks waiting to be merged are allowed;
+            see @ref lsm_throttle for more information''',
+            min='0', max='1000'),
     ]),
 ]
 
@@ -348,6 +386,24 @@ connection_runtime_config = [
             seconds to wait between each checkpoint; setting this value
             above 0 configures periodic checkpoints''',
             min='0', max='100000'),
+        Config('write_rate', '0', r'''
+            limit the rate at which checkpoints write files, in bytes per
+            second; 0 means writes are not limited.  If \c write_target is
+            also configured, the minimum rate; see @ref checkpoint_throttle
+            for more information''',
+            min='0', max='100GB'),
+        Config('write_target', '0', r'''
+            adjust the rate at which checkpoints write files when each
+            checkpoint starts, so the data dirty in the cache is written in
+            this percentage of the \c wait period; 0 means the rate is not
+            adjusted.  Requires \c wait be
+            configured; see @ref checkpoint_throttle for more information''',
+            min='0', max='100'),
+        Config('workers', '0', r'''
+            the number of additional threads used to checkpoint files
+            concurrently with the thread doing the checkpoint; see
+            @ref checkpoint_workers for more information''',
+            min='0', max='20'),
         ]),
     Config('error_prefix', '', r'''
         prefix string for error messages'''),
@@ -426,6 +482,23 @@ connection_runtime_config = [
         are logged using the \c statistics_log configuration.  See
         @ref statistics for more information''',
         type='list', choices=['all', 'fast', 'none', 'clear']),
+    Config('statistics_conflicts', '', r'''
+        track the keys on which transactions fail with update conflicts.
+        Each file keeps an approximate list of the keys with the most
+        conflicts, returned by statistics cursors opened on the file.
+        See @ref statistics_conflicts for more information''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            track keys with update conflicts''',
+            type='boolean'),
+        Config('keys', '20', r'''
+            the maximum number of keys tracked for each file''',
+            min='1', max='1000'),
+        Config('sample', '1', r'''
+            track one of every \c sample update conflicts, chosen at
+            random''',
+            min='1', max='1000000'),
+        ]),
     Config('statistics_log', '', r'''
         log any statistics the database is configured to maintain,
         to a file.  See @ref statistics for more information''',
@@ -452,6 +525,18 @@ connection_runtime_config = [
             this value above 0 configures statistics logging''',
             min='0', max='100000'),
         ]),
+    Config('update_prune', '', r'''
+        periodically discard obsolete updates from pages where updates to
+        a single key have been chained to a configured length''',
+        type='category', subconfig=[
+        Config('chain_max', '100', r'''
+            the update chain length at which a page is pruned''',
+            min='2', max='1000000'),
+        Config('wait', '0', r'''
+            seconds to wait between each prune of the pages with long update
+            chains; setting this value above 0 configures update pruning''',
+            min='0', max='100000'),
+        ]),
     Config('verbose', '', r'''
         enable messages for various events. Only available if WiredTiger
         is configured with --enable-verbose. Options are given as a
@@ -550,10 +635,32 @@ common_wiredtiger_open = [
         Config('prealloc', 'true', r'''
             pre-allocate log files.''',
             type='boolean'),
+        Config('recycle', 'false', r'''
+            recycle archived log files into the pool of pre-allocated log
+            files, overwriting them in place instead of removing them and
+            allocating new files.  Has no effect unless \c log.archive and
+            \c log.prealloc are also configured''',
+            type='boolean'),
         Config('recover', 'on', r'''
             run recovery or error if recovery needs to run after an
             unclean shutdown.''',
             choices=['error','on']),
+        Config('recover_threads', '1', r'''
+            the number of threads used to apply log records during
+            recovery.  Operations are distributed to threads by file,
+            so changes to independent files are applied concurrently
+            while changes to each file are applied in log order''',
+            min='1', max='64'),
+        ]),
+    Config('lookaside', '', r'''
+        configure the lookaside table, into which eviction writes older
+        versions of records running transactions may need, allowing pages
+        to be evicted while long-running transactions are active.  See
+        @ref cache_lookaside for more information''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            enable the lookaside table''',
+            type='boolean'),
         ]),
     Config('mmap', 'true', r'''
         Use memory mapping to access files when possible''',
@@ -582,6 +689,14 @@ common_wiredtiger_open = [
             the method used to ensure log records are stable on disk,
         see @ref tune_durability for more information''',
             choices=['dsync', 'fsync', 'none']),
+        Config('group_commit_delay', '0', r'''
+            the maximum number of microseconds a commit may be delayed
+        to group its flush with other committing transactions.  The
+        delay adapts to the observed flush latency and commit arrival
+        rate and is only applied when additional commits are expected
+        before the flush completes.  A value of zero disables the
+        delay''',
+            min='0', max='100000'),
         ]),
 ]
 
@@ -672,6 +787,27 @@ methods = {
         characters are hexadecimal encoded.  These formats are compatible
         with the @ref util_dump and @ref util_load commands''',
         choices=['hex', 'json', 'print']),
+    Config('log_batch', '1', r'''
+        the number of log records a log cursor reads each time it reads
+        the log.  Larger batches reduce the cost of reading the log when
+        iterating over many records.  See @ref cursor_log for details''',
+        min='1', max='10000'),
+    Config('log_operations', '', r'''
+        if non-empty, a log cursor only returns the listed types of
+        operations from transaction commit records, other log records
+        are not returned.  See @ref cursor_log for details''',
+        type='list', choices=['col_put', 'col_remove', 'col_truncate',
+        'row_modify', 'row_put', 'row_remove', 'row_truncate']),
+    Config('log_start_lsn', '', r'''
+        the log sequence number, as a pair of log file number and offset,
+        where a log cursor's WT_CURSOR::next method starts returning log
+        records, for example \c "(2,128)".  See @ref cursor_log for
+        details'''),
+    Config('log_stop_lsn', '', r'''
+        the log sequence number, as a pair of log file number and offset,
+        where a log cursor's WT_CURSOR::next method stops returning log
+        records: only records before this log sequence number are
+        returned.  See @ref cursor_log for details'''),
     Config('next_random', 'false', r'''
         configure the cursor to return a pseudo-random record from
         the object; valid only for row-store cursors.  Cursors
@@ -679,6 +815,13 @@ methods = {
         WT_CURSOR::next and WT_CURSOR::close methods.  See @ref
         cursor_random for details''',
         type='boolean'),
+    Config('prefix_search', 'false', r'''
+        configure WT_CURSOR::search_near to search for keys beginning
+        with the search key: it returns ::WT_NOTFOUND if there are none,
+        and WT_CURSOR::next and WT_CURSOR::prev return ::WT_NOTFOUND
+        once they move past them; valid only for LSM trees.  See @ref
+        lsm_bloom_prefix for details''',
+        type='boolean'),
     Config('raw', 'false', r'''
         ignore the encodings for the key and value, manage data as if
         the formats were \c "u".  See @ref cursor_raw for details''',
@@ -712,7 +855,9 @@ methods = {
         type='list', choices=['all', 'fast', 'clear']),
     Config('target', '', r'''
         if non-empty, backup the list of objects; valid only for a
-        backup data source''',
+        backup data source.  For log cursors, only return operations
+        on the listed tables and files from transaction commit records,
+        other log records are not returned''',
         type='list'),
 ]),
 
@@ -750,6 +895,15 @@ methods = {
 ]),
 
 'session.begin_transaction' : Method([
+    Config('group', 'false', r'''
+        begin a group transaction: a transaction made up of units, each
+        finished by WT_SESSION::commit_transaction or
+        WT_SESSION::rollback_transaction with the \c unit configuration.
+        Units are savepoints: they share the transaction's ID and snapshot,
+        and the units that aren't rolled back are committed together, with
+        a single log record.  Committing the transaction fails with EINVAL
+        while a unit is unfinished.  See @ref transaction_group''',
+        type='boolean'),
     Config('isolation', '', r'''
         the isolation level for this transaction; defaults to the
         session's isolation level''',
@@ -760,14 +914,48 @@ methods = {
         priority of the transaction for resolving conflicts.
         Transactions with higher values are less likely to abort''',
         min='-100', max='100'),
+    Config('snapshot', '', r'''
+        use a named, in-memory snapshot created by WT_SESSION::snapshot,
+        the transaction runs at snapshot isolation.  See @ref
+        transaction_named_snapshots'''),
     Config('sync', '', r'''
         whether to sync log records when the transaction commits,
         inherited from ::wiredtiger_open \c transaction_sync''',
         type='boolean'),
 ]),
 
-'session.commit_transaction' : Method([]),
-'session.rollback_transaction' : Method([]),
+'session.commit_transaction' : Method([
+    Config('unit', 'false', r'''
+        finish the current unit of a group transaction, rather than the
+        transaction: the unit's changes are kept, like a savepoint, and
+        committed with the group''',
+        type='boolean'),
+]),
+'session.snapshot' : Method([
+    Config('drop', '', r'''
+        if non-empty, specifies which snapshots to drop.  Where a group
+        of snapshots are being dropped, the order is based on snapshot
+        creation order not alphanumeric name order''',
+        type='category', subconfig=[
+        Config('all', 'false', r'''
+            drop all named snapshots''', type='boolean'),
+        Config('before', '', r'''
+            drop all snapshots up to but not including the specified
+            name'''),
+        Config('names', '', r'''
+            drop specific named snapshots''', type='list'),
+        Config('to', '', r'''
+            drop all snapshots up to and including the specified name'''),
+    ]),
+    Config('name', '', r'''
+        specify a name for the snapshot'''),
+]),
+'session.rollback_transaction' : Method([
+    Config('unit', 'false', r'''
+        roll back the current unit of a group transaction, rather than the
+        transaction: changes made by the group's earlier units are kept''',
+        type='boolean'),
+]),
 
 'session.checkpoint' : Method([
     Config('drop', '', r'''
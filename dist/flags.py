@@ -23,6 +23,7 @@ flags = {
         'FILE_TYPE_TURTLE',
     ],
     'log_scan' : [
+        'LOGSCAN_BATCH',
         'LOGSCAN_FIRST',
         'LOGSCAN_FROM_CKP',
         'LOGSCAN_ONE',
@@ -47,6 +48,7 @@ flags = {
     'rec_write' : [
         'EVICTING',
         'SKIP_UPDATE_ERR',
+        'SKIP_UPDATE_LAS',
         'SKIP_UPDATE_RESTORE',
     ],
     'txn_log_checkpoint' : [
@@ -89,6 +91,7 @@ flags = {
         'CONN_CKPT_SYNC',
         'CONN_CLOSING',
         'CONN_EVICTION_RUN',
+        'CONN_LAS_OPEN',
         'CONN_LEAK_MEMORY',
         'CONN_LOG_SERVER_RUN',
         'CONN_LSM_MERGE',
@@ -96,6 +99,7 @@ flags = {
         'CONN_SERVER_ASYNC',
         'CONN_SERVER_CHECKPOINT',
         'CONN_SERVER_LSM',
+        'CONN_SERVER_PRUNE',
         'CONN_SERVER_RUN',
         'CONN_SERVER_STATISTICS',
         'CONN_SERVER_SWEEP',
@@ -103,6 +107,7 @@ flags = {
     ],
     'session' : [
         'SESSION_CAN_WAIT',
+        'SESSION_CHECKPOINT_THROTTLE',
         'SESSION_CLEAR_EVICT_WALK',
         'SESSION_DISCARD_FORCE',
         'SESSION_HANDLE_LIST_LOCKED',
@@ -60,4 +60,6 @@ optypes = [
     LogOperationType('row_truncate', 'row truncate',
         [('uint32', 'fileid'), ('item', 'start'), ('item', 'stop'),
             ('uint32', 'mode')]),
+    LogOperationType('row_modify', 'row modify',
+        [('uint32', 'fileid'), ('item', 'key'), ('item', 'value')]),
 ]
@@ -144,6 +144,9 @@ connection_stats = [
     ##########################################
     # Cache and eviction statistics
     ##########################################
+    CacheStat('cache_arena_alloc', 'bytes allocated for page arenas'),
+    CacheStat('cache_bytes_bloom',
+        'bytes in bloom filters loaded into memory', 'no_clear,no_scale'),
     CacheStat('cache_bytes_dirty',
         'tracked dirty bytes in the cache', 'no_scale'),
     CacheStat('cache_bytes_inuse',
@@ -185,13 +188,21 @@ connection_stats = [
     CacheStat('cache_eviction_worker_evicting',
         'eviction worker thread evicting pages'),
     CacheStat('cache_inmem_split', 'in-memory page splits'),
+    CacheStat('cache_lookaside_cursor_wait',
+        'lookaside table cursor wait calls'),
+    CacheStat('cache_lookaside_insert', 'lookaside table insert calls'),
+    CacheStat('cache_lookaside_remove', 'lookaside table remove calls'),
     CacheStat('cache_overhead', 'percentage overhead', 'no_clear,no_scale'),
     CacheStat('cache_pages_dirty',
         'tracked dirty pages in the cache', 'no_scale'),
     CacheStat('cache_pages_inuse',
         'pages currently held in the cache', 'no_clear,no_scale'),
     CacheStat('cache_read', 'pages read into cache'),
+    CacheStat('cache_read_lookaside',
+        'pages read into cache requiring lookaside entries'),
     CacheStat('cache_write', 'pages written from cache'),
+    CacheStat('cache_write_lookaside',
+        'page written requiring lookaside records'),
 
     ##########################################
     # Dhandle statistics
@@ -216,16 +227,29 @@ connection_stats = [
     LogStat('log_compress_small', 'log records too small to compress'),
     LogStat('log_compress_writes', 'log records compressed'),
     LogStat('log_compress_write_fails', 'log records not compressed'),
+    LogStat('log_group_commit_delay_time',
+        'group commit time spent waiting for committers (usecs)'),
+    LogStat('log_group_commit_delays',
+        'group commit waits for additional committers'),
     LogStat('log_max_filesize', 'maximum log file size', 'no_clear,no_scale'),
     LogStat('log_prealloc_files', 'pre-allocated log files prepared'),
     LogStat('log_prealloc_max', 'number of pre-allocated log files to create'),
     LogStat('log_prealloc_used', 'pre-allocated log files used'),
+    LogStat('log_prealloc_recycled', 'archived log files recycled'),
     LogStat('log_reads', 'log read operations'),
     LogStat('log_release_write_lsn', 'log release advances write LSN'),
     LogStat('log_scan_records', 'records processed by log scan'),
     LogStat('log_scan_rereads', 'log scan records requiring two reads'),
     LogStat('log_scans', 'log scan operations'),
     LogStat('log_sync', 'log sync operations'),
+    LogStat('log_sync_commit_gt100',
+        'durable commit latency histogram: 100ms or more'),
+    LogStat('log_sync_commit_lt1',
+        'durable commit latency histogram: less than 1ms'),
+    LogStat('log_sync_commit_lt10',
+        'durable commit latency histogram: 1ms to 10ms'),
+    LogStat('log_sync_commit_lt100',
+        'durable commit latency histogram: 10ms to 100ms'),
     LogStat('log_sync_dir', 'log sync_dir operations'),
     LogStat('log_writes', 'log write operations'),
     LogStat('log_write_lsn', 'log server thread advances write LSN'),
@@ -268,22 +292,65 @@ connection_stats = [
     TxnStat('txn_checkpoint_time_total',
         'transaction checkpoint total time (msecs)',
         'no_aggregate,no_clear,no_scale'),
+    TxnStat('txn_checkpoint_file_time_max',
+        'transaction checkpoint most recent file max time (msecs)',
+        'no_aggregate,no_clear,no_scale'),
+    TxnStat('txn_checkpoint_file_time_total',
+        'transaction checkpoint most recent file total time (msecs)',
+        'no_aggregate,no_clear,no_scale'),
     TxnStat('txn_checkpoint_running',
         'transaction checkpoint currently running',
         'no_aggregate,no_clear,no_scale'),
+    TxnStat('txn_checkpoint_throttle',
+        'transaction checkpoint writes throttled'),
+    TxnStat('txn_checkpoint_throttle_time',
+        'transaction checkpoint write throttle time (usecs)'),
+    TxnStat('txn_checkpoint_write_rate',
+        'transaction checkpoint write rate (bytes per second)',
+        'no_aggregate,no_clear,no_scale'),
     TxnStat('txn_pinned_range',
         'transaction range of IDs currently pinned',
         'no_aggregate,no_clear,no_scale'),
+    TxnStat('txn_pinned_snapshot_range',
+        'transaction range of IDs currently pinned by named snapshots',
+        'no_aggregate,no_clear,no_scale'),
+    TxnStat('txn_prune_chain_after',
+        'update chain total length after pruning'),
+    TxnStat('txn_prune_chain_before',
+        'update chain total length before pruning'),
+    TxnStat('txn_prune_chain_long',
+        'update chains still at the prune length after pruning'),
+    TxnStat('txn_prune_chain_max_after',
+        'update chain maximum length after the last pruning',
+        'no_aggregate,no_scale'),
+    TxnStat('txn_prune_chain_max_before',
+        'update chain maximum length before the last pruning',
+        'no_aggregate,no_scale'),
+    TxnStat('txn_prune_chains', 'update chains pruned'),
+    TxnStat('txn_prune_pages', 'update prune pages visited'),
+    TxnStat('txn_prune_passes', 'update prune passes'),
+    TxnStat('txn_prune_updates', 'obsolete updates pruned'),
+    TxnStat('txn_snapshot_rebuild', 'read-committed snapshots rebuilt'),
+    TxnStat('txn_snapshot_reuse', 'read-committed snapshots reused'),
+    TxnStat('txn_snapshots_created', 'number of named snapshots created'),
+    TxnStat('txn_snapshots_dropped', 'number of named snapshots dropped'),
     TxnStat('txn_commit', 'transactions committed'),
     TxnStat('txn_fail_cache', 'transaction failures due to cache overflow'),
+    TxnStat('txn_group_unit_commit', 'group transaction units committed'),
+    TxnStat('txn_group_unit_rollback',
+        'group transaction units rolled back'),
     TxnStat('txn_rollback', 'transactions rolled back'),
+    TxnStat('txn_update_conflict', 'update conflicts'),
 
     ##########################################
     # LSM statistics
     ##########################################
-    LSMStat('lsm_checkpoint_throttle', 'sleep for LSM checkpoint throttle'),
-    LSMStat('lsm_merge_throttle', 'sleep for LSM merge throttle'),
+    LSMStat('lsm_bloom_blocks_disk',
+        'bloom filters read from disk, over the memory limit'),
+    LSMStat('lsm_merge_ranges_helped',
+        'merge key ranges merged by helper threads'),
     LSMStat('lsm_rows_merged', 'rows merged in an LSM tree'),
+    LSMStat('lsm_throttle', 'sleep for LSM write throttle (usecs)'),
     LSMStat('lsm_work_queue_app',
         'application work units currently queued', 'no_clear,no_scale'),
     LSMStat('lsm_work_queue_manager',
@@ -308,6 +375,9 @@ connection_stats = [
     ##########################################
     CursorStat('cursor_create', 'cursor create calls'),
     CursorStat('cursor_insert', 'cursor insert calls'),
+    CursorStat('cursor_modify', 'cursor modify calls'),
+    CursorStat('cursor_modify_delta',
+        'cursor modify calls stored as modifications'),
     CursorStat('cursor_next', 'cursor next calls'),
     CursorStat('cursor_prev', 'cursor prev calls'),
     CursorStat('cursor_remove', 'cursor remove calls'),
@@ -347,6 +417,9 @@ dsrc_stats = [
     CursorStat('cursor_insert_bulk', 'bulk-loaded cursor-insert calls'),
     CursorStat('cursor_insert_bytes',
         'cursor-insert key and value bytes inserted'),
+    CursorStat('cursor_modify', 'modify calls'),
+    CursorStat('cursor_modify_bytes',
+        'cursor-modify packed modification bytes'),
     CursorStat('cursor_next', 'next calls'),
     CursorStat('cursor_prev', 'prev calls'),
     CursorStat('cursor_remove', 'remove calls'),
@@ -392,20 +465,48 @@ dsrc_stats = [
     ##########################################
     LSMStat('bloom_count', 'bloom filters in the LSM tree', 'no_scale'),
     LSMStat('bloom_false_positive', 'bloom filter false positives'),
+    LSMStat('bloom_flush', 'bloom filters created while flushing chunks'),
     LSMStat('bloom_hit', 'bloom filter hits'),
     LSMStat('bloom_miss', 'bloom filter misses'),
     LSMStat('bloom_page_evict', 'bloom filter pages evicted from cache'),
     LSMStat('bloom_page_read', 'bloom filter pages read into cache'),
+    LSMStat('bloom_prefix_miss', 'bloom filter misses for key prefixes'),
     LSMStat('bloom_size', 'total size of bloom filters', 'no_scale'),
-    LSMStat('lsm_checkpoint_throttle', 'sleep for LSM checkpoint throttle'),
+    LSMStat('lsm_amplification_read',
+        'chunks a query may search (read amplification)',
+        'no_aggregate,no_clear,no_scale'),
+    LSMStat('lsm_amplification_space',
+        'chunk size as a percentage of the deepest level ' +
+        '(space amplification)', 'no_aggregate,no_clear,no_scale'),
+    LSMStat('lsm_amplification_write',
+        'bytes flushed and merged as a percentage of bytes flushed ' +
+        '(write amplification)', 'no_aggregate,no_clear,no_scale'),
+    LSMStat('lsm_backlog_predicted',
+        'chunks expected to be waiting to be flushed or merged',
+        'no_aggregate,no_clear,no_scale'),
+    LSMStat('lsm_bytes_flushed', 'bytes written flushing chunks'),
+    LSMStat('lsm_bytes_merged', 'bytes written merging chunks'),
     LSMStat('lsm_chunk_count',
         'chunks in the LSM tree', 'no_aggregate,no_scale'),
     LSMStat('lsm_generation_max',
         'highest merge generation in the LSM tree', 'max_aggregate,no_scale'),
+    LSMStat('lsm_lookup_key_range',
+        'chunks skipped by queries outside the chunk key range'),
     LSMStat('lsm_lookup_no_bloom',
         'queries that could have benefited ' +
         'from a Bloom filter that did not exist'),
-    LSMStat('lsm_merge_throttle', 'sleep for LSM merge throttle'),
+    LSMStat('lsm_merge_moved',
+        'chunks moved to the next level without merging'),
+    LSMStat('lsm_throttle', 'sleep for LSM write throttle (usecs)'),
+    LSMStat('lsm_throttle_delay',
+        'LSM write throttle delay per update (nsecs)',
+        'no_aggregate,no_clear,no_scale'),
+    LSMStat('lsm_work_queue_wait',
+        'time tree maintenance operations waited in a queue (usecs)'),
+    LSMStat('lsm_work_queue_wait_max',
+        'longest time a tree maintenance operation waited in a queue (usecs)',
+        'max_aggregate,no_scale'),
+    LSMStat('lsm_work_units_done', 'tree maintenance operations executed'),
 
     ##########################################
     # Block manager statistics
@@ -442,8 +543,12 @@ dsrc_stats = [
     CacheStat('cache_overflow_value',
         'overflow values cached in memory', 'no_scale'),
     CacheStat('cache_read', 'pages read into cache'),
+    CacheStat('cache_read_lookaside',
+        'pages read into cache requiring lookaside entries'),
     CacheStat('cache_read_overflow', 'overflow pages read into cache'),
     CacheStat('cache_write', 'pages written from cache'),
+    CacheStat('cache_write_lookaside',
+        'page written requiring lookaside records'),
 
     ##########################################
     # Compression statistics
@@ -340,6 +340,36 @@ cursor_ops(WT_SESSION *session)
 	/*! [Remove a record and fail if DNE] */
 	}
 
+	{
+	/*! [Modify an existing record] */
+	WT_ITEM value;
+	WT_MODIFY entries[2];
+
+	ret = session->create(session,
+	    "table:mymodify", "key_format=S,value_format=u");
+	ret = session->open_cursor(
+	    session, "table:mymodify", NULL, NULL, &cursor);
+	cursor->set_key(cursor, "some key");
+	value.data = "The quick brown fox";
+	value.size = strlen("The quick brown fox");
+	cursor->set_value(cursor, &value);
+	ret = cursor->insert(cursor);
+
+	/* Replace "quick" with "slow", then append " jumped". */
+	entries[0].data.data = "slow";
+	entries[0].data.size = strlen("slow");
+	entries[0].offset = 4;
+	entries[0].size = strlen("quick");
+	entries[1].data.data = " jumped";
+	entries[1].data.size = strlen(" jumped");
+	entries[1].offset = strlen("The slow brown fox");
+	entries[1].size = 0;
+
+	cursor->set_key(cursor, "some key");
+	ret = cursor->modify(cursor, entries, 2);
+	/*! [Modify an existing record] */
+	}
+
 	{
 	/*! [Display an error] */
 	const char *key = "non-existent key";
@@ -783,6 +813,44 @@ transaction_ops(WT_CONNECTION *conn, WT_SESSION *session)
 	/*! [transaction pinned range] */
 	}
 
+	/*! [named snapshot] */
+	/* Create a named snapshot. */
+	ret = session->snapshot(session, "name=June01");
+
+	/* Begin a transaction reading as of the named snapshot. */
+	ret = session->begin_transaction(session, "snapshot=June01");
+	ret = session->commit_transaction(session, NULL);
+
+	/* Drop all named snapshots. */
+	ret = session->snapshot(session, "drop=(all)");
+	/*! [named snapshot] */
+
+	/*! [group transaction] */
+	/*
+	 * Commit independent units of work in a single group transaction: a
+	 * unit that fails is rolled back without affecting the other units.
+	 */
+	ret =
+	    session->open_cursor(session, "table:mytable", NULL, NULL, &cursor);
+	ret = session->begin_transaction(session, "group=true");
+	cursor->set_key(cursor, "key1");
+	cursor->set_value(cursor, "value1");
+	if ((ret = cursor->update(cursor)) == 0)
+		ret = session->commit_transaction(session, "unit=true");
+	else
+		ret = session->rollback_transaction(session, "unit=true");
+	cursor->set_key(cursor, "key2");
+	cursor->set_value(cursor, "value2");
+	if ((ret = cursor->update(cursor)) == 0)
+		ret = session->commit_transaction(session, "unit=true");
+	else
+		ret = session->rollback_transaction(session, "unit=true");
+
+	/* Commit the units, with a single log record. */
+	ret = session->commit_transaction(session, NULL);
+	ret = cursor->close(cursor);
+	/*! [group transaction] */
+
 	return (ret);
 }
 
@@ -14,6 +14,7 @@ COPYDOC(__wt_cursor, WT_CURSOR, search_near)
 COPYDOC(__wt_cursor, WT_CURSOR, insert)
 COPYDOC(__wt_cursor, WT_CURSOR, update)
 COPYDOC(__wt_cursor, WT_CURSOR, remove)
+COPYDOC(__wt_cursor, WT_CURSOR, modify)
 COPYDOC(__wt_cursor, WT_CURSOR, close)
 COPYDOC(__wt_cursor, WT_CURSOR, reconfigure)
 COPYDOC(__wt_async_op, WT_ASYNC_OP, get_key)
@@ -44,6 +45,7 @@ COPYDOC(__wt_session, WT_SESSION, commit_transaction)
 COPYDOC(__wt_session, WT_SESSION, rollback_transaction)
 COPYDOC(__wt_session, WT_SESSION, checkpoint)
 COPYDOC(__wt_session, WT_SESSION, transaction_pinned_range)
+COPYDOC(__wt_session, WT_SESSION, snapshot)
 COPYDOC(__wt_connection, WT_CONNECTION, async_flush)
 COPYDOC(__wt_connection, WT_CONNECTION, async_new_op)
 COPYDOC(__wt_connection, WT_CONNECTION, close)
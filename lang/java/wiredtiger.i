@@ -280,6 +280,7 @@ WT_CLASS(struct __wt_async_op, WT_ASYNC_OP, op)
 %ignore __wt_cursor::set_key;
 %ignore __wt_cursor::set_value;
 %ignore __wt_cursor::insert;
+%ignore __wt_cursor::modify;
 %ignore __wt_cursor::remove;
 %ignore __wt_cursor::search;
 %ignore __wt_cursor::search_near;
@@ -1748,6 +1749,7 @@ WT_ASYNC_CALLBACK javaApiAsyncHandler = {javaAsyncHandler};
 %ignore __wt_connection::add_extractor;
 %ignore __wt_item;
 %ignore __wt_lsn;
+%ignore __wt_modify;
 %ignore __wt_session::msg_printf;
 
 %ignore wiredtiger_struct_pack;
@@ -403,6 +403,7 @@ retry:
 
 EBUSY_OK(__wt_connection::async_new_op)
 ENUM_OK(__wt_async_op::get_type)
+NOTFOUND_OK(__wt_cursor::_modify)
 NOTFOUND_OK(__wt_cursor::next)
 NOTFOUND_OK(__wt_cursor::prev)
 NOTFOUND_OK(__wt_cursor::remove)
@@ -447,10 +448,12 @@ COMPARE_NOTFOUND_OK(__wt_cursor::_search_near)
 %ignore __wt_cursor::compare(WT_CURSOR *, WT_CURSOR *, int *);
 %ignore __wt_cursor::equals(WT_CURSOR *, WT_CURSOR *, int *);
 %ignore __wt_cursor::search_near(WT_CURSOR *, int *);
+%ignore __wt_cursor::modify(WT_CURSOR *, WT_MODIFY *, int);
 
 OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, compare, (self, other))
 OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, equals, (self, other))
 OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, search_near, (self))
+OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, modify, (self, entries))
 
 /* SWIG magic to turn Python byte strings into data / size. */
 %apply (char *STRING, int LENGTH) { (char *data, int size) };
@@ -537,6 +540,44 @@ typedef int int_void;
 		return (ret);
 	}
 
+	/*
+	 * modify: special handling, the modifications are a list of
+	 * (data, offset, size) tuples.
+	 */
+	int _modify(PyObject *list) {
+		WT_MODIFY *entries;
+		PyObject *entry;
+		Py_ssize_t i, nentries, offset, size;
+		char *data;
+		int data_size, ret;
+
+		if (!PyList_Check(list)) {
+			SWIG_Error(SWIG_TypeError,
+			    "in method 'Cursor_modify', "
+			    "argument 1 must be a list of tuples");
+			return (EINVAL);
+		}
+		nentries = PyList_Size(list);
+		if ((entries = calloc(
+		    (size_t)nentries + 1, sizeof(WT_MODIFY))) == NULL)
+			return (ENOMEM);
+		for (i = 0; i < nentries; i++) {
+			entry = PyList_GetItem(list, i);
+			if (!PyArg_ParseTuple(entry, "s#nn",
+			    &data, &data_size, &offset, &size)) {
+				free(entries);
+				return (EINVAL);
+			}
+			entries[i].data.data = data;
+			entries[i].data.size = (size_t)data_size;
+			entries[i].offset = (size_t)offset;
+			entries[i].size = (size_t)size;
+		}
+		ret = $self->modify($self, entries, (int)nentries);
+		free(entries);
+		return (ret);
+	}
+
 	int _freecb() {
 		return (cursorFreeHandler($self));
 	}
@@ -908,6 +949,7 @@ int verbose_build();
 %ignore __wt_extractor;
 %ignore __wt_item;
 %ignore __wt_lsn;
+%ignore __wt_modify;
 
 %ignore __wt_connection::add_collator;
 %ignore __wt_connection::add_compressor;
@@ -67,6 +67,57 @@ __wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	return (0);
 }
 
+/*
+ * Checkpoint writes are throttled with a token bucket holding 100 milliseconds
+ * of writes at the configured rate, so short bursts of writes aren't delayed.
+ */
+#define	WT_CKPT_WRITE_BURST	(100 * WT_MILLION)
+
+/*
+ * __block_write_throttle --
+ *	Throttle checkpoint writes to the configured rate.
+ */
+static int
+__block_write_throttle(WT_SESSION_IMPL *session, size_t size)
+{
+	struct timespec now;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t now_nsecs, rate, wait_usecs;
+
+	conn = S2C(session);
+
+	if (conn->ckpt_write_rate == 0)
+		return (0);
+
+	WT_RET(__wt_epoch(session, &now));
+	now_nsecs = (uint64_t)now.tv_sec * WT_BILLION + (uint64_t)now.tv_nsec;
+
+	/*
+	 * The bucket is represented by the time at which it empties: each
+	 * write moves that time forward by the time the write takes at the
+	 * configured rate, and if the time is in the future, the writer waits
+	 * for it.
+	 */
+	wait_usecs = 0;
+	__wt_spin_lock(session, &conn->ckpt_write_lock);
+	if ((rate = conn->ckpt_write_rate) != 0) {
+		if (conn->ckpt_write_next + WT_CKPT_WRITE_BURST < now_nsecs)
+			conn->ckpt_write_next = now_nsecs - WT_CKPT_WRITE_BURST;
+		conn->ckpt_write_next += size * WT_BILLION / rate;
+		if (conn->ckpt_write_next > now_nsecs)
+			wait_usecs = (conn->ckpt_write_next - now_nsecs) / 1000;
+	}
+	__wt_spin_unlock(session, &conn->ckpt_write_lock);
+
+	if (wait_usecs != 0) {
+		__wt_sleep(0, (long)wait_usecs);
+		WT_STAT_FAST_CONN_INCR(session, txn_checkpoint_throttle);
+		WT_STAT_FAST_CONN_INCRV(
+		    session, txn_checkpoint_throttle_time, wait_usecs);
+	}
+	return (0);
+}
+
 /*
  * __wt_block_write_off --
  *	Write a buffer into a block, returning the block's offset, size and
@@ -143,6 +194,14 @@ __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	blk->cksum = __wt_cksum(
 	    buf->mem, data_cksum ? align_size : WT_BLOCK_COMPRESS_SKIP);
 
+	/*
+	 * Throttle checkpoint writes, before acquiring any lock; writes made
+	 * with our caller holding the lock aren't throttled.  Checkpoints
+	 * holding the hot backup lock clear the session's throttle flag.
+	 */
+	if (!caller_locked && F_ISSET(session, WT_SESSION_CHECKPOINT_THROTTLE))
+		WT_RET(__block_write_throttle(session, align_size));
+
 	if (!caller_locked) {
 		WT_RET(__wt_block_ext_prealloc(session, 5));
 		__wt_spin_lock(session, &block->live_lock);
@@ -14,6 +14,8 @@
 #include "wt_internal.h"
 
 #define	WT_BLOOM_TABLE_CONFIG "key_format=r,value_format=1t,exclusive=true"
+#define	WT_BLOOM_BLOCKED_TABLE_CONFIG					\
+	"key_format=r,value_format=u,exclusive=true"
 
 /*
  * __bloom_init --
@@ -21,26 +23,30 @@
  */
 static int
 __bloom_init(WT_SESSION_IMPL *session,
-    const char *uri, const char *config, WT_BLOOM **bloomp)
+    const char *uri, const char *config, uint32_t flags, WT_BLOOM **bloomp)
 {
 	WT_BLOOM *bloom;
 	WT_DECL_RET;
 	size_t len;
+	const char *table_config;
 
 	*bloomp = NULL;
 
 	WT_RET(__wt_calloc_one(session, &bloom));
 
+	table_config = LF_ISSET(WT_BLOOM_BLOCKED) ?
+	    WT_BLOOM_BLOCKED_TABLE_CONFIG : WT_BLOOM_TABLE_CONFIG;
 	WT_ERR(__wt_strdup(session, uri, &bloom->uri));
-	len = strlen(WT_BLOOM_TABLE_CONFIG) + 2;
+	len = strlen(table_config) + 2;
 	if (config != NULL)
 		len += strlen(config);
 	WT_ERR(__wt_calloc_def(session, len, &bloom->config));
 	/* Add the standard config at the end, so it overrides user settings. */
 	(void)snprintf(bloom->config, len,
-	    "%s,%s", config == NULL ? "" : config, WT_BLOOM_TABLE_CONFIG);
+	    "%s,%s", config == NULL ? "" : config, table_config);
 
 	bloom->session = session;
+	bloom->flags = flags;
 
 	*bloomp = bloom;
 	return (0);
@@ -72,6 +78,10 @@ __bloom_setup(
 	if (n != 0) {
 		bloom->n = n;
 		bloom->m = bloom->n * bloom->factor;
+
+		/* Blocked filters are a whole number of blocks. */
+		if (F_ISSET(bloom, WT_BLOOM_BLOCKED))
+			bloom->m = WT_ALIGN(bloom->m, WT_BLOOM_BLOCK_BITS);
 	} else {
 		bloom->m = m;
 		bloom->n = bloom->m / bloom->factor;
@@ -88,16 +98,19 @@ __bloom_setup(
  * count  - is the expected number of inserted items
  * factor - is the number of bits to use per inserted item
  * k      - is the number of hash values to set or test per item
+ * flags  - WT_BLOOM_BLOCKED to create a blocked filter, which can only be
+ *          read with __wt_bloom_open_blocks
  */
 int
 __wt_bloom_create(
     WT_SESSION_IMPL *session, const char *uri, const char *config,
-    uint64_t count, uint32_t factor, uint32_t k, WT_BLOOM **bloomp)
+    uint64_t count, uint32_t factor, uint32_t k, uint32_t flags,
+    WT_BLOOM **bloomp)
 {
 	WT_BLOOM *bloom;
 	WT_DECL_RET;
 
-	WT_RET(__bloom_init(session, uri, config, &bloom));
+	WT_RET(__bloom_init(session, uri, config, flags, &bloom));
 	WT_ERR(__bloom_setup(bloom, count, 0, factor, k));
 
 	WT_ERR(__bit_alloc(session, bloom->m, &bloom->bitstring));
@@ -152,7 +165,7 @@ __wt_bloom_open(WT_SESSION_IMPL *session,
 	WT_DECL_RET;
 	uint64_t size;
 
-	WT_RET(__bloom_init(session, uri, NULL, &bloom));
+	WT_RET(__bloom_init(session, uri, NULL, 0, &bloom));
 	WT_ERR(__bloom_open_cursor(bloom, owner));
 	c = bloom->c;
 
@@ -170,6 +183,168 @@ err:	(void)__wt_bloom_close(bloom);
 	return (ret);
 }
 
+/*
+ * __wt_bloom_open_blocks --
+ *	Open a blocked Bloom filter for use by a single session.  If the filter
+ *	was loaded into memory, its memory is owned by the caller, otherwise
+ *	blocks are read from disk.
+ */
+int
+__wt_bloom_open_blocks(WT_SESSION_IMPL *session,
+    const char *uri, WT_BLOOM_BLOCKS *blocks, uint32_t factor, uint32_t k,
+    WT_CURSOR *owner, WT_BLOOM **bloomp)
+{
+	WT_BLOOM *bloom;
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_ITEM value;
+	uint64_t nblocks, recno;
+
+	WT_RET(__bloom_init(session, uri, NULL, WT_BLOOM_BLOCKED, &bloom));
+	if ((bloom->blocks = blocks) != NULL)
+		nblocks = blocks->nblocks;
+	else {
+		/* Find the last record, to get the size of the filter. */
+		WT_ERR(__bloom_open_cursor(bloom, owner));
+		c = bloom->c;
+		WT_ERR(c->prev(c));
+		WT_ERR(c->get_key(c, &recno));
+		WT_ERR(c->get_value(c, &value));
+		nblocks = ((recno - 1) * WT_BLOOM_RECORD_SIZE + value.size) /
+		    WT_BLOOM_BLOCK_SIZE;
+		WT_ERR(c->reset(c));
+	}
+	WT_ERR(__bloom_setup(
+	    bloom, 0, nblocks * WT_BLOOM_BLOCK_BITS, factor, k));
+
+	*bloomp = bloom;
+	return (0);
+
+err:	(void)__wt_bloom_close(bloom);
+	return (ret);
+}
+
+/*
+ * __wt_bloom_blocks_load --
+ *	Read a blocked Bloom filter into a contiguous, cache-line aligned
+ *	bitmap.  Loaded filters can't be evicted, so they are accounted for
+ *	separately from the pages in the cache, and limited to a fraction of
+ *	the cache size: if the filter doesn't fit, it's not loaded.
+ */
+int
+__wt_bloom_blocks_load(
+    WT_SESSION_IMPL *session, const char *uri, WT_BLOOM_BLOCKS **blocksp)
+{
+	WT_BLOOM_BLOCKS *blocks;
+	WT_CACHE *cache;
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_ITEM value;
+	size_t memsize;
+	uint64_t offset, recno, size;
+	const char *cfg[] = {
+	    WT_CONFIG_BASE(session, session_open_cursor), NULL };
+	int no_cache;
+
+	*blocksp = NULL;
+
+	cache = S2C(session)->cache;
+	blocks = NULL;
+	c = NULL;
+	memsize = 0;
+
+	/* The bitmap is read once, don't keep the filter's pages in cache. */
+	no_cache = F_ISSET(session, WT_SESSION_NO_CACHE) ? 1 : 0;
+	F_SET(session, WT_SESSION_NO_CACHE);
+
+	WT_ERR(__wt_open_cursor(session, uri, NULL, cfg, &c));
+
+	/* Find the last record, to get the size of the filter. */
+	WT_ERR(c->prev(c));
+	WT_ERR(c->get_key(c, &recno));
+	WT_ERR(c->get_value(c, &value));
+	size = (recno - 1) * WT_BLOOM_RECORD_SIZE + value.size;
+	if (size == 0 || size % WT_BLOOM_BLOCK_SIZE != 0)
+		WT_ERR_MSG(session, WT_ERROR,
+		    "%s: Bloom filter size %" PRIu64 " is not a multiple of "
+		    "the block size", uri, size);
+	WT_ERR(c->reset(c));
+
+	/* Reserve the memory, and give up if we're over the limit. */
+	memsize = (size_t)size + WT_CACHE_LINE_ALIGNMENT;
+	if (WT_ATOMIC_ADD8(cache->bytes_bloom, memsize) >
+	    WT_BLOOM_BLOCKS_MAX(S2C(session))) {
+		WT_STAT_FAST_CONN_INCR(session, lsm_bloom_blocks_disk);
+		goto err;
+	}
+
+	WT_ERR(__wt_calloc_one(session, &blocks));
+	blocks->memsize = memsize;
+	WT_ERR(__wt_calloc(session, 1, blocks->memsize, &blocks->mem));
+	blocks->bitmap = (uint8_t *)(uintptr_t)
+	    WT_ALIGN((uintptr_t)blocks->mem, WT_CACHE_LINE_ALIGNMENT);
+	blocks->nblocks = size / WT_BLOOM_BLOCK_SIZE;
+
+	while ((ret = c->next(c)) == 0) {
+		WT_ERR(c->get_key(c, &recno));
+		WT_ERR(c->get_value(c, &value));
+		offset = (recno - 1) * WT_BLOOM_RECORD_SIZE;
+		if (offset + value.size > size)
+			WT_ERR_MSG(session, WT_ERROR,
+			    "%s: Bloom filter record %" PRIu64 " is out of "
+			    "range", uri, recno);
+		memcpy(blocks->bitmap + offset, value.data, value.size);
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+	*blocksp = blocks;
+	blocks = NULL;
+	memsize = 0;
+
+err:	if (c != NULL)
+		WT_TRET(c->close(c));
+	if (!no_cache)
+		F_CLR(session, WT_SESSION_NO_CACHE);
+	if (blocks != NULL) {
+		__wt_free(session, blocks->mem);
+		__wt_free(session, blocks);
+	}
+	if (memsize != 0)
+		WT_CACHE_DECR(session, cache->bytes_bloom, memsize);
+	return (ret);
+}
+
+/*
+ * __wt_bloom_blocks_free --
+ *	Discard a blocked Bloom filter loaded into memory.
+ */
+void
+__wt_bloom_blocks_free(WT_SESSION_IMPL *session, WT_BLOOM_BLOCKS **blocksp)
+{
+	WT_BLOOM_BLOCKS *blocks;
+	WT_CACHE *cache;
+
+	if ((blocks = *blocksp) == NULL)
+		return;
+	*blocksp = NULL;
+
+	cache = S2C(session)->cache;
+	WT_CACHE_DECR(session, cache->bytes_bloom, blocks->memsize);
+	__wt_free(session, blocks->mem);
+	__wt_free(session, blocks);
+}
+
+/*
+ * A blocked filter chooses a block with the first hash, and sets the item's
+ * bits in that block using the second hash: an odd stride means the bits are
+ * all different for up to WT_BLOOM_BLOCK_BITS hash values.  Each bit depends
+ * only on the hash and the bit's index, so the bits can be calculated in
+ * parallel.
+ */
+#define	WT_BLOOM_BLOCK_BIT(h2, i)					\
+	(((uint32_t)(h2) +						\
+	    (i) * ((uint32_t)((h2) >> 32) | 1)) % WT_BLOOM_BLOCK_BITS)
+
 /*
  * __wt_bloom_insert --
  *	Adds the given key to the Bloom filter.
@@ -177,11 +352,19 @@ err:	(void)__wt_bloom_close(bloom);
 int
 __wt_bloom_insert(WT_BLOOM *bloom, WT_ITEM *key)
 {
-	uint64_t h1, h2;
+	uint64_t base, h1, h2;
 	uint32_t i;
 
 	h1 = __wt_hash_fnv64(key->data, key->size);
 	h2 = __wt_hash_city64(key->data, key->size);
+	if (F_ISSET(bloom, WT_BLOOM_BLOCKED)) {
+		base = (h1 % (bloom->m / WT_BLOOM_BLOCK_BITS)) *
+		    WT_BLOOM_BLOCK_BITS;
+		for (i = 0; i < bloom->k; i++)
+			__bit_set(bloom->bitstring,
+			    base + WT_BLOOM_BLOCK_BIT(h2, i));
+		return (0);
+	}
 	for (i = 0; i < bloom->k; i++, h1 += h2) {
 		__bit_set(bloom->bitstring, h1 % bloom->m);
 	}
@@ -210,21 +393,37 @@ __wt_bloom_finalize(WT_BLOOM *bloom)
 	 * TODO: should this call __wt_schema_create directly?
 	 */
 	WT_RET(wt_session->create(wt_session, bloom->uri, bloom->config));
-	WT_RET(wt_session->open_cursor(
-	    wt_session, bloom->uri, NULL, "bulk=bitmap", &c));
 
-	/* Add the entries from the array into the table. */
-	for (i = 0; i < bloom->m; i += values.size) {
-		/* Adjust bits to bytes for string offset */
-		values.data = bloom->bitstring + (i >> 3);
-		/*
-		 * Shave off some bytes for pure paranoia, in case WiredTiger
-		 * reserves some special sizes. Choose a value so that if
-		 * we do multiple inserts, it will be on an byte boundary.
-		 */
-		values.size = (uint32_t)WT_MIN(bloom->m - i, UINT32_MAX - 127);
-		c->set_value(c, &values);
-		WT_ERR(c->insert(c));
+	/*
+	 * Blocked filters are stored as a sequence of records, other filters
+	 * as a bit table.
+	 */
+	WT_RET(wt_session->open_cursor(wt_session, bloom->uri, NULL,
+	    F_ISSET(bloom, WT_BLOOM_BLOCKED) ? "bulk" : "bulk=bitmap", &c));
+	if (F_ISSET(bloom, WT_BLOOM_BLOCKED)) {
+		for (i = 0; i < bloom->m / 8; i += values.size) {
+			values.data = bloom->bitstring + i;
+			values.size = (uint32_t)
+			    WT_MIN(bloom->m / 8 - i, WT_BLOOM_RECORD_SIZE);
+			c->set_value(c, &values);
+			WT_ERR(c->insert(c));
+		}
+	} else {
+		/* Add the entries from the array into the table. */
+		for (i = 0; i < bloom->m; i += values.size) {
+			/* Adjust bits to bytes for string offset */
+			values.data = bloom->bitstring + (i >> 3);
+			/*
+			 * Shave off some bytes for pure paranoia, in case
+			 * WiredTiger reserves some special sizes. Choose a
+			 * value so that if we do multiple inserts, it will be
+			 * on an byte boundary.
+			 */
+			values.size =
+			    (uint32_t)WT_MIN(bloom->m - i, UINT32_MAX - 127);
+			c->set_value(c, &values);
+			WT_ERR(c->insert(c));
+		}
 	}
 
 err:	WT_TRET(c->close(c));
@@ -249,6 +448,61 @@ __wt_bloom_hash(WT_BLOOM *bloom, WT_ITEM *key, WT_BLOOM_HASH *bhash)
 	return (0);
 }
 
+/*
+ * __bloom_blocks_get --
+ *	Tests whether the key is in a blocked Bloom filter.
+ */
+static int
+__bloom_blocks_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_ITEM value;
+	const uint8_t *block;
+	uint64_t nblocks, offset;
+	uint32_t bit, i;
+	uint8_t mask[WT_BLOOM_BLOCK_SIZE], miss;
+
+	c = NULL;
+	nblocks = bloom->m / WT_BLOOM_BLOCK_BITS;
+	offset = (bhash->h1 % nblocks) * WT_BLOOM_BLOCK_SIZE;
+	if (bloom->blocks != NULL)
+		block = bloom->blocks->bitmap + offset;
+	else {
+		/* Read the block from disk, blocks don't span records. */
+		WT_ERR(__bloom_open_cursor(bloom, NULL));
+		c = bloom->c;
+		c->set_key(c, offset / WT_BLOOM_RECORD_SIZE + 1);
+		WT_ERR(c->search(c));
+		WT_ERR(c->get_value(c, &value));
+		offset %= WT_BLOOM_RECORD_SIZE;
+		if (offset + WT_BLOOM_BLOCK_SIZE > value.size)
+			WT_ERR(WT_ERROR);
+		block = (const uint8_t *)value.data + offset;
+	}
+
+	/*
+	 * Build a mask of the item's bits, then check them all at once, rather
+	 * than testing them one at a time.
+	 */
+	memset(mask, 0, sizeof(mask));
+	for (i = 0; i < bloom->k; i++) {
+		bit = WT_BLOOM_BLOCK_BIT(bhash->h2, i);
+		mask[bit >> 3] |= (uint8_t)(1 << (bit & 0x07));
+	}
+	for (miss = 0, i = 0; i < WT_BLOOM_BLOCK_SIZE; i++)
+		miss |= mask[i] & ~block[i];
+	if (c != NULL)
+		WT_ERR(c->reset(c));
+	return (miss == 0 ? 0 : WT_NOTFOUND);
+
+err:	/* Don't return WT_NOTFOUND from a failed search. */
+	if (ret == WT_NOTFOUND)
+		ret = WT_ERROR;
+	__wt_err(bloom->session, ret, "Failed lookup in bloom filter.");
+	return (ret);
+}
+
 /*
  * __wt_bloom_hash_get --
  *	Tests whether the key (as given by its hash signature) is in the Bloom
@@ -267,6 +521,9 @@ __wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash)
 	/* Get operations are only supported by finalized bloom filters. */
 	WT_ASSERT(bloom->session, bloom->bitstring == NULL);
 
+	if (F_ISSET(bloom, WT_BLOOM_BLOCKED))
+		return (__bloom_blocks_get(bloom, bhash));
+
 	/* Create a cursor on the first time through. */
 	WT_ERR(__bloom_open_cursor(bloom, NULL));
 	c = bloom->c;
@@ -0,0 +1,264 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Each file keeps an approximate list of the keys on which transactions have
+ * failed with update conflicts, so applications can find their "hot" keys.
+ *
+ * The list is a "space-saving" sketch: while there are free slots, each new
+ * key gets a slot; once the slots are full, a new key replaces the key with
+ * the fewest conflicts, inheriting its count, which bounds how far the new
+ * key's count can be over-estimated.  Any key with more conflicts than the
+ * total divided by the number of slots is guaranteed to be in the list.
+ */
+
+/*
+ * __conflict_free --
+ *	Discard a file's conflict keys.
+ */
+static void
+__conflict_free(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+	u_int i;
+
+	for (i = 0; i < btree->conflict_slots; ++i)
+		__wt_buf_free(session, &btree->conflict_keys[i].key);
+	__wt_free(session, btree->conflict_keys);
+	btree->conflict_slots = btree->conflict_entries = 0;
+}
+
+/*
+ * __wt_conflict_config --
+ *	Configure update conflict tracking.
+ */
+int
+__wt_conflict_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	u_int keys;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(
+	    session, cfg, "statistics_conflicts.enabled", &cval));
+	keys = 0;
+	if (cval.val != 0) {
+		WT_RET(__wt_config_gets(
+		    session, cfg, "statistics_conflicts.keys", &cval));
+		keys = (u_int)cval.val;
+	}
+	WT_RET(__wt_config_gets(
+	    session, cfg, "statistics_conflicts.sample", &cval));
+	conn->conflict_sample = (u_int)cval.val;
+
+	/* Files resize their list of keys the next time they're updated. */
+	conn->conflict_keys = keys;
+	return (0);
+}
+
+/*
+ * __wt_conflict_destroy --
+ *	Discard a file's conflict tracking.
+ */
+void
+__wt_conflict_destroy(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+	__conflict_free(session, btree);
+	__wt_spin_destroy(session, &btree->conflict_lock);
+}
+
+/*
+ * __wt_conflict_record --
+ *	Record an update conflict on a cursor's key.
+ */
+int
+__wt_conflict_record(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
+{
+	WT_BTREE *btree;
+	WT_CONFLICT_KEY *ck, *min;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_ITEM *key, recno;
+	u_int i, keys, sample;
+
+	btree = cbt->btree;
+	conn = S2C(session);
+
+	/*
+	 * The transaction flags the conflict: the operation may also have
+	 * failed because the cache is stuck.
+	 */
+	if (!F_ISSET(&session->txn, TXN_UPDATE_CONFLICT))
+		return (0);
+	F_CLR(&session->txn, TXN_UPDATE_CONFLICT);
+
+	if ((keys = conn->conflict_keys) == 0)
+		return (0);
+	sample = conn->conflict_sample;
+	if (sample > 1 && __wt_random(session->rnd) % sample != 0)
+		return (0);
+
+	if (btree->type == BTREE_ROW)
+		key = &cbt->iface.key;
+	else {
+		recno.data = &cbt->iface.recno;
+		recno.size = sizeof(cbt->iface.recno);
+		key = &recno;
+	}
+
+	__wt_spin_lock(session, &btree->conflict_lock);
+
+	/* If the number of keys has been reconfigured, start over. */
+	if (btree->conflict_slots != keys) {
+		__conflict_free(session, btree);
+		WT_ERR(__wt_calloc_def(session, keys, &btree->conflict_keys));
+		btree->conflict_slots = keys;
+	}
+
+	/* Look for the key, remembering the entry with the fewest conflicts. */
+	for (min = NULL, ck = btree->conflict_keys,
+	    i = 0; i < btree->conflict_entries; ++ck, ++i) {
+		if (ck->key.size == key->size &&
+		    memcmp(ck->key.data, key->data, key->size) == 0)
+			break;
+		if (min == NULL || ck->count < min->count)
+			min = ck;
+	}
+
+	/*
+	 * Add a new key to a free slot, or replace the key with the fewest
+	 * conflicts: the new key's count can be over-estimated by that key's
+	 * count.
+	 */
+	if (i == btree->conflict_entries) {
+		if (i < btree->conflict_slots) {
+			ck = &btree->conflict_keys[i];
+			ck->count = ck->error = 0;
+		} else {
+			ck = min;
+			ck->error = ck->count;
+		}
+		WT_ERR(__wt_buf_set(session, &ck->key, key->data, key->size));
+		if (i < btree->conflict_slots)
+			++btree->conflict_entries;
+	}
+	ck->count += sample;
+
+err:	__wt_spin_unlock(session, &btree->conflict_lock);
+	return (ret);
+}
+
+/*
+ * __conflict_cmp --
+ *	Qsort function: sort conflict keys by decreasing count.
+ */
+static int
+__conflict_cmp(const void *a, const void *b)
+{
+	const WT_CONFLICT_KEY *ak, *bk;
+
+	ak = a;
+	bk = b;
+	return (ak->count == bk->count ? 0 : (ak->count < bk->count ? 1 : -1));
+}
+
+/*
+ * __wt_conflict_stat_init --
+ *	Append a file's conflict keys to a statistics cursor, in decreasing
+ * order of conflicts.
+ */
+int
+__wt_conflict_stat_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
+{
+	WT_BTREE *btree;
+	WT_CONFLICT_KEY *ck, *keys;
+	WT_DECL_ITEM(buf);
+	WT_DECL_ITEM(desc);
+	WT_DECL_RET;
+	WT_STATS *stats;
+	size_t size;
+	u_int entries, i;
+	char *p;
+
+	btree = S2BT(session);
+	keys = NULL;
+	entries = 0;
+
+	if (btree->conflict_entries == 0)
+		return (0);
+
+	/* Copy the keys so we don't hold the lock while formatting them. */
+	__wt_spin_lock(session, &btree->conflict_lock);
+	if ((entries = btree->conflict_entries) != 0 &&
+	    (ret = __wt_calloc_def(session, entries, &keys)) == 0)
+		for (i = 0; i < entries; ++i) {
+			keys[i].count = btree->conflict_keys[i].count;
+			keys[i].error = btree->conflict_keys[i].error;
+			if ((ret = __wt_buf_set(session, &keys[i].key,
+			    btree->conflict_keys[i].key.data,
+			    btree->conflict_keys[i].key.size)) != 0)
+				break;
+		}
+	if (ret == 0 && F_ISSET(cst, WT_CONN_STAT_CLEAR))
+		btree->conflict_entries = 0;
+	__wt_spin_unlock(session, &btree->conflict_lock);
+	WT_ERR(ret);
+	if (entries == 0)
+		goto err;
+
+	qsort(keys, entries, sizeof(WT_CONFLICT_KEY), __conflict_cmp);
+
+	/*
+	 * The cursor owns a copy of the data-source statistics followed by
+	 * the conflict keys.
+	 */
+	WT_ERR(__wt_calloc_def(session,
+	    (size_t)cst->stats_count + entries, &cst->conflict_stats));
+	memcpy(cst->conflict_stats, cst->stats_first,
+	    (size_t)cst->stats_count * sizeof(WT_STATS));
+	cst->stats_first = cst->conflict_stats;
+	cst->conflict_first = cst->stats_count;
+
+	WT_ERR(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_scr_alloc(session, 0, &desc));
+	for (ck = keys, i = 0; i < entries; ++ck, ++i) {
+		if (btree->type == BTREE_ROW) {
+			/* Don't display the nul terminating string keys. */
+			size = ck->key.size;
+			if (size > 0 && WT_STREQ(btree->key_format, "S") &&
+			    ((const char *)ck->key.data)[size - 1] == '\0')
+				--size;
+			WT_ERR(__wt_raw_to_esc_hex(
+			    session, ck->key.data, size, buf));
+		} else
+			WT_ERR(__wt_buf_fmt(session, buf,
+			    "%" PRIu64, *(uint64_t *)ck->key.data));
+		WT_ERR(__wt_buf_fmt(session, desc,
+		    "transaction: update conflicts on key \"%s\" "
+		    "(over-estimated by at most %" PRIu64 ")",
+		    (const char *)buf->data, ck->error));
+
+		stats = &cst->conflict_stats[cst->stats_count];
+		WT_ERR(__wt_strndup(session, desc->data, desc->size, &p));
+		stats->desc = p;
+		stats->v = ck->count;
+		++cst->stats_count;
+	}
+
+err:	if (keys != NULL) {
+		for (i = 0; i < entries; ++i)
+			__wt_buf_free(session, &keys[i].key);
+		__wt_free(session, keys);
+	}
+	__wt_scr_free(session, &buf);
+	__wt_scr_free(session, &desc);
+	return (ret);
+}
@@ -290,9 +290,7 @@ new_insert:	if ((ins = cbt->ins) != NULL) {
 			}
 			key->data = WT_INSERT_KEY(ins);
 			key->size = WT_INSERT_KEY_SIZE(ins);
-			val->data = WT_UPDATE_DATA(upd);
-			val->size = upd->size;
-			return (0);
+			return (__wt_update_value(session, upd, val));
 		}
 
 		/* Check for the end of the page. */
@@ -261,8 +261,9 @@ static inline int
 __cursor_row_modify(
     WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 {
-	return (__wt_row_modify(session,
-	    cbt, &cbt->iface.key, &cbt->iface.value, NULL, is_remove));
+	return (__wt_row_modify(session, cbt, &cbt->iface.key,
+	    &cbt->iface.value, NULL,
+	    is_remove ? WT_UPDATE_DELETED : WT_UPDATE_STANDARD));
 }
 
 /*
@@ -497,6 +498,8 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 
 err:	if (ret == WT_RESTART)
 		goto retry;
+	if (ret == WT_ROLLBACK)
+		WT_TRET(__wt_conflict_record(session, cbt));
 	/* Insert doesn't maintain a position across calls, clear resources. */
 	if (ret == 0)
 		WT_TRET(__curfile_leave(cbt));
@@ -572,6 +575,8 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 
 err:	if (ret == WT_RESTART)
 		goto retry;
+	if (ret == WT_ROLLBACK)
+		WT_TRET(__wt_conflict_record(session, cbt));
 	WT_TRET(__curfile_leave(cbt));
 	if (ret != 0)
 		WT_TRET(__cursor_reset(cbt));
@@ -650,6 +655,8 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 
 err:	if (ret == WT_RESTART)
 		goto retry;
+	if (ret == WT_ROLLBACK)
+		WT_TRET(__wt_conflict_record(session, cbt));
 	/*
 	 * If the cursor is configured to overwrite and the record is not
 	 * found, that is exactly what we want.
@@ -738,6 +745,8 @@ retry:	WT_RET(__cursor_func_init(cbt, 1));
 
 err:	if (ret == WT_RESTART)
 		goto retry;
+	if (ret == WT_ROLLBACK)
+		WT_TRET(__wt_conflict_record(session, cbt));
 
 	/*
 	 * If successful, point the cursor at internal copies of the data.  We
@@ -755,6 +764,99 @@ err:	if (ret == WT_RESTART)
 	return (ret);
 }
 
+/*
+ * __wt_btcur_modify --
+ *	Modify a record in the tree.
+ */
+int
+__wt_btcur_modify(WT_CURSOR_BTREE *cbt, WT_MODIFY *entries, int nentries)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(modify);
+	WT_DECL_ITEM(value);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	WT_UPDATE *upd;
+	u_int count;
+	int delta;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	WT_STAT_FAST_CONN_INCR(session, cursor_modify);
+	WT_STAT_FAST_DATA_INCR(session, cursor_modify);
+
+	/* Only row-store values can be stored as lists of modifications. */
+	if (btree->type != BTREE_ROW)
+		WT_RET(ENOTSUP);
+	WT_RET(__cursor_size_chk(session, &cursor->key));
+
+	WT_RET(__wt_modify_pack(session, &modify, entries, nentries));
+	WT_STAT_FAST_DATA_INCRV(session, cursor_modify_bytes, modify->size);
+	WT_ERR(__wt_scr_alloc(session, 0, &value));
+
+retry:	WT_ERR(__cursor_func_init(cbt, 1));
+
+	WT_ERR(__cursor_row_search(session, cbt, 1));
+
+	/* Check for conflicts and fail if the key does not exist. */
+	WT_ERR(__curfile_update_check(cbt));
+	if (cbt->compare != 0 || !__cursor_valid(cbt, &upd))
+		WT_ERR(WT_NOTFOUND);
+
+	/* Build the new value. */
+	WT_ERR(__wt_kv_return(session, cbt, upd));
+	WT_ERR(__wt_buf_set(
+	    session, value, cursor->value.data, cursor->value.size));
+	WT_ERR(__wt_modify_apply(session, value, modify->data, modify->size));
+	WT_ERR(__cursor_size_chk(session, value));
+
+	/*
+	 * Store the modifications rather than the new value if the update list
+	 * holds the value they're applied to (there's no update with a value
+	 * that must be read from the page), the list doesn't already hold the
+	 * maximum number of modifications in a row, and there's a useful space
+	 * saving.  The update check guarantees the visible update is the first
+	 * committed update in the list, which is the one we're modifying.
+	 */
+	delta = 0;
+	if (upd != NULL && modify->size * 2 < value->size) {
+		for (count = 0; upd != NULL; upd = upd->next) {
+			if (upd->txnid == WT_TXN_ABORTED)
+				continue;
+			if (!WT_UPDATE_MODIFIED_ISSET(upd))
+				break;
+			++count;
+		}
+		delta = upd != NULL && count < WT_MODIFY_UPDATE_MAX;
+	}
+	if (delta) {
+		WT_STAT_FAST_CONN_INCR(session, cursor_modify_delta);
+		ret = __wt_row_modify(session, cbt,
+		    &cursor->key, modify, NULL, WT_UPDATE_MODIFIED);
+	} else
+		ret = __wt_row_modify(session, cbt,
+		    &cursor->key, value, NULL, WT_UPDATE_STANDARD);
+
+err:	if (ret == WT_RESTART)
+		goto retry;
+	if (ret == WT_ROLLBACK)
+		WT_TRET(__wt_conflict_record(session, cbt));
+
+	/* If successful, return the new value, as for WT_CURSOR.update. */
+	if (ret == 0)
+		WT_TRET(__wt_kv_return(session, cbt, cbt->modify_update));
+
+	if (ret != 0)
+		WT_TRET(__cursor_reset(cbt));
+
+	__wt_scr_free(session, &modify);
+	__wt_scr_free(session, &value);
+	return (ret);
+}
+
 /*
  * __wt_btcur_next_random --
  *	Move to a random record in the tree.
@@ -910,7 +910,10 @@ __debug_update(WT_DBG *ds, WT_UPDATE *upd, int hexbyte)
 			__debug_hex_byte(ds,
 			    ((uint8_t *)WT_UPDATE_DATA(upd))[0]);
 			__dmsg(ds, "}\n");
-		} else
+		} else if (WT_UPDATE_MODIFIED_ISSET(upd))
+			__debug_item(ds,
+			    "modify", WT_UPDATE_DATA(upd), upd->size);
+		else
 			__debug_item(ds,
 			    "value", WT_UPDATE_DATA(upd), upd->size);
 }
@@ -264,6 +264,7 @@ __wt_delete_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
 	WT_PAGE *page;
 	WT_PAGE_DELETED *page_del;
 	WT_UPDATE **upd_array, *upd;
+	size_t size, upd_size;
 	uint32_t i;
 
 	btree = S2BT(session);
@@ -323,9 +324,10 @@ __wt_delete_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
 	 * structures, fill in the per-page update array with references to
 	 * deleted items.
 	 */
+	size = page->pg_row_entries * sizeof(WT_UPDATE *);
 	for (i = 0; i < page->pg_row_entries; ++i) {
-		WT_ERR(__wt_calloc_one(session, &upd));
-		WT_UPDATE_DELETED_SET(upd);
+		WT_ERR(__wt_update_alloc(session, page, NULL, &upd, &upd_size));
+		size += upd_size;
 
 		if (page_del == NULL)
 			upd->txnid = WT_TXN_NONE;	/* Globally visible */
@@ -338,8 +340,7 @@ __wt_delete_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
 		upd_array[i] = upd;
 	}
 
-	__wt_cache_page_inmem_incr(session, page,
-	    page->pg_row_entries * (sizeof(WT_UPDATE *) + sizeof(WT_UPDATE)));
+	__wt_cache_page_inmem_incr(session, page, size);
 
 	return (0);
 
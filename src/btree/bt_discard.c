@@ -8,13 +8,14 @@
 
 #include "wt_internal.h"
 
-static void __free_page_modify(WT_SESSION_IMPL *, WT_PAGE *);
+static void __free_page_modify(WT_SESSION_IMPL *, WT_PAGE *, int, int);
 static void __free_page_col_var(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_int(WT_SESSION_IMPL *, WT_PAGE *);
-static void __free_page_row_leaf(WT_SESSION_IMPL *, WT_PAGE *);
-static void __free_skip_array(WT_SESSION_IMPL *, WT_INSERT_HEAD **, uint32_t);
-static void __free_skip_list(WT_SESSION_IMPL *, WT_INSERT *);
-static void __free_update(WT_SESSION_IMPL *, WT_UPDATE **, uint32_t);
+static void __free_page_row_leaf(WT_SESSION_IMPL *, WT_PAGE *, int, int);
+static void __free_skip_array(
+    WT_SESSION_IMPL *, WT_INSERT_HEAD **, uint32_t, int, int);
+static void __free_skip_list(WT_SESSION_IMPL *, WT_INSERT *, int);
+static void __free_update(WT_SESSION_IMPL *, WT_UPDATE **, uint32_t, int);
 static void __free_update_list(WT_SESSION_IMPL *, WT_UPDATE *);
 
 /*
@@ -43,6 +44,7 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
 	WT_PAGE *page;
 	WT_PAGE_HEADER *dsk;
 	WT_PAGE_MODIFY *mod;
+	int free_updates, in_arena;
 
 	/*
 	 * Kill our caller's reference, do our best to catch races.
@@ -105,9 +107,15 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
 	if (F_ISSET(S2C(session), WT_CONN_LEAK_MEMORY))
 		return;
 
-	/* Free the page modification information. */
-	if (page->modify != NULL)
-		__free_page_modify(session, page);
+	/*
+	 * Inserts and updates allocated from the page's arena are freed with
+	 * the arena, not individually.  Updates of existing keys are allocated
+	 * from the heap, so if the arena has any, the page's update lists are
+	 * still walked to free them.  The arena is released with the page
+	 * modification information, after the lists have been walked.
+	 */
+	in_arena = page->modify != NULL && page->modify->arena != NULL;
+	free_updates = !in_arena || page->modify->arena->heap_updates;
 
 	switch (page->type) {
 	case WT_PAGE_COL_FIX:
@@ -120,10 +128,14 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
 		__free_page_col_var(session, page);
 		break;
 	case WT_PAGE_ROW_LEAF:
-		__free_page_row_leaf(session, page);
+		__free_page_row_leaf(session, page, in_arena, free_updates);
 		break;
 	}
 
+	/* Free the page modification information. */
+	if (page->modify != NULL)
+		__free_page_modify(session, page, in_arena, free_updates);
+
 	/* Discard any disk image. */
 	dsk = (WT_PAGE_HEADER *)page->dsk;
 	if (F_ISSET_ATOMIC(page, WT_PAGE_DISK_ALLOC))
@@ -139,7 +151,8 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
  *	Discard the page's associated modification structures.
  */
 static void
-__free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
+__free_page_modify(
+    WT_SESSION_IMPL *session, WT_PAGE *page, int in_arena, int free_updates)
 {
 	WT_INSERT_HEAD *append;
 	WT_MULTI *multi;
@@ -179,7 +192,9 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
 	case WT_PAGE_COL_VAR:
 		/* Free the append array. */
 		if ((append = WT_COL_APPEND(page)) != NULL) {
-			__free_skip_list(session, WT_SKIP_FIRST(append));
+			if (free_updates)
+				__free_skip_list(
+				    session, WT_SKIP_FIRST(append), in_arena);
 			__wt_free(session, append);
 			__wt_free(session, mod->mod_append);
 		}
@@ -187,8 +202,8 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
 		/* Free the insert/update array. */
 		if (mod->mod_update != NULL)
 			__free_skip_array(session, mod->mod_update,
-			    page->type ==
-			    WT_PAGE_COL_FIX ? 1 : page->pg_var_entries);
+			    page->type == WT_PAGE_COL_FIX ?
+			    1 : page->pg_var_entries, in_arena, free_updates);
 		break;
 	}
 
@@ -199,6 +214,8 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	__wt_free(session, page->modify->ovfl_track);
 
+	__wt_page_arena_release(session, page->modify);
+
 	__wt_free(session, page->modify);
 }
 
@@ -299,7 +316,8 @@ __free_page_col_var(WT_SESSION_IMPL *session, WT_PAGE *page)
  *	Discard a WT_PAGE_ROW_LEAF page.
  */
 static void
-__free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
+__free_page_row_leaf(
+    WT_SESSION_IMPL *session, WT_PAGE *page, int in_arena, int free_updates)
 {
 	WT_IKEY *ikey;
 	WT_ROW *rip;
@@ -329,12 +347,13 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 * found on the original page).
 	 */
 	if (page->pg_row_ins != NULL)
-		__free_skip_array(
-		    session, page->pg_row_ins, page->pg_row_entries + 1);
+		__free_skip_array(session, page->pg_row_ins,
+		    page->pg_row_entries + 1, in_arena, free_updates);
 
 	/* Free the update array. */
 	if (page->pg_row_upd != NULL)
-		__free_update(session, page->pg_row_upd, page->pg_row_entries);
+		__free_update(session,
+		    page->pg_row_upd, page->pg_row_entries, free_updates);
 }
 
 /*
@@ -342,18 +361,21 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
  *	Discard an array of skip list headers.
  */
 static void
-__free_skip_array(
-    WT_SESSION_IMPL *session, WT_INSERT_HEAD **head_arg, uint32_t entries)
+__free_skip_array(WT_SESSION_IMPL *session, WT_INSERT_HEAD **head_arg,
+    uint32_t entries, int in_arena, int free_updates)
 {
 	WT_INSERT_HEAD **head;
 
 	/*
 	 * For each non-NULL slot in the page's array of inserts, free the
-	 * linked list anchored in that slot.
+	 * linked list anchored in that slot, unless the list and all of its
+	 * updates were allocated from the page's arena.
 	 */
 	for (head = head_arg; entries > 0; --entries, ++head)
 		if (*head != NULL) {
-			__free_skip_list(session, WT_SKIP_FIRST(*head));
+			if (free_updates)
+				__free_skip_list(
+				    session, WT_SKIP_FIRST(*head), in_arena);
 			__wt_free(session, *head);
 		}
 
@@ -365,16 +387,18 @@ __free_skip_array(
  * __free_skip_list --
  *	Walk a WT_INSERT forward-linked list and free the per-thread combination
  * of a WT_INSERT structure and its associated chain of WT_UPDATE structures.
+ * WT_INSERT structures allocated from the page's arena are freed with it.
  */
 static void
-__free_skip_list(WT_SESSION_IMPL *session, WT_INSERT *ins)
+__free_skip_list(WT_SESSION_IMPL *session, WT_INSERT *ins, int in_arena)
 {
 	WT_INSERT *next;
 
 	for (; ins != NULL; ins = next) {
 		__free_update_list(session, ins->upd);
 		next = WT_SKIP_NEXT(ins);
-		__wt_free(session, ins);
+		if (!in_arena)
+			__wt_free(session, ins);
 	}
 }
 
@@ -383,18 +407,20 @@ __free_skip_list(WT_SESSION_IMPL *session, WT_INSERT *ins)
  *	Discard the update array.
  */
 static void
-__free_update(
-    WT_SESSION_IMPL *session, WT_UPDATE **update_head, uint32_t entries)
+__free_update(WT_SESSION_IMPL *session,
+    WT_UPDATE **update_head, uint32_t entries, int free_updates)
 {
 	WT_UPDATE **updp;
 
 	/*
 	 * For each non-NULL slot in the page's array of updates, free the
-	 * linked list anchored in that slot.
+	 * linked list anchored in that slot, unless the list was allocated
+	 * from the page's arena.
 	 */
-	for (updp = update_head; entries > 0; --entries, ++updp)
-		if (*updp != NULL)
-			__free_update_list(session, *updp);
+	if (free_updates)
+		for (updp = update_head; entries > 0; --entries, ++updp)
+			if (*updp != NULL)
+				__free_update_list(session, *updp);
 
 	/* Free the update array. */
 	__wt_free(session, update_head);
@@ -403,7 +429,8 @@ __free_update(
 /*
  * __free_update_list --
  *	Walk a WT_UPDATE forward-linked list and free the per-thread combination
- *	of a WT_UPDATE structure and its associated data.
+ *	of a WT_UPDATE structure and its associated data.  Updates allocated
+ *	from the page's arena are freed with it.
  */
 static void
 __free_update_list(WT_SESSION_IMPL *session, WT_UPDATE *upd)
@@ -418,6 +445,7 @@ __free_update_list(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 		    __wt_txn_visible_all(session, upd->txnid));
 
 		next = upd->next;
-		__wt_free(session, upd);
+		if (!F_ISSET(upd, WT_UPDATE_ARENA))
+			__wt_free(session, upd);
 	}
 }
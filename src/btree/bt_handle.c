@@ -158,6 +158,7 @@ __wt_btree_close(WT_SESSION_IMPL *session)
 	/* Destroy locks. */
 	WT_TRET(__wt_rwlock_destroy(session, &btree->ovfl_lock));
 	__wt_spin_destroy(session, &btree->flush_lock);
+	__wt_conflict_destroy(session, btree);
 
 	/* Free allocated memory. */
 	__wt_free(session, btree->key_format);
@@ -265,6 +266,10 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 			F_CLR(btree, WT_BTREE_NO_EVICTION);
 	}
 
+	/* Lookaside table updates don't allocate transaction IDs. */
+	if (strcmp(btree->dhandle->name, WT_LAS_URI) == 0)
+		F_SET(btree, WT_BTREE_LOOKASIDE);
+
 	/* Checksums */
 	WT_RET(__wt_config_gets(session, cfg, "checksum", &cval));
 	if (WT_STRING_MATCH("on", cval.str, cval.len))
@@ -323,6 +328,8 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 	WT_RET(__wt_rwlock_alloc(
 	    session, &btree->ovfl_lock, "btree overflow lock"));
 	WT_RET(__wt_spin_init(session, &btree->flush_lock, "btree flush lock"));
+	WT_RET(__wt_spin_init(
+	    session, &btree->conflict_lock, "btree conflict lock"));
 
 	__wt_stat_init_dsrc_stats(&btree->dhandle->stats);
 
@@ -0,0 +1,223 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * A packed modification list is a count of entries followed by that many
+ * entries, each a packed offset, size and data length, followed by the data
+ * bytes.  The same format is stored in WT_UPDATE_MODIFIED updates and written
+ * to the log, so it must not change.
+ */
+
+/*
+ * __modify_data_local --
+ *	Make a value's data local to the buffer, starting at the beginning of
+ * the buffer's memory, with room for at least size bytes.
+ */
+static inline int
+__modify_data_local(WT_SESSION_IMPL *session, WT_ITEM *value, size_t size)
+{
+	if (WT_DATA_IN_ITEM(value) && value->data != value->mem) {
+		memmove(value->mem, value->data, value->size);
+		value->data = value->mem;
+	}
+	return (__wt_buf_grow(session, value, WT_MAX(size, value->size)));
+}
+
+/*
+ * __modify_apply_one --
+ *	Apply a single modification to a value.
+ */
+static int
+__modify_apply_one(WT_SESSION_IMPL *session, WT_ITEM *value,
+    size_t offset, size_t size, const uint8_t *data, size_t data_size)
+{
+	size_t len, tail;
+	uint8_t *p;
+
+	/*
+	 * A modification starting past the end of the value pads the value
+	 * with nul bytes, and there's nothing to replace.
+	 */
+	if (offset > value->size) {
+		WT_RET(__modify_data_local(session, value, offset + data_size));
+		memset((uint8_t *)value->mem + value->size,
+		    0, offset - value->size);
+		value->size = offset;
+		size = 0;
+	}
+
+	/*
+	 * Replace up to size bytes at the offset (stopping at the end of the
+	 * value), shifting any trailing bytes to follow the new data.
+	 */
+	len = WT_MIN(size, value->size - offset);
+	tail = value->size - (offset + len);
+	WT_RET(__modify_data_local(session, value, offset + data_size + tail));
+
+	p = value->mem;
+	if (tail != 0 && data_size != len)
+		memmove(p + offset + data_size, p + offset + len, tail);
+	if (data_size != 0)
+		memcpy(p + offset, data, data_size);
+	value->size = offset + data_size + tail;
+	return (0);
+}
+
+/*
+ * __wt_modify_pack --
+ *	Pack a list of WT_MODIFY structures into a scratch buffer.
+ */
+int
+__wt_modify_pack(WT_SESSION_IMPL *session,
+    WT_ITEM **modifyp, WT_MODIFY *entries, int nentries)
+{
+	WT_DECL_ITEM(modify);
+	WT_DECL_RET;
+	size_t len;
+	uint8_t *p, *end;
+	int i;
+
+	*modifyp = NULL;
+
+	/* Figure out how much space we need. */
+	len = WT_INTPACK32_MAXSIZE;
+	for (i = 0; i < nentries; ++i)
+		len += 3 * WT_INTPACK64_MAXSIZE + entries[i].data.size;
+
+	WT_RET(__wt_scr_alloc(session, len, &modify));
+	p = modify->mem;
+	end = p + len;
+
+	WT_ERR(__wt_vpack_uint(&p, WT_PTRDIFF(end, p), (uint64_t)nentries));
+	for (i = 0; i < nentries; ++i) {
+		WT_ERR(__wt_vpack_uint(
+		    &p, WT_PTRDIFF(end, p), (uint64_t)entries[i].offset));
+		WT_ERR(__wt_vpack_uint(
+		    &p, WT_PTRDIFF(end, p), (uint64_t)entries[i].size));
+		WT_ERR(__wt_vpack_uint(
+		    &p, WT_PTRDIFF(end, p), (uint64_t)entries[i].data.size));
+		if (entries[i].data.size != 0) {
+			memcpy(p, entries[i].data.data, entries[i].data.size);
+			p += entries[i].data.size;
+		}
+	}
+	modify->size = WT_PTRDIFF(p, modify->mem);
+
+	*modifyp = modify;
+	return (0);
+
+err:	__wt_scr_free(session, &modify);
+	return (ret);
+}
+
+/*
+ * __wt_modify_apply --
+ *	Apply a packed list of modifications to a value.
+ */
+int
+__wt_modify_apply(WT_SESSION_IMPL *session,
+    WT_ITEM *value, const void *modify, size_t modify_size)
+{
+	uint64_t data_size, nentries, offset, size;
+	const uint8_t *p, *end;
+
+	p = modify;
+	end = p + modify_size;
+
+	WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &nentries));
+	for (; nentries > 0; --nentries) {
+		WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &offset));
+		WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &size));
+		WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &data_size));
+		if (data_size > (uint64_t)WT_PTRDIFF(end, p))
+			WT_RET_MSG(session, WT_ERROR,
+			    "corrupted modification list");
+
+		WT_RET(__modify_apply_one(session, value, (size_t)offset,
+		    (size_t)size, p, (size_t)data_size));
+		p += data_size;
+	}
+	return (0);
+}
+
+/*
+ * __wt_modify_idempotent --
+ *	Return if a packed list of modifications has the same result when it is
+ * applied more than once: every modification replaces as many bytes as it
+ * inserts, so applying the list only overwrites bytes with fixed data.
+ */
+int
+__wt_modify_idempotent(const void *modify, size_t modify_size)
+{
+	uint64_t data_size, nentries, offset, size;
+	const uint8_t *p, *end;
+
+	p = modify;
+	end = p + modify_size;
+
+	if (__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &nentries) != 0)
+		return (0);
+	for (; nentries > 0; --nentries) {
+		if (__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &offset) != 0 ||
+		    __wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &size) != 0 ||
+		    __wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &data_size) != 0)
+			return (0);
+		if (size != data_size ||
+		    data_size > (uint64_t)WT_PTRDIFF(end, p))
+			return (0);
+		p += data_size;
+	}
+	return (1);
+}
+
+/*
+ * __wt_modify_value --
+ *	Build the value of a modified update.
+ */
+int
+__wt_modify_value(WT_SESSION_IMPL *session, WT_UPDATE *upd, WT_ITEM *value)
+{
+	WT_UPDATE *list[WT_MODIFY_UPDATE_MAX];
+	u_int i;
+
+	/*
+	 * Walk the update list to the newest complete value, skipping aborted
+	 * updates and saving the modified updates on the way; there's a limit
+	 * on how many modified updates are stacked on a complete value.
+	 */
+	for (i = 0; upd != NULL; upd = upd->next) {
+		if (upd->txnid == WT_TXN_ABORTED)
+			continue;
+		if (!WT_UPDATE_MODIFIED_ISSET(upd))
+			break;
+		if (i == WT_MODIFY_UPDATE_MAX)
+			WT_RET_MSG(session, WT_ERROR,
+			    "modified update list exceeds the maximum length");
+		list[i++] = upd;
+	}
+	if (upd == NULL)
+		WT_RET_MSG(session, WT_ERROR,
+		    "modified update has no complete value");
+
+	/* A deleted value is an empty starting point. */
+	if (WT_UPDATE_DELETED_ISSET(upd))
+		WT_RET(__wt_buf_set(session, value, "", 0));
+	else
+		WT_RET(__wt_buf_set(
+		    session, value, WT_UPDATE_DATA(upd), upd->size));
+
+	/* Apply the modifications, oldest first. */
+	while (i > 0) {
+		upd = list[--i];
+		WT_RET(__wt_modify_apply(
+		    session, value, WT_UPDATE_DATA(upd), upd->size));
+	}
+	return (0);
+}
@@ -8,6 +8,141 @@
 
 #include "wt_internal.h"
 
+/*
+ * __las_page_instantiate --
+ *	Instantiate the lookaside table records for a page read from a block.
+ */
+static int
+__las_page_instantiate(WT_SESSION_IMPL *session,
+    WT_REF *ref, const uint8_t *addr, size_t addr_size)
+{
+	WT_CURSOR *cursor;
+	WT_CURSOR_BTREE cbt;
+	WT_DECL_ITEM(current_key);
+	WT_DECL_RET;
+	WT_ITEM las_addr, las_key, las_value;
+	WT_PAGE *page;
+	WT_UPDATE *first_upd, *last_upd, *upd;
+	size_t notused;
+	uint64_t block_txn, las_counter, las_txnid, max_txn;
+	uint32_t btree_id, las_id;
+	uint8_t upd_type;
+	int exact;
+
+	cursor = NULL;
+	page = ref->page;
+	first_upd = last_upd = upd = NULL;
+	max_txn = WT_TXN_NONE;
+	btree_id = S2BT(session)->id;
+
+	WT_CLEAR(cbt);
+	cbt.iface.session = &session->iface;
+	cbt.btree = S2BT(session);
+
+	__wt_las_cursor(session, &cursor);
+	if (cursor == NULL)
+		return (0);
+
+	WT_ERR(__wt_scr_alloc(session, 0, &current_key));
+
+	/*
+	 * The block's records are stored in the order they were written: each
+	 * key's update list, newest update first.  Build an update list for
+	 * each key and apply it to the page.
+	 */
+	las_addr.data = addr;
+	las_addr.size = addr_size;
+	cursor->set_key(cursor, btree_id, &las_addr, (uint64_t)0);
+	if ((ret = cursor->search_near(cursor, &exact)) == 0 && exact < 0)
+		ret = cursor->next(cursor);
+	for (; ret == 0; ret = cursor->next(cursor)) {
+		WT_ERR(cursor->get_key(
+		    cursor, &las_id, &las_addr, &las_counter));
+		if (las_id != btree_id || las_addr.size != addr_size ||
+		    memcmp(las_addr.data, addr, addr_size) != 0)
+			break;
+		WT_ERR(cursor->get_value(cursor, &block_txn,
+		    &las_txnid, &upd_type, &las_key, &las_value));
+
+		/* If this is a new key, apply the previous key's list. */
+		if (first_upd != NULL &&
+		    (current_key->size != las_key.size || memcmp(
+		    current_key->data, las_key.data, las_key.size) != 0)) {
+			WT_ERR(__wt_row_search(
+			    session, current_key, ref, &cbt, 1));
+			upd = first_upd;
+			first_upd = last_upd = NULL;
+			WT_ERR(__wt_row_modify(session,
+			    &cbt, current_key, NULL, upd, WT_UPDATE_STANDARD));
+		}
+		if (first_upd == NULL)
+			WT_ERR(__wt_buf_set(session,
+			    current_key, las_key.data, las_key.size));
+
+		WT_ERR(__wt_update_alloc(session, page,
+		    upd_type == WT_UPDATE_DELETED ? NULL : &las_value,
+		    &upd, &notused));
+		upd->txnid = las_txnid;
+		upd->type = upd_type;
+		if (TXNID_LT(max_txn, las_txnid))
+			max_txn = las_txnid;
+
+		if (first_upd == NULL)
+			first_upd = last_upd = upd;
+		else {
+			last_upd->next = upd;
+			last_upd = upd;
+		}
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+	/* Apply the last key's list. */
+	if (first_upd != NULL) {
+		WT_ERR(__wt_row_search(session, current_key, ref, &cbt, 1));
+		upd = first_upd;
+		first_upd = last_upd = NULL;
+		WT_ERR(__wt_row_modify(session,
+		    &cbt, current_key, NULL, upd, WT_UPDATE_STANDARD));
+
+		/*
+		 * We modified the page above, which will have set the first
+		 * dirty transaction to the last transaction currently running,
+		 * but the updates may be older than that: set it to an
+		 * impossibly old value so this page is never skipped in a
+		 * checkpoint.  Track the newest update on the page so it isn't
+		 * evicted before running transactions are done with it.
+		 */
+		page->modify->first_dirty_txn = WT_TXN_FIRST;
+		if (TXNID_LT(page->modify->update_txn, max_txn))
+			page->modify->update_txn = max_txn;
+
+		/* The records are in memory, discard them. */
+		WT_ERR(__wt_las_remove_block(
+		    session, cursor, btree_id, addr, addr_size));
+
+		WT_STAT_FAST_CONN_INCR(session, cache_read_lookaside);
+		WT_STAT_FAST_DATA_INCR(session, cache_read_lookaside);
+	}
+
+err:	WT_TRET(__wt_las_cursor_close(session, &cursor));
+
+	/*
+	 * Free any resources cached in the cursor: we don't hold a hazard
+	 * pointer on the page being read, clear the cursor's reference first.
+	 */
+	cbt.ref = NULL;
+	WT_TRET(__wt_btcur_close(&cbt));
+
+	/* Free any update list we didn't apply. */
+	for (; first_upd != NULL; first_upd = upd) {
+		upd = first_upd->next;
+		__wt_update_free(session, first_upd);
+	}
+
+	__wt_scr_free(session, &current_key);
+	return (ret);
+}
+
 /*
  * __wt_cache_read --
  *	Read a page from the file.
@@ -69,6 +204,21 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_REF *ref)
 		/* If the page was deleted, instantiate that information. */
 		if (previous_state == WT_REF_DELETED)
 			WT_ERR(__wt_delete_page_instantiate(session, ref));
+
+		/*
+		 * If the page was written with old versions of its records in
+		 * the lookaside table, instantiate them.  Checkpoint handles
+		 * and special handles don't read the lookaside table, the
+		 * table itself never has lookaside records.
+		 */
+		if (previous_state == WT_REF_DISK &&
+		    S2C(session)->las_entries != 0 &&
+		    page->type == WT_PAGE_ROW_LEAF &&
+		    session->dhandle->checkpoint == NULL &&
+		    !F_ISSET(S2BT(session),
+		    WT_BTREE_LOOKASIDE | WT_BTREE_SPECIAL_FLAGS))
+			WT_ERR(__las_page_instantiate(
+			    session, ref, addr, addr_size));
 	}
 
 	WT_ERR(__wt_verbose(session, WT_VERB_READ,
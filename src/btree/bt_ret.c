@@ -86,11 +86,9 @@ __wt_kv_return(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_UPDATE *upd)
 			    session, page, rip, &cursor->key, 0));
 
 		/* If the cursor references a WT_UPDATE item, return it. */
-		if (upd != NULL) {
-			cursor->value.data = WT_UPDATE_DATA(upd);
-			cursor->value.size = upd->size;
-			return (0);
-		}
+		if (upd != NULL)
+			return (__wt_update_value(
+			    session, upd, &cursor->value));
 
 		/* Simple values have their location encoded in the WT_ROW. */
 		if (__wt_row_leaf_value(page, rip, &cursor->value))
@@ -646,6 +646,14 @@ __split_multi_inmem(
 	    session, ref, multi->skip_dsk, WT_PAGE_DISK_ALLOC, &page));
 	multi->skip_dsk = NULL;
 
+	/*
+	 * The updates we're moving were allocated for the original page, the
+	 * new page shares the original page's arena.  The original page is
+	 * discarded after the split, the first new page takes over the charge
+	 * for the arena's blocks.
+	 */
+	WT_RET(__wt_page_arena_share(session, page, orig, 1));
+
 	if (orig->type == WT_PAGE_ROW_LEAF)
 		WT_RET(__wt_scr_alloc(session, 0, &key));
 
@@ -687,8 +695,8 @@ __split_multi_inmem(
 			WT_ERR(__wt_row_search(session, key, ref, &cbt, 1));
 
 			/* Apply the modification. */
-			WT_ERR(
-			    __wt_row_modify(session, &cbt, key, NULL, upd, 0));
+			WT_ERR(__wt_row_modify(session,
+			    &cbt, key, NULL, upd, WT_UPDATE_STANDARD));
 			break;
 		WT_ILLEGAL_VALUE_ERR(session);
 		}
@@ -1208,8 +1216,12 @@ __wt_split_insert(WT_SESSION_IMPL *session, WT_REF *ref, int *splitp)
 		if ((ikey = __wt_ref_key_instantiated(ref)) != NULL)
 			parent_decr += sizeof(WT_IKEY) + ikey->size;
 
-	/* The new page is dirty by definition. */
+	/*
+	 * The new page is dirty by definition; the insert we're moving was
+	 * allocated for the original page, share the original page's arena.
+	 */
 	WT_ERR(__wt_page_modify_init(session, right));
+	WT_ERR(__wt_page_arena_share(session, right, page, 0));
 	__wt_page_modify_set(session, right);
 
 	/*
@@ -1228,8 +1240,10 @@ __wt_split_insert(WT_SESSION_IMPL *session, WT_REF *ref, int *splitp)
 	 */
 	for (i = 0; i < WT_SKIP_MAXDEPTH && ins_head->tail[i] == moved_ins; ++i)
 		;
-	WT_MEM_TRANSFER(page_decr, right_incr, sizeof(WT_INSERT) +
-	    (size_t)i * sizeof(WT_INSERT *) + WT_INSERT_KEY_SIZE(moved_ins));
+	if (right->modify->arena == NULL)
+		WT_MEM_TRANSFER(page_decr, right_incr, sizeof(WT_INSERT) +
+		    (size_t)i * sizeof(WT_INSERT *) +
+		    WT_INSERT_KEY_SIZE(moved_ins));
 	WT_MEM_TRANSFER(
 	    page_decr, right_incr, __wt_update_list_memsize(moved_ins->upd));
 
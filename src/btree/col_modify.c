@@ -8,8 +8,8 @@
 
 #include "wt_internal.h"
 
-static int __col_insert_alloc(
-    WT_SESSION_IMPL *, uint64_t, u_int, WT_INSERT **, size_t *);
+static int __col_insert_alloc(WT_SESSION_IMPL *,
+    WT_PAGE *, uint64_t, u_int, WT_INSERT **, size_t *);
 
 /*
  * __wt_col_modify --
@@ -83,7 +83,8 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 		    session, old_upd = cbt->ins->upd));
 
 		/* Allocate a WT_UPDATE structure and transaction ID. */
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		WT_ERR(__wt_update_alloc(
+		    session, page, value, &upd, &upd_size));
 		WT_ERR(__wt_txn_modify(session, upd));
 		logged = 1;
 
@@ -130,13 +131,13 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 		 * be allocated, the WT_INSERT was allocated).
 		 */
 		WT_ERR(__col_insert_alloc(
-		    session, recno, skipdepth, &ins, &ins_size));
+		    session, page, recno, skipdepth, &ins, &ins_size));
 		cbt->ins_head = ins_head;
 		cbt->ins = ins;
 
 		if (upd == NULL) {
-			WT_ERR(
-			    __wt_update_alloc(session, value, &upd, &upd_size));
+			WT_ERR(__wt_update_alloc(
+			    session, page, value, &upd, &upd_size));
 			WT_ERR(__wt_txn_modify(session, upd));
 			logged = 1;
 
@@ -191,8 +192,8 @@ err:		/*
 		 */
 		if (logged)
 			__wt_txn_unmodify(session);
-		__wt_free(session, ins);
-		__wt_free(session, upd);
+		__wt_page_arena_free(session, page, ins);
+		__wt_update_free(session, upd);
 	}
 
 	return (ret);
@@ -203,7 +204,7 @@ err:		/*
  *	Column-store insert: allocate a WT_INSERT structure and fill it in.
  */
 static int
-__col_insert_alloc(WT_SESSION_IMPL *session,
+__col_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
     uint64_t recno, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep)
 {
 	WT_INSERT *ins;
@@ -214,11 +215,12 @@ __col_insert_alloc(WT_SESSION_IMPL *session,
 	 * the record number into place.
 	 */
 	ins_size = sizeof(WT_INSERT) + skipdepth * sizeof(WT_INSERT *);
-	WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+	WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
 
 	WT_INSERT_RECNO(ins) = recno;
 
+	/* Memory from the page's arena is charged with the arena's blocks. */
 	*insp = ins;
-	*ins_sizep = ins_size;
+	*ins_sizep = page->modify->arena == NULL ? ins_size : 0;
 	return (0);
 }
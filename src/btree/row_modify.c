@@ -15,9 +15,12 @@
 int
 __wt_page_modify_alloc(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
+	WT_BTREE *btree;
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	WT_PAGE_MODIFY *modify;
 
+	btree = S2BT(session);
 	conn = S2C(session);
 
 	WT_RET(__wt_calloc_one(session, &modify));
@@ -28,6 +31,16 @@ __wt_page_modify_alloc(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 */
 	modify->page_lock = ++conn->page_lock_cnt % WT_PAGE_LOCKS(conn);
 
+	/* Leaf pages of some trees allocate their updates from an arena. */
+	if (btree->page_arena && page->type != WT_PAGE_COL_INT &&
+	    page->type != WT_PAGE_ROW_INT) {
+		if ((ret = __wt_calloc_one(session, &modify->arena)) != 0) {
+			__wt_free(session, modify);
+			return (ret);
+		}
+		modify->arena->ref = 1;
+	}
+
 	/*
 	 * Multiple threads of control may be searching and deciding to modify
 	 * a page.  If our modify structure is used, update the page's memory
@@ -36,18 +49,211 @@ __wt_page_modify_alloc(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 */
 	if (WT_ATOMIC_CAS8(page->modify, NULL, modify))
 		__wt_cache_page_inmem_incr(session, page, sizeof(*modify));
-	else
+	else {
+		__wt_free(session, modify->arena);
 		__wt_free(session, modify);
+	}
+	return (0);
+}
+
+/*
+ * __arena_block_alloc --
+ *	Allocate a new block for a page arena.
+ */
+static int
+__arena_block_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
+    WT_ARENA *arena, size_t size, size_t used, WT_ARENA_BLOCK **blockp)
+{
+	WT_ARENA_BLOCK *block;
+
+	WT_RET(__wt_calloc(session, 1, sizeof(WT_ARENA_BLOCK) + size, &block));
+	block->size = size;
+	block->used = used;
+
+	/* Link the block into the arena, it is freed with the arena. */
+	do {
+		block->next = arena->blocks;
+	} while (!WT_ATOMIC_CAS8(arena->blocks, block->next, block));
+
+	/*
+	 * Charge the whole block to the page, including any part of it that
+	 * is never used: blocks replaced in a race, items orphaned by pruning
+	 * and failed inserts all stay allocated until the arena is freed.
+	 */
+	size += sizeof(WT_ARENA_BLOCK);
+	(void)WT_ATOMIC_ADD8(page->modify->arena_bytes, size);
+	__wt_cache_page_inmem_incr(session, page, size);
+
+	WT_STAT_FAST_CONN_INCRV(session, cache_arena_alloc, size);
+
+	*blockp = block;
+	return (0);
+}
+
+/*
+ * __wt_page_arena_alloc --
+ *	Allocate cleared memory for an insert or update on a page, from the
+ * page's arena if it has one.
+ */
+int
+__wt_page_arena_alloc(
+    WT_SESSION_IMPL *session, WT_PAGE *page, size_t size, void *retp)
+{
+	WT_ARENA *arena;
+	WT_ARENA_BLOCK *block, *new;
+	size_t block_size;
+	uint64_t used;
+	u_int stripe;
+
+	WT_RET(__wt_page_modify_init(session, page));
+	if ((arena = page->modify->arena) == NULL)
+		return (__wt_calloc(session, 1, size, retp));
+
+	size = (size_t)WT_ALIGN(size, sizeof(uint64_t));
+
+	/* Large items get a block of their own. */
+	if (size > WT_ARENA_BLOCK_MAX / 4) {
+		WT_RET(__arena_block_alloc(
+		    session, page, arena, size, size, &new));
+		*(void **)retp = WT_ARENA_BLOCK_MEM(new);
+		return (0);
+	}
+
+	/*
+	 * Take the memory from the end of the session's stripe's current
+	 * block; if another thread allocated from the block first, retry.
+	 */
+	stripe = session->id % WT_ARENA_STRIPES;
+	for (;;) {
+		if ((block = arena->stripe[stripe]) == NULL)
+			break;
+		used = block->used;
+		if (used + size > block->size)
+			break;
+		if (WT_ATOMIC_CAS8(block->used, used, used + size)) {
+			*(void **)retp = WT_ARENA_BLOCK_MEM(block) + used;
+			return (0);
+		}
+	}
+
+	/*
+	 * The block is full: allocate a new one, doubling the block size up to
+	 * a maximum so busy pages make fewer, larger allocations.  If another
+	 * thread replaced the stripe's block first, our block is still linked
+	 * into the arena, it just isn't used for later allocations.
+	 */
+	block_size = block == NULL ?
+	    WT_ARENA_BLOCK_MIN : WT_MIN(2 * block->size, WT_ARENA_BLOCK_MAX);
+	WT_RET(__arena_block_alloc(
+	    session, page, arena, block_size, size, &new));
+	(void)WT_ATOMIC_CAS8(arena->stripe[stripe], block, new);
+
+	*(void **)retp = WT_ARENA_BLOCK_MEM(new);
+	return (0);
+}
+
+/*
+ * __wt_page_arena_free --
+ *	Free memory allocated for an insert or update on a page that wasn't
+ * used: memory from the page's arena is only freed with the arena.
+ */
+void
+__wt_page_arena_free(WT_SESSION_IMPL *session, WT_PAGE *page, void *p)
+{
+	if (page->modify == NULL || page->modify->arena == NULL)
+		__wt_free(session, p);
+}
+
+/*
+ * __wt_update_free --
+ *	Free an update that wasn't used: updates from a page's arena are only
+ * freed with the arena.
+ */
+void
+__wt_update_free(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+	if (upd != NULL && !F_ISSET(upd, WT_UPDATE_ARENA))
+		__wt_free(session, upd);
+}
+
+/*
+ * __wt_page_arena_share --
+ *	Make a page allocate from another page's arena (or from the heap, if
+ * the other page doesn't have an arena), used when splitting moves inserts
+ * and updates between pages.  Optionally move the charge for the arena's
+ * blocks to the page, if the other page is about to be discarded.
+ */
+int
+__wt_page_arena_share(WT_SESSION_IMPL *session,
+    WT_PAGE *page, WT_PAGE *src, int move_charge)
+{
+	WT_ARENA *arena;
+	uint64_t bytes;
+
+	WT_RET(__wt_page_modify_init(session, page));
+
+	arena = src->modify == NULL ? NULL : src->modify->arena;
+	if (page->modify->arena == arena)
+		return (0);
+
+	/* The page's own arena is new, releasing it frees its blocks. */
+	if ((bytes = page->modify->arena_bytes) != 0) {
+		page->modify->arena_bytes = 0;
+		__wt_cache_page_inmem_decr(session, page, bytes);
+	}
+	__wt_page_arena_release(session, page->modify);
+	if (arena == NULL)
+		return (0);
+
+	(void)WT_ATOMIC_ADD4(arena->ref, 1);
+	page->modify->arena = arena;
+
+	/*
+	 * If the other page is discarded once the split completes, move the
+	 * charge for the shared arena's blocks to the page, so the arena stays
+	 * charged while it is in use.
+	 */
+	if (move_charge && (bytes = src->modify->arena_bytes) != 0) {
+		src->modify->arena_bytes = 0;
+		__wt_cache_page_inmem_decr(session, src, bytes);
+		page->modify->arena_bytes = bytes;
+		__wt_cache_page_inmem_incr(session, page, bytes);
+	}
 	return (0);
 }
 
+/*
+ * __wt_page_arena_release --
+ *	Release a page's reference to its arena, freeing the arena's memory
+ * when no other page shares it.
+ */
+void
+__wt_page_arena_release(WT_SESSION_IMPL *session, WT_PAGE_MODIFY *mod)
+{
+	WT_ARENA *arena;
+	WT_ARENA_BLOCK *block, *next;
+
+	if ((arena = mod->arena) == NULL)
+		return;
+	mod->arena = NULL;
+
+	if (WT_ATOMIC_SUB4(arena->ref, 1) != 0)
+		return;
+
+	for (block = arena->blocks; block != NULL; block = next) {
+		next = block->next;
+		__wt_free(session, block);
+	}
+	__wt_free(session, arena);
+}
+
 /*
  * __wt_row_modify --
  *	Row-store insert, update and delete.
  */
 int
 __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
-    WT_ITEM *key, WT_ITEM *value, WT_UPDATE *upd, int is_remove)
+    WT_ITEM *key, WT_ITEM *value, WT_UPDATE *upd, u_int modify_type)
 {
 	WT_DECL_RET;
 	WT_INSERT *ins;
@@ -64,7 +270,7 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 	logged = 0;
 
 	/* This code expects a remove to have a NULL value. */
-	if (is_remove)
+	if (modify_type == WT_UPDATE_DELETED)
 		value = NULL;
 
 	/* If we don't yet have a modify structure, we'll need one. */
@@ -95,9 +301,18 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 			WT_ERR(__wt_txn_update_check(
 			    session, old_upd = *upd_entry));
 
-			/* Allocate a WT_UPDATE structure and transaction ID. */
-			WT_ERR(
-			    __wt_update_alloc(session, value, &upd, &upd_size));
+			/*
+			 * Allocate a WT_UPDATE structure and transaction ID.
+			 *
+			 * Updates of existing keys aren't allocated from the
+			 * page's arena: they're freed once they're obsolete,
+			 * so frequently updated keys don't grow the arena.
+			 */
+			WT_ERR(__wt_update_alloc(
+			    session, NULL, value, &upd, &upd_size));
+			if (page->modify->arena != NULL)
+				page->modify->arena->heap_updates = 1;
+			upd->type = (uint8_t)modify_type;
 			WT_ERR(__wt_txn_modify(session, upd));
 			logged = 1;
 
@@ -161,13 +376,14 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 		 * be allocated, the WT_INSERT was allocated).
 		 */
 		WT_ERR(__wt_row_insert_alloc(
-		    session, key, skipdepth, &ins, &ins_size));
+		    session, page, key, skipdepth, &ins, &ins_size));
 		cbt->ins_head = ins_head;
 		cbt->ins = ins;
 
 		if (upd == NULL) {
-			WT_ERR(
-			    __wt_update_alloc(session, value, &upd, &upd_size));
+			WT_ERR(__wt_update_alloc(
+			    session, page, value, &upd, &upd_size));
+			upd->type = (uint8_t)modify_type;
 			WT_ERR(__wt_txn_modify(session, upd));
 			logged = 1;
 
@@ -216,9 +432,9 @@ err:		/*
 		 */
 		if (logged)
 			__wt_txn_unmodify(session);
-		__wt_free(session, ins);
+		__wt_page_arena_free(session, page, ins);
 		cbt->ins = NULL;
-		__wt_free(session, upd);
+		__wt_update_free(session, upd);
 	}
 
 	return (ret);
@@ -229,7 +445,7 @@ err:		/*
  *	Row-store insert: allocate a WT_INSERT structure and fill it in.
  */
 int
-__wt_row_insert_alloc(WT_SESSION_IMPL *session,
+__wt_row_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
     WT_ITEM *key, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep)
 {
 	WT_INSERT *ins;
@@ -241,25 +457,28 @@ __wt_row_insert_alloc(WT_SESSION_IMPL *session,
 	 */
 	ins_size = sizeof(WT_INSERT) +
 	    skipdepth * sizeof(WT_INSERT *) + key->size;
-	WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+	WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
 
 	ins->u.key.offset = WT_STORE_SIZE(ins_size - key->size);
 	WT_INSERT_KEY_SIZE(ins) = WT_STORE_SIZE(key->size);
 	memcpy(WT_INSERT_KEY(ins), key->data, key->size);
 
+	/* Memory from the page's arena is charged with the arena's blocks. */
 	*insp = ins;
 	if (ins_sizep != NULL)
-		*ins_sizep = ins_size;
+		*ins_sizep = page->modify->arena == NULL ? ins_size : 0;
 	return (0);
 }
 
 /*
  * __wt_update_alloc --
  *	Allocate a WT_UPDATE structure and associated value and fill it in.
+ * The update is allocated from the page's arena if a page is passed in and
+ * it has one.
  */
 int
-__wt_update_alloc(
-    WT_SESSION_IMPL *session, WT_ITEM *value, WT_UPDATE **updp, size_t *sizep)
+__wt_update_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page, WT_ITEM *value, WT_UPDATE **updp, size_t *sizep)
 {
 	WT_UPDATE *upd;
 	size_t size;
@@ -269,7 +488,14 @@ __wt_update_alloc(
 	 * the value into place.
 	 */
 	size = value == NULL ? 0 : value->size;
-	WT_RET(__wt_calloc(session, 1, sizeof(WT_UPDATE) + size, &upd));
+	if (page == NULL)
+		WT_RET(__wt_calloc(session, 1, sizeof(WT_UPDATE) + size, &upd));
+	else {
+		WT_RET(__wt_page_arena_alloc(
+		    session, page, sizeof(WT_UPDATE) + size, &upd));
+		if (page->modify->arena != NULL)
+			F_SET(upd, WT_UPDATE_ARENA);
+	}
 	if (value == NULL)
 		WT_UPDATE_DELETED_SET(upd);
 	else {
@@ -277,19 +503,26 @@ __wt_update_alloc(
 		memcpy(WT_UPDATE_DATA(upd), value->data, size);
 	}
 
+	/* Memory from the page's arena is charged with the arena's blocks. */
 	*updp = upd;
-	*sizep = sizeof(WT_UPDATE) + size;
+	*sizep = F_ISSET(upd, WT_UPDATE_ARENA) ? 0 : sizeof(WT_UPDATE) + size;
 	return (0);
 }
 
 /*
  * __wt_update_obsolete_check --
- *	Check for obsolete updates.
+ *	Check for obsolete updates.  If a page is passed in and the remaining
+ * update chain is long, flag the page for the update prune server.
  */
 WT_UPDATE *
-__wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+__wt_update_obsolete_check(
+    WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd)
 {
+	WT_CONNECTION_IMPL *conn;
 	WT_UPDATE *first, *next;
+	u_int count, first_count;
+
+	conn = S2C(session);
 
 	/*
 	 * This function identifies obsolete updates, and truncates them from
@@ -299,13 +532,27 @@ __wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 	 *
 	 * Walk the list of updates, looking for obsolete updates at the end.
 	 */
-	for (first = NULL; upd != NULL; upd = upd->next)
+	for (first = NULL, count = first_count = 0;
+	    upd != NULL; upd = upd->next, ++count)
 		if (__wt_txn_visible_all(session, upd->txnid)) {
-			if (first == NULL)
+			if (first == NULL) {
 				first = upd;
+				first_count = count;
+			}
 		} else if (upd->txnid != WT_TXN_ABORTED)
 			first = NULL;
 
+	/*
+	 * A modified update is built from the updates after it in the list:
+	 * keep everything up to and including the complete value it's built
+	 * from.
+	 */
+	while (first != NULL && (first->txnid == WT_TXN_ABORTED ||
+	    WT_UPDATE_MODIFIED_ISSET(first))) {
+		first = first->next;
+		++first_count;
+	}
+
 	/*
 	 * We cannot discard this WT_UPDATE structure, we can only discard
 	 * WT_UPDATE structures subsequent to it, other threads of control will
@@ -315,9 +562,23 @@ __wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 	if (first != NULL &&
 	    (next = first->next) != NULL &&
 	    WT_ATOMIC_CAS8(first->next, next, NULL))
-		return (next);
+		count = first_count + 1;
+	else
+		next = NULL;
 
-	return (NULL);
+	/*
+	 * If the remaining chain is long, a running transaction is keeping old
+	 * updates in place: flag the page so the update prune server discards
+	 * them once they're obsolete, readers shouldn't have to walk them until
+	 * the next update or reconciliation of the page.
+	 */
+	if (page != NULL && conn->prune_chain_max != 0 &&
+	    count >= conn->prune_chain_max && !page->modify->prune_chain) {
+		page->modify->prune_chain = 1;
+		S2BT(session)->prune_pending = 1;
+	}
+
+	return (next);
 }
 
 /*
@@ -331,9 +592,14 @@ __wt_update_obsolete_free(
 	WT_UPDATE *next;
 	size_t size;
 
-	/* Free a WT_UPDATE list. */
+	/*
+	 * Free a WT_UPDATE list, except for updates allocated from the page's
+	 * arena, which are freed with the arena.
+	 */
 	for (size = 0; upd != NULL; upd = next) {
 		next = upd->next;
+		if (F_ISSET(upd, WT_UPDATE_ARENA))
+			continue;
 		size += WT_UPDATE_MEMSIZE(upd);
 		__wt_free(session, upd);
 	}
@@ -48,6 +48,9 @@ static const WT_CONFIG_CHECK confchk_checkpoint_subconfigs[] = {
 	{ "log_size", "int", "min=0,max=2GB", NULL },
 	{ "name", "string", NULL, NULL },
 	{ "wait", "int", "min=0,max=100000", NULL },
+	{ "workers", "int", "min=0,max=20", NULL },
+	{ "write_rate", "int", "min=0,max=100GB", NULL },
+	{ "write_target", "int", "min=0,max=100", NULL },
 	{ NULL, NULL, NULL, NULL }
 };
 
@@ -71,6 +74,13 @@ static const WT_CONFIG_CHECK confchk_shared_cache_subconfigs[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_statistics_conflicts_subconfigs[] = {
+	{ "enabled", "boolean", NULL, NULL },
+	{ "keys", "int", "min=1,max=1000", NULL },
+	{ "sample", "int", "min=1,max=1000000", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_statistics_log_subconfigs[] = {
 	{ "on_close", "boolean", NULL, NULL },
 	{ "path", "string", NULL, NULL },
@@ -80,6 +90,12 @@ static const WT_CONFIG_CHECK confchk_statistics_log_subconfigs[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_update_prune_subconfigs[] = {
+	{ "chain_max", "int", "min=2,max=1000000", NULL },
+	{ "wait", "int", "min=0,max=100000", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ "async", "category", NULL, confchk_async_subconfigs },
 	{ "cache_overhead", "int", "min=0,max=30", NULL },
@@ -99,8 +115,12 @@ static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ "statistics", "list",
 	    "choices=[\"all\",\"fast\",\"none\",\"clear\"]",
 	    NULL },
+	{ "statistics_conflicts", "category", NULL,
+	     confchk_statistics_conflicts_subconfigs },
 	{ "statistics_log", "category", NULL,
 	     confchk_statistics_log_subconfigs },
+	{ "update_prune", "category", NULL,
+	     confchk_update_prune_subconfigs },
 	{ "verbose", "list",
 	    "choices=[\"api\",\"block\",\"checkpoint\",\"compact\",\"evict\""
 	    ",\"evictserver\",\"fileops\",\"log\",\"lsm\",\"metadata\","
@@ -174,11 +194,13 @@ static const WT_CONFIG_CHECK confchk_index_meta[] = {
 };
 
 static const WT_CONFIG_CHECK confchk_session_begin_transaction[] = {
+	{ "group", "boolean", NULL, NULL },
 	{ "isolation", "string",
 	    "choices=[\"read-uncommitted\",\"read-committed\",\"snapshot\"]",
 	    NULL },
 	{ "name", "string", NULL, NULL },
 	{ "priority", "int", "min=-100,max=100", NULL },
+	{ "snapshot", "string", NULL, NULL },
 	{ "sync", "boolean", NULL, NULL },
 	{ NULL, NULL, NULL, NULL }
 };
@@ -191,6 +213,11 @@ static const WT_CONFIG_CHECK confchk_session_checkpoint[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_session_commit_transaction[] = {
+	{ "unit", "boolean", NULL, NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_session_compact[] = {
 	{ "timeout", "int", NULL, NULL },
 	{ NULL, NULL, NULL, NULL }
@@ -200,14 +227,22 @@ static const WT_CONFIG_CHECK confchk_lsm_subconfigs[] = {
 	{ "auto_throttle", "boolean", NULL, NULL },
 	{ "bloom", "boolean", NULL, NULL },
 	{ "bloom_bit_count", "int", "min=2,max=1000", NULL },
+	{ "bloom_blocked", "boolean", NULL, NULL },
 	{ "bloom_config", "string", NULL, NULL },
 	{ "bloom_hash_count", "int", "min=2,max=100", NULL },
 	{ "bloom_oldest", "boolean", NULL, NULL },
+	{ "bloom_prefix", "int", "min=0,max=1024", NULL },
 	{ "chunk_count_limit", "int", NULL, NULL },
 	{ "chunk_max", "int", "min=100MB,max=10TB", NULL },
 	{ "chunk_size", "int", "min=512K,max=500MB", NULL },
+	{ "level_multiplier", "int", "min=2,max=100", NULL },
 	{ "merge_max", "int", "min=2,max=100", NULL },
 	{ "merge_min", "int", "max=100", NULL },
+	{ "merge_partitions", "int", "min=1,max=64", NULL },
+	{ "merge_policy", "string",
+	    "choices=[\"leveled\",\"tiered\"]",
+	    NULL },
+	{ "throttle_backlog", "int", "min=0,max=1000", NULL },
 	{ NULL, NULL, NULL, NULL }
 };
 
@@ -270,8 +305,16 @@ static const WT_CONFIG_CHECK confchk_session_open_cursor[] = {
 	{ "dump", "string",
 	    "choices=[\"hex\",\"json\",\"print\"]",
 	    NULL },
+	{ "log_batch", "int", "min=1,max=10000", NULL },
+	{ "log_operations", "list",
+	    "choices=[\"col_put\",\"col_remove\",\"col_truncate\","
+	    "\"row_modify\",\"row_put\",\"row_remove\",\"row_truncate\"]",
+	    NULL },
+	{ "log_start_lsn", "string", NULL, NULL },
+	{ "log_stop_lsn", "string", NULL, NULL },
 	{ "next_random", "boolean", NULL, NULL },
 	{ "overwrite", "boolean", NULL, NULL },
+	{ "prefix_search", "boolean", NULL, NULL },
 	{ "raw", "boolean", NULL, NULL },
 	{ "readonly", "boolean", NULL, NULL },
 	{ "skip_sort_check", "boolean", NULL, NULL },
@@ -289,11 +332,30 @@ static const WT_CONFIG_CHECK confchk_session_reconfigure[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_session_rollback_transaction[] = {
+	{ "unit", "boolean", NULL, NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_session_salvage[] = {
 	{ "force", "boolean", NULL, NULL },
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_drop_subconfigs[] = {
+	{ "all", "boolean", NULL, NULL },
+	{ "before", "string", NULL, NULL },
+	{ "names", "list", NULL, NULL },
+	{ "to", "string", NULL, NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
+static const WT_CONFIG_CHECK confchk_session_snapshot[] = {
+	{ "drop", "category", NULL, confchk_drop_subconfigs },
+	{ "name", "string", NULL, NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_session_verify[] = {
 	{ "dump_address", "boolean", NULL, NULL },
 	{ "dump_blocks", "boolean", NULL, NULL },
@@ -320,11 +382,19 @@ static const WT_CONFIG_CHECK confchk_log_subconfigs[] = {
 	{ "path", "string", NULL, NULL },
 	{ "prealloc", "boolean", NULL, NULL },
 	{ "recover", "string", "choices=[\"error\",\"on\"]", NULL },
+	{ "recover_threads", "int", "min=1,max=64", NULL },
+	{ "recycle", "boolean", NULL, NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
+static const WT_CONFIG_CHECK confchk_lookaside_subconfigs[] = {
+	{ "enabled", "boolean", NULL, NULL },
 	{ NULL, NULL, NULL, NULL }
 };
 
 static const WT_CONFIG_CHECK confchk_transaction_sync_subconfigs[] = {
 	{ "enabled", "boolean", NULL, NULL },
+	{ "group_commit_delay", "int", "min=0,max=100000", NULL },
 	{ "method", "string",
 	    "choices=[\"dsync\",\"fsync\",\"none\"]",
 	    NULL },
@@ -354,6 +424,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "file_extend", "list", "choices=[\"data\",\"log\"]", NULL },
 	{ "hazard_max", "int", "min=15", NULL },
 	{ "log", "category", NULL, confchk_log_subconfigs },
+	{ "lookaside", "category", NULL, confchk_lookaside_subconfigs },
 	{ "lsm_manager", "category", NULL,
 	     confchk_lsm_manager_subconfigs },
 	{ "lsm_merge", "boolean", NULL, NULL },
@@ -366,10 +437,14 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "statistics", "list",
 	    "choices=[\"all\",\"fast\",\"none\",\"clear\"]",
 	    NULL },
+	{ "statistics_conflicts", "category", NULL,
+	     confchk_statistics_conflicts_subconfigs },
 	{ "statistics_log", "category", NULL,
 	     confchk_statistics_log_subconfigs },
 	{ "transaction_sync", "category", NULL,
 	     confchk_transaction_sync_subconfigs },
+	{ "update_prune", "category", NULL,
+	     confchk_update_prune_subconfigs },
 	{ "use_environment_priv", "boolean", NULL, NULL },
 	{ "verbose", "list",
 	    "choices=[\"api\",\"block\",\"checkpoint\",\"compact\",\"evict\""
@@ -404,6 +479,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "file_extend", "list", "choices=[\"data\",\"log\"]", NULL },
 	{ "hazard_max", "int", "min=15", NULL },
 	{ "log", "category", NULL, confchk_log_subconfigs },
+	{ "lookaside", "category", NULL, confchk_lookaside_subconfigs },
 	{ "lsm_manager", "category", NULL,
 	     confchk_lsm_manager_subconfigs },
 	{ "lsm_merge", "boolean", NULL, NULL },
@@ -416,10 +492,14 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "statistics", "list",
 	    "choices=[\"all\",\"fast\",\"none\",\"clear\"]",
 	    NULL },
+	{ "statistics_conflicts", "category", NULL,
+	     confchk_statistics_conflicts_subconfigs },
 	{ "statistics_log", "category", NULL,
 	     confchk_statistics_log_subconfigs },
 	{ "transaction_sync", "category", NULL,
 	     confchk_transaction_sync_subconfigs },
+	{ "update_prune", "category", NULL,
+	     confchk_update_prune_subconfigs },
 	{ "use_environment_priv", "boolean", NULL, NULL },
 	{ "verbose", "list",
 	    "choices=[\"api\",\"block\",\"checkpoint\",\"compact\",\"evict\""
@@ -452,6 +532,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "file_extend", "list", "choices=[\"data\",\"log\"]", NULL },
 	{ "hazard_max", "int", "min=15", NULL },
 	{ "log", "category", NULL, confchk_log_subconfigs },
+	{ "lookaside", "category", NULL, confchk_lookaside_subconfigs },
 	{ "lsm_manager", "category", NULL,
 	     confchk_lsm_manager_subconfigs },
 	{ "lsm_merge", "boolean", NULL, NULL },
@@ -464,10 +545,14 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "statistics", "list",
 	    "choices=[\"all\",\"fast\",\"none\",\"clear\"]",
 	    NULL },
+	{ "statistics_conflicts", "category", NULL,
+	     confchk_statistics_conflicts_subconfigs },
 	{ "statistics_log", "category", NULL,
 	     confchk_statistics_log_subconfigs },
 	{ "transaction_sync", "category", NULL,
 	     confchk_transaction_sync_subconfigs },
+	{ "update_prune", "category", NULL,
+	     confchk_update_prune_subconfigs },
 	{ "verbose", "list",
 	    "choices=[\"api\",\"block\",\"checkpoint\",\"compact\",\"evict\""
 	    ",\"evictserver\",\"fileops\",\"log\",\"lsm\",\"metadata\","
@@ -499,6 +584,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "file_extend", "list", "choices=[\"data\",\"log\"]", NULL },
 	{ "hazard_max", "int", "min=15", NULL },
 	{ "log", "category", NULL, confchk_log_subconfigs },
+	{ "lookaside", "category", NULL, confchk_lookaside_subconfigs },
 	{ "lsm_manager", "category", NULL,
 	     confchk_lsm_manager_subconfigs },
 	{ "lsm_merge", "boolean", NULL, NULL },
@@ -511,10 +597,14 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "statistics", "list",
 	    "choices=[\"all\",\"fast\",\"none\",\"clear\"]",
 	    NULL },
+	{ "statistics_conflicts", "category", NULL,
+	     confchk_statistics_conflicts_subconfigs },
 	{ "statistics_log", "category", NULL,
 	     confchk_statistics_log_subconfigs },
 	{ "transaction_sync", "category", NULL,
 	     confchk_transaction_sync_subconfigs },
+	{ "update_prune", "category", NULL,
+	     confchk_update_prune_subconfigs },
 	{ "verbose", "list",
 	    "choices=[\"api\",\"block\",\"checkpoint\",\"compact\",\"evict\""
 	    ",\"evictserver\",\"fileops\",\"log\",\"lsm\",\"metadata\","
@@ -566,13 +656,16 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "connection.reconfigure",
 	  "async=(enabled=0,ops_max=1024,threads=2),cache_overhead=8,"
 	  "cache_size=100MB,checkpoint=(log_size=0,"
-	  "name=\"WiredTigerCheckpoint\",wait=0),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_target=80,eviction_trigger=95,lsm_manager=(merge=,"
-	  "worker_thread_max=4),lsm_merge=,shared_cache=(chunk=10MB,name=,"
-	  "reserve=0,size=500MB),statistics=none,statistics_log=(on_close=0"
-	  ",path=\"WiredTigerStat.%d.%H\",sources=,"
-	  "timestamp=\"%b %d %H:%M:%S\",wait=0),verbose=",
+	  "name=\"WiredTigerCheckpoint\",wait=0,workers=0,write_rate=0,"
+	  "write_target=0),error_prefix=,eviction=(threads_max=1,"
+	  "threads_min=1),eviction_dirty_target=80,eviction_target=80,"
+	  "eviction_trigger=95,lsm_manager=(merge=,worker_thread_max=4),"
+	  "lsm_merge=,shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
+	  "statistics=none,statistics_conflicts=(enabled=0,keys=20,"
+	  "sample=1),statistics_log=(on_close=0,"
+	  "path=\"WiredTigerStat.%d.%H\",sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),update_prune=(chain_max=100"
+	  ",wait=0),verbose=",
 	  confchk_connection_reconfigure
 	},
 	{ "cursor.close",
@@ -603,7 +696,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_index_meta
 	},
 	{ "session.begin_transaction",
-	  "isolation=,name=,priority=0,sync=",
+	  "group=0,isolation=,name=,priority=0,snapshot=,sync=",
 	  confchk_session_begin_transaction
 	},
 	{ "session.checkpoint",
@@ -615,8 +708,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL
 	},
 	{ "session.commit_transaction",
-	  "",
-	  NULL
+	  "unit=0",
+	  confchk_session_commit_transaction
 	},
 	{ "session.compact",
 	  "timeout=1200",
@@ -630,13 +723,14 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "internal_item_max=0,internal_key_max=0,internal_key_truncate=,"
 	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_item_max=0,"
 	  "leaf_key_max=0,leaf_page_max=32KB,leaf_value_max=0,"
-	  "lsm=(auto_throttle=,bloom=,bloom_bit_count=16,bloom_config=,"
-	  "bloom_hash_count=8,bloom_oldest=0,chunk_count_limit=0,"
-	  "chunk_max=5GB,chunk_size=10MB,merge_max=15,merge_min=0),"
-	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
-	  "prefix_compression=0,prefix_compression_min=4,source=,"
-	  "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
-	  "type=file,value_format=u",
+	  "lsm=(auto_throttle=,bloom=,bloom_bit_count=16,bloom_blocked=,"
+	  "bloom_config=,bloom_hash_count=8,bloom_oldest=0,bloom_prefix=0,"
+	  "chunk_count_limit=0,chunk_max=5GB,chunk_size=10MB,"
+	  "level_multiplier=10,merge_max=15,merge_min=0,merge_partitions=1,"
+	  "merge_policy=tiered,throttle_backlog=0),memory_page_max=5MB,"
+	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=0,"
+	  "prefix_compression_min=4,source=,split_deepen_min_child=0,"
+	  "split_deepen_per_child=0,split_pct=75,type=file,value_format=u",
 	  confchk_session_create
 	},
 	{ "session.drop",
@@ -648,8 +742,10 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL
 	},
 	{ "session.open_cursor",
-	  "append=0,bulk=0,checkpoint=,dump=,next_random=0,overwrite=,raw=0"
-	  ",readonly=0,skip_sort_check=0,statistics=,target=",
+	  "append=0,bulk=0,checkpoint=,dump=,log_batch=1,log_operations=,"
+	  "log_start_lsn=,log_stop_lsn=,next_random=0,overwrite=,"
+	  "prefix_search=0,raw=0,readonly=0,skip_sort_check=0,statistics=,"
+	  "target=",
 	  confchk_session_open_cursor
 	},
 	{ "session.reconfigure",
@@ -661,13 +757,17 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL
 	},
 	{ "session.rollback_transaction",
-	  "",
-	  NULL
+	  "unit=0",
+	  confchk_session_rollback_transaction
 	},
 	{ "session.salvage",
 	  "force=0",
 	  confchk_session_salvage
 	},
+	{ "session.snapshot",
+	  "drop=(all=0,before=,names=,to=),name=",
+	  confchk_session_snapshot
+	},
 	{ "session.strerror",
 	  "",
 	  NULL
@@ -692,71 +792,85 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "wiredtiger_open",
 	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
 	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "config_base=,create=0,direct_io=,error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
-	  "file_extend=,hazard_max=1000,log=(archive=,compressor=,enabled=0"
-	  ",file_max=100MB,path=,prealloc=,recover=on),lsm_manager=(merge=,"
-	  "worker_thread_max=4),lsm_merge=,mmap=,multiprocess=0,"
-	  "session_max=100,session_scratch_max=2MB,shared_cache=(chunk=10MB"
-	  ",name=,reserve=0,size=500MB),statistics=none,"
-	  "statistics_log=(on_close=0,path=\"WiredTigerStat.%d.%H\","
-	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
-	  "transaction_sync=(enabled=0,method=fsync),use_environment_priv=0"
-	  ",verbose=",
+	  "name=\"WiredTigerCheckpoint\",wait=0,workers=0,write_rate=0,"
+	  "write_target=0),checkpoint_sync=,config_base=,create=0,"
+	  "direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
+	  "eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
+	  "exclusive=0,extensions=,file_extend=,hazard_max=1000,"
+	  "log=(archive=,compressor=,enabled=0,file_max=100MB,path=,"
+	  "prealloc=,recover=on,recover_threads=1,recycle=0),"
+	  "lookaside=(enabled=0),lsm_manager=(merge=,worker_thread_max=4),"
+	  "lsm_merge=,mmap=,multiprocess=0,session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,reserve=0"
+	  ",size=500MB),statistics=none,statistics_conflicts=(enabled=0,"
+	  "keys=20,sample=1),statistics_log=(on_close=0,"
+	  "path=\"WiredTigerStat.%d.%H\",sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
+	  ",group_commit_delay=0,method=fsync),update_prune=(chain_max=100,"
+	  "wait=0),use_environment_priv=0,verbose=",
 	  confchk_wiredtiger_open
 	},
 	{ "wiredtiger_open_all",
 	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
 	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "config_base=,create=0,direct_io=,error_prefix=,"
+	  "name=\"WiredTigerCheckpoint\",wait=0,workers=0,write_rate=0,"
+	  "write_target=0),checkpoint_sync=,config_base=,create=0,"
+	  "direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
+	  "eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
+	  "exclusive=0,extensions=,file_extend=,hazard_max=1000,"
+	  "log=(archive=,compressor=,enabled=0,file_max=100MB,path=,"
+	  "prealloc=,recover=on,recover_threads=1,recycle=0),"
+	  "lookaside=(enabled=0),lsm_manager=(merge=,worker_thread_max=4),"
+	  "lsm_merge=,mmap=,multiprocess=0,session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,reserve=0"
+	  ",size=500MB),statistics=none,statistics_conflicts=(enabled=0,"
+	  "keys=20,sample=1),statistics_log=(on_close=0,"
+	  "path=\"WiredTigerStat.%d.%H\",sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
+	  ",group_commit_delay=0,method=fsync),update_prune=(chain_max=100,"
+	  "wait=0),use_environment_priv=0,verbose=,version=(major=0,"
+	  "minor=0)",
+	  confchk_wiredtiger_open_all
+	},
+	{ "wiredtiger_open_basecfg",
+	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
+	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "name=\"WiredTigerCheckpoint\",wait=0,workers=0,write_rate=0,"
+	  "write_target=0),checkpoint_sync=,direct_io=,error_prefix=,"
 	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
-	  "file_extend=,hazard_max=1000,log=(archive=,compressor=,enabled=0"
-	  ",file_max=100MB,path=,prealloc=,recover=on),lsm_manager=(merge=,"
+	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
+	  "hazard_max=1000,log=(archive=,compressor=,enabled=0,"
+	  "file_max=100MB,path=,prealloc=,recover=on,recover_threads=1,"
+	  "recycle=0),lookaside=(enabled=0),lsm_manager=(merge=,"
 	  "worker_thread_max=4),lsm_merge=,mmap=,multiprocess=0,"
 	  "session_max=100,session_scratch_max=2MB,shared_cache=(chunk=10MB"
 	  ",name=,reserve=0,size=500MB),statistics=none,"
+	  "statistics_conflicts=(enabled=0,keys=20,sample=1),"
 	  "statistics_log=(on_close=0,path=\"WiredTigerStat.%d.%H\","
 	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
-	  "transaction_sync=(enabled=0,method=fsync),use_environment_priv=0"
-	  ",verbose=,version=(major=0,minor=0)",
-	  confchk_wiredtiger_open_all
-	},
-	{ "wiredtiger_open_basecfg",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
-	  "eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
-	  "extensions=,file_extend=,hazard_max=1000,log=(archive=,"
-	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
-	  ",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
-	  "multiprocess=0,session_max=100,session_scratch_max=2MB,"
-	  "shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
-	  "statistics=none,statistics_log=(on_close=0,"
-	  "path=\"WiredTigerStat.%d.%H\",sources=,"
-	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
-	  ",method=fsync),verbose=,version=(major=0,minor=0)",
+	  "transaction_sync=(enabled=0,group_commit_delay=0,method=fsync),"
+	  "update_prune=(chain_max=100,wait=0),verbose=,version=(major=0,"
+	  "minor=0)",
 	  confchk_wiredtiger_open_basecfg
 	},
 	{ "wiredtiger_open_usercfg",
 	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
 	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
-	  "eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
-	  "extensions=,file_extend=,hazard_max=1000,log=(archive=,"
-	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
-	  ",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
-	  "multiprocess=0,session_max=100,session_scratch_max=2MB,"
-	  "shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
-	  "statistics=none,statistics_log=(on_close=0,"
-	  "path=\"WiredTigerStat.%d.%H\",sources=,"
-	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
-	  ",method=fsync),verbose=",
+	  "name=\"WiredTigerCheckpoint\",wait=0,workers=0,write_rate=0,"
+	  "write_target=0),checkpoint_sync=,direct_io=,error_prefix=,"
+	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
+	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
+	  "hazard_max=1000,log=(archive=,compressor=,enabled=0,"
+	  "file_max=100MB,path=,prealloc=,recover=on,recover_threads=1,"
+	  "recycle=0),lookaside=(enabled=0),lsm_manager=(merge=,"
+	  "worker_thread_max=4),lsm_merge=,mmap=,multiprocess=0,"
+	  "session_max=100,session_scratch_max=2MB,shared_cache=(chunk=10MB"
+	  ",name=,reserve=0,size=500MB),statistics=none,"
+	  "statistics_conflicts=(enabled=0,keys=20,sample=1),"
+	  "statistics_log=(on_close=0,path=\"WiredTigerStat.%d.%H\","
+	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "transaction_sync=(enabled=0,group_commit_delay=0,method=fsync),"
+	  "update_prune=(chain_max=100,wait=0),verbose=",
 	  confchk_wiredtiger_open_usercfg
 	},
 	{ NULL, NULL, NULL }
@@ -706,6 +706,9 @@ err:	/*
 			    wt_session, NULL));
 		}
 
+	/* Release the oldest ID pinned by any named snapshots. */
+	__wt_txn_named_snapshot_destroy(session);
+
 	/* Close open, external sessions. */
 	for (s = conn->sessions, i = 0; i < conn->session_cnt; ++s, ++i)
 		if (s->active && !F_ISSET(s, WT_SESSION_INTERNAL)) {
@@ -764,8 +767,10 @@ __conn_reconfigure(WT_CONNECTION *wt_conn, const char *config)
 	WT_ERR(__wt_async_reconfig(session, config_cfg));
 	WT_ERR(__wt_cache_config(session, 1, config_cfg));
 	WT_ERR(__wt_checkpoint_server_create(session, config_cfg));
+	WT_ERR(__wt_conflict_config(session, config_cfg));
 	WT_ERR(__wt_lsm_manager_reconfig(session, config_cfg));
 	WT_ERR(__wt_statlog_create(session, config_cfg));
+	WT_ERR(__wt_update_prune_create(session, config_cfg));
 	WT_ERR(__wt_verbose_config(session, config_cfg));
 
 	WT_ERR(__wt_config_merge(session, config_cfg, &p));
@@ -1624,6 +1629,7 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	conn->mmap = cval.val == 0 ? 0 : 1;
 
 	WT_ERR(__conn_statistics_config(session, cfg));
+	WT_ERR(__wt_conflict_config(session, cfg));
 	WT_ERR(__wt_lsm_manager_config(session, cfg));
 	WT_ERR(__wt_verbose_config(session, cfg));
 
@@ -183,6 +183,7 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 
 	WT_STAT_SET(stats, cache_bytes_max, conn->cache_size);
 	WT_STAT_SET(stats, cache_bytes_inuse, __wt_cache_bytes_inuse(cache));
+	WT_STAT_SET(stats, cache_bytes_bloom, cache->bytes_bloom);
 
 	WT_STAT_SET(stats, cache_overhead, cache->overhead_pct);
 	WT_STAT_SET(stats, cache_pages_inuse, __wt_cache_pages_inuse(cache));
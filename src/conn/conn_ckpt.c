@@ -25,6 +25,23 @@ __ckpt_server_config(WT_SESSION_IMPL *session, const char **cfg, int *startp)
 
 	conn = S2C(session);
 
+	/* Checkpoint workers are used by all checkpoints, not just ours. */
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint.workers", &cval));
+	conn->ckpt_workers = (u_int)cval.val;
+
+	/*
+	 * Checkpoint write throttling: an adjusted rate is discarded when the
+	 * configuration changes, it's recalculated after the next checkpoint.
+	 */
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint.write_rate", &cval));
+	conn->ckpt_write_rate_min = (uint64_t)cval.val;
+	WT_RET(
+	    __wt_config_gets(session, cfg, "checkpoint.write_target", &cval));
+	conn->ckpt_write_target = (u_int)cval.val;
+	conn->ckpt_write_rate = conn->ckpt_write_rate_min;
+	WT_STAT_FAST_CONN_SET(
+	    session, txn_checkpoint_write_rate, conn->ckpt_write_rate);
+
 	/*
 	 * The checkpoint configuration requires a wait time and/or a log
 	 * size -- if one is not set, we're not running at all.
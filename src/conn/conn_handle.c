@@ -49,6 +49,8 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	/* Locks. */
 	WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
 	WT_RET(__wt_spin_init(session, &conn->checkpoint_lock, "checkpoint"));
+	WT_RET(__wt_spin_init(
+	    session, &conn->ckpt_write_lock, "checkpoint write throttle"));
 	WT_RET(__wt_spin_init(session, &conn->dhandle_lock, "data handle"));
 	WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
 	WT_RET(__wt_spin_init(session, &conn->hot_backup_lock, "hot backup"));
@@ -132,6 +134,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	__wt_spin_destroy(session, &conn->api_lock);
 	__wt_spin_destroy(session, &conn->block_lock);
 	__wt_spin_destroy(session, &conn->checkpoint_lock);
+	__wt_spin_destroy(session, &conn->ckpt_write_lock);
 	__wt_spin_destroy(session, &conn->dhandle_lock);
 	__wt_spin_destroy(session, &conn->fh_lock);
 	__wt_spin_destroy(session, &conn->hot_backup_lock);
@@ -0,0 +1,342 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The lookaside table holds older versions of records that running
+ * transactions may still read, written by reconciliation when a page is
+ * evicted.  Records are keyed by the file ID and address of the block written
+ * for the page, plus a counter to keep the records for a block in the order
+ * they were written.  Each record holds the newest transaction ID saved for
+ * the block (once that's globally visible, none of the block's records can be
+ * read), the update's transaction ID and type, the record's key and the
+ * update's value.
+ *
+ * Block addresses are re-used once blocks are freed: reconciliation discards
+ * any records for an address when it writes a new block there.
+ *
+ * The table is private to a single run of the connection: it's dropped and
+ * re-created when the connection is opened.
+ */
+
+/*
+ * __las_drop --
+ *	Discard any lookaside table left by a previous run.
+ */
+static int
+__las_drop(WT_SESSION_IMPL *session)
+{
+	WT_DECL_RET;
+	const char *drop_cfg[] = {
+	    WT_CONFIG_BASE(session, session_drop), "force=true", NULL };
+
+	WT_WITH_SCHEMA_LOCK(session,
+	    ret = __wt_schema_drop(session, WT_LAS_URI, drop_cfg));
+	return (ret);
+}
+
+/*
+ * __wt_las_create --
+ *	Create the lookaside table and open its cursor.
+ */
+int
+__wt_las_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LAS_SLOT *slot;
+	u_int i;
+	const char *open_cfg[] = {
+	    WT_CONFIG_BASE(session, session_open_cursor), NULL };
+
+	conn = S2C(session);
+
+	/* Discard any records written by a previous run. */
+	WT_RET(__las_drop(session));
+
+	WT_RET(__wt_config_gets(session, cfg, "lookaside.enabled", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_WITH_SCHEMA_LOCK(session,
+	    ret = __wt_schema_create(session, WT_LAS_URI, WT_LAS_FORMAT));
+	WT_RET(ret);
+
+	/*
+	 * Open a pool of cursors on the lookaside table, each in a dedicated
+	 * session: any thread evicting or reading pages claims one for as
+	 * long as it needs it.
+	 *
+	 * Lookaside records are never logged and the sessions don't wait for
+	 * cache space: they're used from inside eviction.  Reads see everything
+	 * in the table: lookaside records are written without transaction IDs
+	 * and are never rolled back.
+	 */
+	for (i = 0, slot = conn->las_slots; i < WT_LAS_SLOTS; ++i, ++slot) {
+		WT_RET(__wt_open_internal_session(
+		    conn, "lookaside table", 1, 1, &slot->session));
+		F_SET(slot->session,
+		    WT_SESSION_NO_CACHE_CHECK | WT_SESSION_NO_LOGGING);
+		slot->session->isolation =
+		    slot->session->txn.isolation = TXN_ISO_READ_UNCOMMITTED;
+
+		WT_RET(__wt_open_cursor(slot->session,
+		    WT_LAS_URI, NULL, open_cfg, &slot->cursor));
+	}
+
+	F_SET(conn, WT_CONN_LAS_OPEN);
+	return (0);
+}
+
+/*
+ * __wt_las_destroy --
+ *	Close the lookaside table's cursors and sessions.
+ */
+int
+__wt_las_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LAS_SLOT *slot;
+	WT_SESSION *wt_session;
+	u_int i;
+
+	conn = S2C(session);
+
+	/*
+	 * Stop eviction from choosing the lookaside table and threads from
+	 * claiming cursors, then wait for each cursor's thread to finish with
+	 * it before closing it.  Closed slots are left claimed.
+	 */
+	F_CLR(conn, WT_CONN_LAS_OPEN);
+	WT_FULL_BARRIER();
+
+	for (i = 0, slot = conn->las_slots; i < WT_LAS_SLOTS; ++i, ++slot) {
+		while (!WT_ATOMIC_CAS4(slot->busy, 0, 1))
+			__wt_yield();
+		if (slot->session != NULL) {
+			wt_session = &slot->session->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+
+			slot->session = NULL;
+			slot->cursor = NULL;
+		}
+	}
+
+	return (ret);
+}
+
+/*
+ * __wt_las_cursor --
+ *	Claim a lookaside table cursor, returning NULL if the lookaside table
+ * isn't open.
+ */
+void
+__wt_las_cursor(WT_SESSION_IMPL *session, WT_CURSOR **cursorp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LAS_SLOT *slot;
+	u_int i, start;
+
+	conn = S2C(session);
+	*cursorp = NULL;
+
+	/*
+	 * Start looking at a different slot for each session, so threads
+	 * don't all contend for the first slot.
+	 */
+	start = session->id % WT_LAS_SLOTS;
+	for (;;) {
+		if (!F_ISSET(conn, WT_CONN_LAS_OPEN))
+			return;
+		for (i = 0; i < WT_LAS_SLOTS; ++i) {
+			slot = &conn->las_slots[(start + i) % WT_LAS_SLOTS];
+			if (slot->busy == 0 &&
+			    WT_ATOMIC_CAS4(slot->busy, 0, 1)) {
+				*cursorp = slot->cursor;
+				return;
+			}
+		}
+		WT_STAT_FAST_CONN_INCR(session, cache_lookaside_cursor_wait);
+		__wt_yield();
+	}
+}
+
+/*
+ * __wt_las_cursor_close --
+ *	Reset and release a lookaside table cursor.
+ */
+int
+__wt_las_cursor_close(WT_SESSION_IMPL *session, WT_CURSOR **cursorp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_LAS_SLOT *slot;
+	u_int i;
+
+	conn = S2C(session);
+
+	if ((cursor = *cursorp) == NULL)
+		return (0);
+	*cursorp = NULL;
+
+	ret = cursor->reset(cursor);
+
+	for (i = 0, slot = conn->las_slots; i < WT_LAS_SLOTS; ++i, ++slot)
+		if (slot->cursor == cursor) {
+			WT_PUBLISH(slot->busy, 0);
+			break;
+		}
+	return (ret);
+}
+
+/*
+ * __wt_las_insert --
+ *	Insert a record into the lookaside table.
+ */
+int
+__wt_las_insert(WT_SESSION_IMPL *session, WT_CURSOR *cursor,
+    uint32_t btree_id, WT_ITEM *addr, uint64_t counter, uint64_t block_txn,
+    uint64_t txnid, uint8_t upd_type, WT_ITEM *key, WT_ITEM *value)
+{
+	cursor->set_key(cursor, btree_id, addr, counter);
+	cursor->set_value(cursor, block_txn, txnid, upd_type, key, value);
+	WT_RET(cursor->insert(cursor));
+
+	(void)WT_ATOMIC_ADD8(S2C(session)->las_entries, 1);
+	WT_STAT_FAST_CONN_INCR(session, cache_lookaside_insert);
+	return (0);
+}
+
+/*
+ * __wt_las_remove_block --
+ *	Remove all of the lookaside table records for a block.
+ */
+int
+__wt_las_remove_block(WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor, uint32_t btree_id, const uint8_t *addr, size_t addr_size)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_ITEM las_addr;
+	uint64_t las_counter;
+	uint32_t las_id;
+	int exact;
+
+	conn = S2C(session);
+
+	las_addr.data = addr;
+	las_addr.size = addr_size;
+	cursor->set_key(cursor, btree_id, &las_addr, (uint64_t)0);
+	if ((ret = cursor->search_near(cursor, &exact)) == 0 && exact < 0)
+		ret = cursor->next(cursor);
+	for (; ret == 0; ret = cursor->next(cursor)) {
+		WT_RET(cursor->get_key(
+		    cursor, &las_id, &las_addr, &las_counter));
+		if (las_id != btree_id || las_addr.size != addr_size ||
+		    memcmp(las_addr.data, addr, addr_size) != 0)
+			break;
+
+		WT_RET(cursor->remove(cursor));
+		(void)WT_ATOMIC_SUB8(conn->las_entries, 1);
+		WT_STAT_FAST_CONN_INCR(session, cache_lookaside_remove);
+	}
+	WT_RET_NOTFOUND_OK(ret);
+	return (0);
+}
+
+/*
+ * __wt_las_sweep --
+ *	Remove lookaside table records no running transaction can read.
+ */
+int
+__wt_las_sweep(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(saved_addr);
+	WT_DECL_RET;
+	WT_ITEM las_addr, las_key, las_value;
+	uint64_t block_txn, las_counter, las_txnid, saved_counter;
+	uint32_t las_id, saved_id;
+	u_int i;
+	uint8_t upd_type;
+	int exact;
+
+	conn = S2C(session);
+	cursor = NULL;
+	saved_counter = 0;
+	saved_id = 0;
+
+	if (!F_ISSET(conn, WT_CONN_LAS_OPEN) || conn->las_entries == 0)
+		return (0);
+
+	/*
+	 * Make sure the oldest ID is current, then walk the table.  Release
+	 * the cursor every so often so eviction and page reads waiting for the
+	 * lookaside table aren't stalled by the sweep: each time we reacquire
+	 * it, search for the last key we saw.
+	 */
+	__wt_txn_update_oldest(session);
+
+	WT_RET(__wt_scr_alloc(session, 0, &saved_addr));
+	for (;;) {
+		__wt_las_cursor(session, &cursor);
+		if (cursor == NULL)
+			break;
+
+		if (saved_addr->size == 0)
+			ret = cursor->next(cursor);
+		else {
+			cursor->set_key(
+			    cursor, saved_id, saved_addr, saved_counter);
+			if ((ret =
+			    cursor->search_near(cursor, &exact)) == 0 &&
+			    exact <= 0)
+				ret = cursor->next(cursor);
+		}
+
+		for (i = 0; ret == 0 && i < WT_LAS_SWEEP_ENTRIES;
+		    ++i, ret = cursor->next(cursor)) {
+			WT_ERR(cursor->get_key(
+			    cursor, &las_id, &las_addr, &las_counter));
+			WT_ERR(cursor->get_value(cursor, &block_txn,
+			    &las_txnid, &upd_type, &las_key, &las_value));
+
+			saved_id = las_id;
+			saved_counter = las_counter;
+			WT_ERR(__wt_buf_set(session,
+			    saved_addr, las_addr.data, las_addr.size));
+
+			/*
+			 * Once the newest update saved for a block is globally
+			 * visible, every reader sees the block's on-disk
+			 * values, and the block's records are obsolete.
+			 */
+			if (!__wt_txn_visible_all(session, block_txn))
+				continue;
+
+			WT_ERR(cursor->remove(cursor));
+			(void)WT_ATOMIC_SUB8(conn->las_entries, 1);
+			WT_STAT_FAST_CONN_INCR(session, cache_lookaside_remove);
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+
+		/* Quit at the end of the table. */
+		if (i < WT_LAS_SWEEP_ENTRIES)
+			break;
+		WT_ERR(__wt_las_cursor_close(session, &cursor));
+	}
+
+err:	WT_TRET(__wt_las_cursor_close(session, &cursor));
+	__wt_scr_free(session, &saved_addr);
+	return (ret);
+}
@@ -34,6 +34,10 @@ __logmgr_sync_cfg(WT_SESSION_IMPL *session, const char **cfg)
 		FLD_SET(conn->txn_logsync, WT_LOG_DSYNC);
 	else if (WT_STRING_MATCH("fsync", cval.str, cval.len))
 		FLD_SET(conn->txn_logsync, WT_LOG_FSYNC);
+
+	WT_RET(__wt_config_gets(
+	    session, cfg, "transaction_sync.group_commit_delay", &cval));
+	conn->txn_logsync_delay = (uint64_t)cval.val;
 	return (0);
 }
 
@@ -98,10 +102,16 @@ __logmgr_config(WT_SESSION_IMPL *session, const char **cfg, int *runp)
 		FLD_SET(conn->log_flags, WT_CONN_LOG_PREALLOC);
 		conn->log_prealloc = 1;
 	}
+	WT_RET(__wt_config_gets(session, cfg, "log.recycle", &cval));
+	if (cval.val != 0)
+		FLD_SET(conn->log_flags, WT_CONN_LOG_RECYCLE);
 	WT_RET(__wt_config_gets_def(session, cfg, "log.recover", 0, &cval));
 	if (cval.len != 0  && WT_STRING_MATCH("error", cval.str, cval.len))
 		FLD_SET(conn->log_flags, WT_CONN_LOG_RECOVER_ERR);
 
+	WT_RET(__wt_config_gets(session, cfg, "log.recover_threads", &cval));
+	conn->log_recover_threads = (u_int)cval.val;
+
 	WT_RET(__logmgr_sync_cfg(session, cfg));
 	return (0);
 }
@@ -156,10 +166,13 @@ __log_archive_once(WT_SESSION_IMPL *session, uint32_t backup_file)
 		for (i = 0; i < logcount; i++) {
 			WT_ERR(__wt_log_extract_lognum(
 			    session, logfiles[i], &lognum));
-			if (lognum < min_lognum) {
+			if (lognum >= min_lognum)
+				continue;
+			if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_RECYCLE))
+				WT_ERR(__wt_log_recycle(session, lognum));
+			else
 				WT_ERR(__wt_log_remove(
 				    session, WT_LOG_FILENAME, lognum));
-			}
 		}
 	}
 	__wt_spin_unlock(session, &conn->hot_backup_lock);
@@ -228,8 +241,8 @@ __log_prealloc_once(WT_SESSION_IMPL *session)
 	 * Allocate up to the maximum number that we just computed and detected.
 	 */
 	for (i = reccount; i < (u_int)conn->log_prealloc; i++) {
-		WT_ERR(__wt_log_allocfile(
-		    session, ++log->prep_fileid, WT_LOG_PREPNAME, 1));
+		WT_ERR(__wt_log_allocfile(session,
+		    WT_ATOMIC_ADD4(log->prep_fileid, 1), WT_LOG_PREPNAME, 1));
 		WT_STAT_FAST_CONN_INCR(session, log_prealloc_files);
 	}
 
@@ -483,13 +496,8 @@ __log_server(void *arg)
 	locked = 0;
 	while (F_ISSET(conn, WT_CONN_LOG_SERVER_RUN)) {
 		/*
-		 * Perform log pre-allocation.
-		 */
-		if (conn->log_prealloc > 0)
-			WT_ERR(__log_prealloc_once(session));
-
-		/*
-		 * Perform the archive.
+		 * Perform the archive.  Archive before pre-allocating so any
+		 * recycled log files are counted as pre-allocated files.
 		 */
 		if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ARCHIVE)) {
 			if (__wt_try_writelock(
@@ -504,6 +512,13 @@ __log_server(void *arg)
 				    "log_archive: Blocked due to open log "
 				    "cursor holding archive lock"));
 		}
+
+		/*
+		 * Perform log pre-allocation.
+		 */
+		if (conn->log_prealloc > 0)
+			WT_ERR(__log_prealloc_once(session));
+
 		/* Wait until the next event. */
 		WT_ERR(__wt_cond_wait(session, conn->log_cond, WT_MILLION));
 	}
@@ -116,6 +116,8 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	WT_TRET(__wt_checkpoint_server_destroy(session));
 	WT_TRET(__wt_statlog_destroy(session, 1));
 	WT_TRET(__wt_sweep_destroy(session));
+	WT_TRET(__wt_update_prune_destroy(session));
+	WT_TRET(__wt_las_destroy(session));
 
 	/* Close open data handles. */
 	WT_TRET(__wt_conn_dhandle_discard(session));
@@ -163,7 +165,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	WT_TRET(__wt_cache_destroy(session));
 
 	/* Discard transaction state. */
-	__wt_txn_global_destroy(session);
+	WT_TRET(__wt_txn_global_destroy(session));
 
 	/* Close extensions, first calling any unload entry point. */
 	while ((dlh = TAILQ_FIRST(&conn->dlhqh)) != NULL) {
@@ -234,6 +236,9 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	 */
 	WT_RET(__wt_sweep_create(session));
 
+	/* Start the optional update prune thread. */
+	WT_RET(__wt_update_prune_create(session, cfg));
+
 	/*
 	 * Start the optional statistics thread.  Start statistics first so that
 	 * other optional threads can know if statistics are enabled or not.
@@ -248,6 +253,9 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	/* Run recovery. */
 	WT_RET(__wt_txn_recover(session));
 
+	/* Create the optional lookaside table, after recovery. */
+	WT_RET(__wt_las_create(session, cfg));
+
 	/*
 	 * Start the optional logging/archive thread.
 	 * NOTE: The log manager must be started before checkpoints so that the
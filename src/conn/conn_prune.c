@@ -0,0 +1,410 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * WT_PRUNE_STATS --
+ *	Update chain lengths seen during a prune pass.
+ */
+typedef struct {
+	uint64_t chains;		/* Chains pruned */
+	uint64_t updates;		/* Updates discarded */
+	uint64_t before, after;		/* Total chain length */
+	uint64_t max_before, max_after;	/* Maximum chain length */
+	uint64_t still_long;		/* Chains still long after pruning */
+} WT_PRUNE_STATS;
+
+/*
+ * __prune_chain --
+ *	Discard the obsolete updates from a single update chain.  Return if the
+ * chain is still long after pruning.
+ */
+static int
+__prune_chain(WT_SESSION_IMPL *session,
+    WT_PAGE *page, WT_UPDATE *upd, WT_PRUNE_STATS *stats)
+{
+	WT_UPDATE *obsolete, *next;
+	u_int after, before;
+
+	for (before = 0, next = upd; next != NULL; next = next->next)
+		++before;
+
+	/* A single update is never obsolete, don't count it. */
+	if (before < 2)
+		return (0);
+
+	obsolete = __wt_update_obsolete_check(session, NULL, upd);
+	for (after = 0, next = upd; next != NULL; next = next->next)
+		++after;
+	if (obsolete != NULL)
+		__wt_update_obsolete_free(session, page, obsolete);
+
+	++stats->chains;
+	stats->updates += before - after;
+	stats->before += before;
+	stats->after += after;
+	stats->max_before = WT_MAX(stats->max_before, before);
+	stats->max_after = WT_MAX(stats->max_after, after);
+	if (after < S2C(session)->prune_chain_max)
+		return (0);
+	++stats->still_long;
+	return (1);
+}
+
+/*
+ * __prune_insert_list --
+ *	Prune the update chains of an insert list.
+ */
+static int
+__prune_insert_list(WT_SESSION_IMPL *session,
+    WT_PAGE *page, WT_INSERT_HEAD *ins_head, WT_PRUNE_STATS *stats)
+{
+	WT_INSERT *ins;
+	int still_long;
+
+	still_long = 0;
+	if (ins_head != NULL)
+		WT_SKIP_FOREACH(ins, ins_head)
+			if (__prune_chain(session, page, ins->upd, stats))
+				still_long = 1;
+	return (still_long);
+}
+
+/*
+ * __prune_page --
+ *	Prune the update chains of a leaf page.  Return if any chain is still
+ * long after pruning.
+ */
+static int
+__prune_page(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PRUNE_STATS *stats)
+{
+	WT_INSERT_HEAD **ins_headp;
+	WT_UPDATE **updp;
+	uint32_t entries, i;
+	int still_long;
+
+	still_long = 0;
+	switch (page->type) {
+	case WT_PAGE_COL_FIX:
+	case WT_PAGE_COL_VAR:
+		if (__prune_insert_list(
+		    session, page, WT_COL_APPEND(page), stats))
+			still_long = 1;
+		if ((ins_headp = page->modify->mod_update) == NULL)
+			break;
+		entries =
+		    page->type == WT_PAGE_COL_FIX ? 1 : page->pg_var_entries;
+		for (i = 0; i < entries; ++i)
+			if (__prune_insert_list(
+			    session, page, ins_headp[i], stats))
+				still_long = 1;
+		break;
+	case WT_PAGE_ROW_LEAF:
+		/*
+		 * Row-store pages have one additional slot in the insert array
+		 * for keys that sort before keys found on the original page.
+		 */
+		if ((ins_headp = page->pg_row_ins) != NULL)
+			for (i = 0; i < page->pg_row_entries + 1; ++i)
+				if (__prune_insert_list(
+				    session, page, ins_headp[i], stats))
+					still_long = 1;
+		if ((updp = page->pg_row_upd) != NULL)
+			for (i = 0; i < page->pg_row_entries; ++i)
+				if (updp[i] != NULL && __prune_chain(
+				    session, page, updp[i], stats))
+					still_long = 1;
+		break;
+	}
+	return (still_long);
+}
+
+/*
+ * __prune_file --
+ *	Prune the in-memory pages of a file flagged as having long update
+ * chains.
+ */
+static int
+__prune_file(WT_SESSION_IMPL *session, WT_PRUNE_STATS *stats)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_REF *ref;
+	uint32_t flags;
+	int still_long;
+
+	btree = S2BT(session);
+	flags = WT_READ_CACHE | WT_READ_NO_EVICT |
+	    WT_READ_NO_GEN | WT_READ_NO_WAIT | WT_READ_SKIP_INTL;
+
+	for (ref = NULL;;) {
+		WT_ERR(__wt_tree_walk(session, &ref, NULL, flags));
+		if (ref == NULL)
+			break;
+
+		page = ref->page;
+		if (page->modify == NULL || !page->modify->prune_chain)
+			continue;
+
+		/*
+		 * Obsolete updates are discarded under the same lock as the
+		 * update path and reconciliation use: if we can't lock the
+		 * page, leave it for the next pass.
+		 */
+		F_CAS_ATOMIC(page, WT_PAGE_SCANNING, ret);
+		if (ret != 0) {
+			ret = 0;
+			btree->prune_pending = 1;
+			continue;
+		}
+		page->modify->prune_chain = 0;
+		still_long = __prune_page(session, page, stats);
+		F_CLR_ATOMIC(page, WT_PAGE_SCANNING);
+		WT_STAT_FAST_CONN_INCR(session, txn_prune_pages);
+
+		/*
+		 * If a running transaction still needs the updates, the page
+		 * won't be flagged again until the next update to it: keep it
+		 * flagged so we retry once the updates are obsolete.
+		 */
+		if (still_long) {
+			page->modify->prune_chain = 1;
+			btree->prune_pending = 1;
+		}
+	}
+
+err:	if (ref != NULL)
+		WT_TRET(__wt_page_release(session, ref, flags));
+	return (ret);
+}
+
+/*
+ * __prune_pass --
+ *	Prune the files flagged as having long update chains.
+ */
+static int
+__prune_pass(WT_SESSION_IMPL *session)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+	WT_PRUNE_STATS stats;
+
+	conn = S2C(session);
+	WT_CLEAR(stats);
+
+	WT_STAT_FAST_CONN_INCR(session, txn_prune_passes);
+
+	/* Prune as much as the running transactions allow. */
+	__wt_txn_update_oldest(session);
+
+	for (dhandle = NULL;;) {
+		/*
+		 * Lock the handle list to find the next flagged file, and bump
+		 * its reference count to keep it alive while we prune it.
+		 */
+		__wt_spin_lock(session, &conn->dhandle_lock);
+		if (dhandle == NULL)
+			dhandle = SLIST_FIRST(&conn->dhlh);
+		else {
+			(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+			dhandle = SLIST_NEXT(dhandle, l);
+		}
+		for (; dhandle != NULL; dhandle = SLIST_NEXT(dhandle, l))
+			if (WT_PREFIX_MATCH(dhandle->name, "file:") &&
+			    dhandle->checkpoint == NULL &&
+			    F_ISSET(dhandle, WT_DHANDLE_OPEN) &&
+			    ((WT_BTREE *)dhandle->handle)->prune_pending)
+				break;
+		if (dhandle != NULL)
+			(void)WT_ATOMIC_ADD4(dhandle->session_inuse, 1);
+		__wt_spin_unlock(session, &conn->dhandle_lock);
+		if (dhandle == NULL)
+			break;
+
+		/*
+		 * Lock the handle the same as an application cursor: if the
+		 * handle is locked exclusively (for example, it's being closed
+		 * or verified), skip it until the next pass.
+		 */
+		if ((ret = __wt_try_readlock(session, dhandle->rwlock)) != 0) {
+			if (ret == EBUSY) {
+				ret = 0;
+				continue;
+			}
+			break;
+		}
+		if (F_ISSET(dhandle, WT_DHANDLE_OPEN)) {
+			btree = dhandle->handle;
+			btree->prune_pending = 0;
+			WT_WITH_DHANDLE(session, dhandle,
+			    ret = __prune_file(session, &stats));
+		}
+		WT_TRET(__wt_readunlock(session, dhandle->rwlock));
+		if (ret != 0)
+			break;
+	}
+	if (dhandle != NULL)
+		(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+
+	WT_STAT_FAST_CONN_INCRV(session, txn_prune_chains, stats.chains);
+	WT_STAT_FAST_CONN_INCRV(session, txn_prune_updates, stats.updates);
+	WT_STAT_FAST_CONN_INCRV(session, txn_prune_chain_before, stats.before);
+	WT_STAT_FAST_CONN_INCRV(session, txn_prune_chain_after, stats.after);
+	WT_STAT_FAST_CONN_INCRV(
+	    session, txn_prune_chain_long, stats.still_long);
+	if (stats.chains != 0) {
+		WT_STAT_FAST_CONN_SET(
+		    session, txn_prune_chain_max_before, stats.max_before);
+		WT_STAT_FAST_CONN_SET(
+		    session, txn_prune_chain_max_after, stats.max_after);
+	}
+
+	return (ret);
+}
+
+/*
+ * __prune_server --
+ *	The update prune server thread.
+ */
+static void *
+__prune_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = arg;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN) &&
+	    F_ISSET(conn, WT_CONN_SERVER_PRUNE)) {
+		/* Wait until the next event. */
+		WT_ERR(__wt_cond_wait(
+		    session, conn->prune_cond, conn->prune_usecs));
+
+		/* Don't start a pass if we're shutting down. */
+		if (!F_ISSET(conn, WT_CONN_SERVER_PRUNE))
+			break;
+
+		/* Prune the flagged pages. */
+		WT_ERR(__prune_pass(session));
+	}
+
+	if (0) {
+err:		WT_PANIC_MSG(session, ret, "update prune server error");
+	}
+	return (NULL);
+}
+
+/*
+ * __prune_server_config --
+ *	Parse and setup the update prune server options.
+ */
+static int
+__prune_server_config(WT_SESSION_IMPL *session, const char **cfg, int *startp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	/*
+	 * The update prune configuration requires a wait time -- if it's not
+	 * set, we're not running at all.
+	 */
+	WT_RET(__wt_config_gets(session, cfg, "update_prune.wait", &cval));
+	conn->prune_usecs = (long)cval.val * WT_MILLION;
+	if (conn->prune_usecs == 0) {
+		*startp = 0;
+		return (0);
+	}
+	*startp = 1;
+
+	WT_RET(__wt_config_gets(session, cfg, "update_prune.chain_max", &cval));
+	conn->prune_chain_max = (u_int)cval.val;
+
+	return (0);
+}
+
+/*
+ * __wt_update_prune_create --
+ *	Configure and start the update prune server.
+ */
+int
+__wt_update_prune_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONNECTION_IMPL *conn;
+	int start;
+
+	conn = S2C(session);
+	start = 0;
+
+	/* If there is already a server running, shut it down. */
+	if (conn->prune_session != NULL)
+		WT_RET(__wt_update_prune_destroy(session));
+
+	WT_RET(__prune_server_config(session, cfg, &start));
+	if (!start)
+		return (0);
+
+	/* Set first, the thread might run before we finish up. */
+	F_SET(conn, WT_CONN_SERVER_PRUNE);
+
+	/* The update prune server gets its own session. */
+	WT_RET(__wt_open_internal_session(
+	    conn, "update-prune-server", 1, 1, &conn->prune_session));
+	session = conn->prune_session;
+
+	WT_RET(__wt_cond_alloc(
+	    session, "update prune server", 0, &conn->prune_cond));
+
+	WT_RET(__wt_thread_create(
+	    session, &conn->prune_tid, __prune_server, session));
+	conn->prune_tid_set = 1;
+
+	return (0);
+}
+
+/*
+ * __wt_update_prune_destroy --
+ *	Destroy the update prune server thread.
+ */
+int
+__wt_update_prune_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+
+	conn = S2C(session);
+
+	/* Stop flagging pages before the server goes away. */
+	conn->prune_chain_max = 0;
+
+	F_CLR(conn, WT_CONN_SERVER_PRUNE);
+	if (conn->prune_tid_set) {
+		WT_TRET(__wt_cond_signal(session, conn->prune_cond));
+		WT_TRET(__wt_thread_join(session, conn->prune_tid));
+		conn->prune_tid_set = 0;
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->prune_cond));
+
+	if (conn->prune_session != NULL) {
+		wt_session = &conn->prune_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+
+		conn->prune_session = NULL;
+	}
+	conn->prune_usecs = 0;
+
+	return (ret);
+}
@@ -124,6 +124,9 @@ __sweep_server(void *arg)
 
 		/* Sweep the handles. */
 		WT_ERR(__sweep(session));
+
+		/* Discard lookaside table records no reader can need. */
+		WT_ERR(__wt_las_sweep(session));
 	}
 
 	if (0) {
@@ -118,6 +118,7 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curbackup_close);		/* close */
 	WT_CURSOR *cursor;
@@ -214,9 +215,9 @@ __backup_start(
 	 * is open checkpoints aren't discarded.   We release the lock as soon
 	 * as we've set the flag, we don't want to block checkpoints, we just
 	 * want to make sure no checkpoints are deleted.  The checkpoint code
-	 * holds the lock until it's finished the checkpoint, otherwise we
-	 * could start a hot backup that would race with an already-started
-	 * checkpoint.
+	 * holds the lock, or the schema lock, until it's finished the
+	 * checkpoint, otherwise we could start a hot backup that would race
+	 * with an already-started checkpoint.
 	 */
 	__wt_spin_lock(session, &conn->hot_backup_lock);
 	conn->hot_backup = 1;
@@ -463,6 +463,7 @@ __wt_curds_open(
 	    __curds_insert,		/* insert */
 	    __curds_update,		/* update */
 	    __curds_remove,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curds_close);		/* close */
 	WT_CONFIG_ITEM cval, metadata;
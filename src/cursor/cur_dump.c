@@ -361,6 +361,7 @@ __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp)
 	    __curdump_insert,		/* insert */
 	    __curdump_update,		/* update */
 	    __curdump_remove,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curdump_close);		/* close */
 	WT_CURSOR *cursor;
@@ -287,6 +287,41 @@ err:	CURSOR_UPDATE_API_END(session, ret);
 	return (ret);
 }
 
+/*
+ * __curfile_modify --
+ *	WT_CURSOR->modify method for the btree cursor type.
+ */
+static int
+__curfile_modify(WT_CURSOR *cursor, WT_MODIFY *entries, int nentries)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	CURSOR_UPDATE_API_CALL(cursor, session, modify, cbt->btree);
+
+	/*
+	 * Modifications are byte-range edits of the value: they only make
+	 * sense for raw byte string values.
+	 */
+	if (strcmp(cursor->value_format, "u") != 0)
+		WT_ERR_MSG(session, ENOTSUP,
+		    "WT_CURSOR.modify only supported for 'u' value formats");
+	if (entries == NULL || nentries <= 0)
+		WT_ERR_MSG(session, EINVAL,
+		    "WT_CURSOR.modify requires one or more modifications");
+
+	WT_CURSOR_NEEDKEY(cursor);
+	WT_CURSOR_NOVALUE(cursor);
+
+	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor,
+	    __wt_btcur_modify(cbt, entries, nentries), ret);
+
+err:	CURSOR_UPDATE_API_END(session, ret);
+	return (ret);
+}
+
 /*
  * __wt_curfile_update_check --
  *	WT_CURSOR->update_check method for the btree cursor type.
@@ -398,6 +433,7 @@ __wt_curfile_create(WT_SESSION_IMPL *session,
 	    __curfile_insert,		/* insert */
 	    __curfile_update,		/* update */
 	    __curfile_remove,		/* remove */
+	    __curfile_modify,		/* modify */
 	    __wt_cursor_reconfigure,	/* reconfigure */
 	    __curfile_close);		/* close */
 	WT_BTREE *btree;
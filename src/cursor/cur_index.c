@@ -352,6 +352,7 @@ __wt_curindex_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curindex_close);		/* close */
 	WT_CURSOR_INDEX *cindex;
@@ -8,31 +8,30 @@
 
 #include "wt_internal.h"
 
+/* Simple structure for log operation type configuration searches. */
+typedef struct {
+	const char *name;
+	uint32_t optype;
+} WT_LOG_OPTYPE_NAME;
+
 /*
- * __curlog_logrec --
- *	Callback function from log_scan to get a log record.
+ * __curlog_record --
+ *	Position the cursor on a log record.
  */
 static int
-__curlog_logrec(WT_SESSION_IMPL *session,
-    WT_ITEM *logrec, WT_LSN *lsnp, void *cookie, int firstrecord)
+__curlog_record(WT_SESSION_IMPL *session,
+    WT_CURSOR_LOG *cl, WT_LSN *lsnp, const void *data, size_t size)
 {
-	WT_CURSOR_LOG *cl;
-
-	cl = cookie;
-	WT_UNUSED(firstrecord);
-
-	/* Set up the LSNs and take a copy of the log record for the cursor. */
+	/* Set up the LSN and take a copy of the log record for the cursor. */
 	*cl->cur_lsn = *lsnp;
-	*cl->next_lsn = *lsnp;
-	cl->next_lsn->offset += (wt_off_t)logrec->size;
-	WT_RET(__wt_buf_set(session, cl->logrec, logrec->data, logrec->size));
+	WT_RET(__wt_buf_set(session, cl->logrec, data, size));
 
 	/*
 	 * Read the log header.  Set up the step pointers to walk the
 	 * operations inside the record.  Get the record type.
 	 */
 	cl->stepp = LOG_SKIP_HEADER(cl->logrec->data);
-	cl->stepp_end = (uint8_t *)cl->logrec->data + logrec->size;
+	cl->stepp_end = (uint8_t *)cl->logrec->data + size;
 	WT_RET(__wt_logrec_read(session, &cl->stepp, cl->stepp_end,
 	    &cl->rectype));
 
@@ -58,6 +57,159 @@ __curlog_logrec(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __curlog_logrec --
+ *	Callback function from log_scan to get a log record.
+ */
+static int
+__curlog_logrec(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec, WT_LSN *lsnp, void *cookie, int firstrecord)
+{
+	WT_CURSOR_LOG *cl;
+
+	cl = cookie;
+	WT_UNUSED(firstrecord);
+
+	*cl->next_lsn = *lsnp;
+	cl->next_lsn->offset += (wt_off_t)logrec->size;
+	return (__curlog_record(session, cl, lsnp, logrec->data, logrec->size));
+}
+
+/*
+ * __curlog_op_peek --
+ *	Return the type, size and file ID of the next operation in a
+ *	transaction commit record, without stepping over it.
+ */
+static int
+__curlog_op_peek(WT_SESSION_IMPL *session, const uint8_t *p,
+    const uint8_t *end, uint32_t *optypep, uint32_t *opsizep, uint32_t *fileidp)
+{
+	/* Every operation type starts with the file ID. */
+	return (__wt_struct_unpack(session, p, WT_PTRDIFF(end, p),
+	    WT_UNCHECKED_STRING(III), optypep, opsizep, fileidp));
+}
+
+/*
+ * __curlog_op_match --
+ *	Return if an operation passes the cursor's filters.
+ */
+static int
+__curlog_op_match(WT_CURSOR_LOG *cl, uint32_t optype, uint32_t fileid)
+{
+	u_int i;
+
+	if (cl->opmask != 0 &&
+	    (optype >= 32 || (cl->opmask & (1U << optype)) == 0))
+		return (0);
+	if (cl->nfileids == 0)
+		return (1);
+	for (i = 0; i < cl->nfileids; i++)
+		if (cl->fileids[i] == fileid)
+			return (1);
+	return (0);
+}
+
+/*
+ * __curlog_logrec_batch --
+ *	Callback function from log_scan to add a log record to the cursor's
+ *	batch of records.
+ */
+static int
+__curlog_logrec_batch(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec, WT_LSN *lsnp, void *cookie, int firstrecord)
+{
+	WT_CURSOR_LOG *cl;
+	size_t len;
+	uint32_t fileid, opsize, optype, rectype, size;
+	uint64_t txnid;
+	uint8_t *p;
+	const uint8_t *end, *recp;
+	int match;
+
+	cl = cookie;
+	WT_UNUSED(firstrecord);
+
+	/* Records from the stop LSN on aren't returned. */
+	if (LOG_CMP(lsnp, &cl->stop_lsn) >= 0)
+		return (WT_NOTFOUND);
+
+	/* The next scan starts after this record, even if we skip it. */
+	*cl->next_lsn = *lsnp;
+	cl->next_lsn->offset += (wt_off_t)logrec->size;
+
+	/*
+	 * If we're filtering, only transaction commit records including at
+	 * least one operation passing the filters are returned.  Filter here,
+	 * while scanning the log, so skipped records are never copied.
+	 */
+	if (F_ISSET(cl, WT_CURLOG_FILTER)) {
+		recp = LOG_SKIP_HEADER(logrec->data);
+		end = (const uint8_t *)logrec->data + logrec->size;
+		WT_RET(__wt_logrec_read(session, &recp, end, &rectype));
+		if (rectype != WT_LOGREC_COMMIT)
+			return (0);
+		WT_RET(__wt_vunpack_uint(
+		    &recp, WT_PTRDIFF(end, recp), &txnid));
+		for (match = 0; !match && recp < end && *recp != 0;
+		    recp += opsize) {
+			WT_RET(__curlog_op_peek(
+			    session, recp, end, &optype, &opsize, &fileid));
+			match = __curlog_op_match(cl, optype, fileid);
+		}
+		if (!match)
+			return (0);
+	}
+
+	/*
+	 * Append the record to the batch, preceded by its LSN and size.
+	 */
+	len = cl->batch->size;
+	size = (uint32_t)logrec->size;
+	WT_RET(__wt_buf_grow(session, cl->batch,
+	    len + sizeof(WT_LSN) + sizeof(uint32_t) + size));
+	p = (uint8_t *)cl->batch->mem + len;
+	memcpy(p, lsnp, sizeof(WT_LSN));
+	p += sizeof(WT_LSN);
+	memcpy(p, &size, sizeof(uint32_t));
+	p += sizeof(uint32_t);
+	memcpy(p, logrec->data, size);
+	cl->batch->size = len + sizeof(WT_LSN) + sizeof(uint32_t) + size;
+
+	/* Return WT_NOTFOUND to end the scan once the batch is full. */
+	return (++cl->batch_count < cl->batch_max ? 0 : WT_NOTFOUND);
+}
+
+/*
+ * __curlog_read --
+ *	Position the cursor on the next log record, reading another batch of
+ *	records if the cursor has returned all the records in the last one.
+ */
+static int
+__curlog_read(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl)
+{
+	WT_LSN lsn;
+	uint32_t size;
+	const uint8_t *p;
+
+	if (cl->batch_next >= cl->batch->size) {
+		cl->batch->size = 0;
+		cl->batch_next = 0;
+		cl->batch_count = 0;
+		WT_RET(__wt_log_scan(session, cl->next_lsn, WT_LOGSCAN_BATCH,
+		    __curlog_logrec_batch, cl));
+		if (cl->batch_count == 0)
+			return (WT_NOTFOUND);
+	}
+
+	p = (const uint8_t *)cl->batch->data + cl->batch_next;
+	memcpy(&lsn, p, sizeof(WT_LSN));
+	p += sizeof(WT_LSN);
+	memcpy(&size, p, sizeof(uint32_t));
+	p += sizeof(uint32_t);
+	cl->batch_next += sizeof(WT_LSN) + sizeof(uint32_t) + size;
+	return (__curlog_record(session, cl, &lsn, p, size));
+}
+
 /*
  * __curlog_compare --
  *	WT_CURSOR.compare method for the log cursor type.
@@ -130,6 +282,14 @@ __curlog_op_read(WT_SESSION_IMPL *session,
 		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
 		WT_RET(__wt_buf_set(session, cl->opvalue, NULL, 0));
 		break;
+	case WT_LOGOP_ROW_MODIFY:
+		/* The value is the packed list of modifications. */
+		WT_RET(__wt_logop_row_modify_unpack(session, &pp, end,
+		    fileid, &key, &value));
+		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
+		WT_RET(__wt_buf_set(session,
+		    cl->opvalue, value.data, value.size));
+		break;
 	default:
 		/*
 		 * Any other operations return the record in the value
@@ -225,20 +385,40 @@ __curlog_next(WT_CURSOR *cursor)
 	WT_CURSOR_LOG *cl;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	uint32_t fileid, opsize, optype;
 
 	cl = (WT_CURSOR_LOG *)cursor;
 
 	CURSOR_API_CALL(cursor, session, next, NULL);
 
-	/*
-	 * If we don't have a record, or went to the end of the record we
-	 * have, or we are in the zero-fill portion of the record, get a
-	 * new one.
-	 */
-	if (cl->stepp == NULL || cl->stepp >= cl->stepp_end || !*cl->stepp) {
-		cl->txnid = 0;
-		WT_ERR(__wt_log_scan(session, cl->next_lsn, WT_LOGSCAN_ONE,
-		    __curlog_logrec, cl));
+	for (;;) {
+		/*
+		 * If we don't have a record, or went to the end of the record
+		 * we have, or we are in the zero-fill portion of the record,
+		 * get a new one.
+		 */
+		if (cl->stepp == NULL ||
+		    cl->stepp >= cl->stepp_end || !*cl->stepp) {
+			cl->txnid = 0;
+			WT_ERR(__curlog_read(session, cl));
+		}
+		if (!F_ISSET(cl, WT_CURLOG_FILTER))
+			break;
+
+		/*
+		 * If we're filtering, skip the transaction commit record
+		 * itself and any of its operations not passing the filters.
+		 */
+		if (cl->step_count == 0) {
+			cl->step_count = 1;
+			continue;
+		}
+		WT_ERR(__curlog_op_peek(session,
+		    cl->stepp, cl->stepp_end, &optype, &opsize, &fileid));
+		if (__curlog_op_match(cl, optype, fileid))
+			break;
+		cl->stepp += opsize;
+		++cl->step_count;
 	}
 	WT_ASSERT(session, cl->logrec->data != NULL);
 	WT_ERR(__curlog_kv(session, cursor));
@@ -271,6 +451,7 @@ __curlog_search(WT_CURSOR *cursor)
 	 */
 	WT_ERR(__wt_cursor_get_key((WT_CURSOR *)cl,
 	    &key.file, &key.offset, &counter));
+	cl->batch->size = cl->batch_next = 0;
 	WT_ERR(__wt_log_scan(session, &key, WT_LOGSCAN_ONE,
 	    __curlog_logrec, cl));
 	WT_ERR(__curlog_kv(session, cursor));
@@ -292,8 +473,9 @@ __curlog_reset(WT_CURSOR *cursor)
 	cl = (WT_CURSOR_LOG *)cursor;
 	cl->stepp = cl->stepp_end = NULL;
 	cl->step_count = 0;
+	cl->batch->size = cl->batch_next = 0;
 	WT_INIT_LSN(cl->cur_lsn);
-	WT_INIT_LSN(cl->next_lsn);
+	*cl->next_lsn = cl->start_lsn;
 	return (0);
 }
 
@@ -322,6 +504,8 @@ __curlog_close(WT_CURSOR *cursor)
 	__wt_scr_free(session, &cl->logrec);
 	__wt_scr_free(session, &cl->opkey);
 	__wt_scr_free(session, &cl->opvalue);
+	__wt_scr_free(session, &cl->batch);
+	__wt_free(session, cl->fileids);
 	__wt_free(session, cl->packed_key);
 	__wt_free(session, cl->packed_value);
 	WT_TRET(__wt_cursor_close(cursor));
@@ -329,6 +513,158 @@ __curlog_close(WT_CURSOR *cursor)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __curlog_target_file --
+ *	Add a file to the list of files a log cursor returns operations on.
+ */
+static int
+__curlog_target_file(
+    WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl, const char *uri)
+{
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	char *config;
+
+	if (!WT_PREFIX_MATCH(uri, "file:"))
+		WT_RET_MSG(session, EINVAL,
+		    "%s: log cursor targets must be stored in files", uri);
+
+	if ((ret = __wt_metadata_search(session, uri, &config)) == WT_NOTFOUND)
+		WT_RET_MSG(session, ENOENT, "%s: log cursor target not found",
+		    uri);
+	WT_RET(ret);
+	WT_ERR(__wt_config_getones(session, config, "id", &cval));
+	WT_ERR(__wt_realloc_def(session,
+	    &cl->fileids_alloc, cl->nfileids + 1, &cl->fileids));
+	cl->fileids[cl->nfileids++] = (uint32_t)cval.val;
+
+err:	__wt_free(session, config);
+	return (ret);
+}
+
+/*
+ * __curlog_target --
+ *	Build the list of files a log cursor returns operations on from the
+ *	cursor's targets.
+ */
+static int
+__curlog_target(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl, const char *cfg[])
+{
+	WT_CONFIG targetconf;
+	WT_CONFIG_ITEM cval, k, v;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_TABLE *table;
+	u_int i;
+	const char *tablename, *uri;
+
+	WT_RET(__wt_config_gets(session, cfg, "target", &cval));
+	WT_RET(__wt_config_subinit(session, &targetconf, &cval));
+	WT_RET(__wt_scr_alloc(session, 512, &tmp));
+	while ((ret = __wt_config_next(&targetconf, &k, &v)) == 0) {
+		WT_ERR(__wt_buf_fmt(session, tmp, "%.*s", (int)k.len, k.str));
+		uri = tmp->data;
+		if (v.len != 0)
+			WT_ERR_MSG(session, EINVAL,
+			    "%s: invalid log cursor target: URIs may need "
+			    "quoting", uri);
+
+		/*
+		 * Operations on a table are logged against the files holding
+		 * its column groups.
+		 */
+		tablename = uri;
+		if (WT_PREFIX_SKIP(tablename, "table:")) {
+			if ((ret = __wt_schema_get_table(session, tablename,
+			    strlen(tablename), 0, &table)) == WT_NOTFOUND)
+				WT_ERR_MSG(session, ENOENT,
+				    "%s: log cursor target not found", uri);
+			WT_ERR(ret);
+			for (i = 0; i < WT_COLGROUPS(table) && ret == 0; i++)
+				ret = __curlog_target_file(
+				    session, cl, table->cgroups[i]->source);
+			__wt_schema_release_table(session, table);
+			WT_ERR(ret);
+		} else
+			WT_ERR(__curlog_target_file(session, cl, uri));
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+err:	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
+/*
+ * __curlog_lsn_config --
+ *	Parse a log sequence number configuration string.
+ */
+static int
+__curlog_lsn_config(WT_SESSION_IMPL *session,
+    const char *cfg[], const char *name, WT_LSN *lsnp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_LOG *log;
+
+	log = S2C(session)->log;
+
+	WT_RET(__wt_config_gets(session, cfg, name, &cval));
+	if (cval.len == 0)
+		return (0);
+	if (cval.type != WT_CONFIG_ITEM_STRUCT ||
+	    sscanf(cval.str, "(%" PRIu32 ",%" PRIdMAX ")",
+	    &lsnp->file, (intmax_t *)&lsnp->offset) != 2 ||
+	    lsnp->offset < 0 || lsnp->offset % log->allocsize != 0)
+		WT_RET_MSG(session, EINVAL,
+		    "%s: invalid log sequence number '%.*s'",
+		    name, (int)cval.len, cval.str);
+	return (0);
+}
+
+/*
+ * __curlog_config --
+ *	Configure a log cursor.
+ */
+static int
+__curlog_config(WT_SESSION_IMPL *session, WT_CURSOR_LOG *cl, const char *cfg[])
+{
+	static const WT_LOG_OPTYPE_NAME optypes[] = {
+		{ "col_put",		WT_LOGOP_COL_PUT },
+		{ "col_remove",		WT_LOGOP_COL_REMOVE },
+		{ "col_truncate",	WT_LOGOP_COL_TRUNCATE },
+		{ "row_modify",		WT_LOGOP_ROW_MODIFY },
+		{ "row_put",		WT_LOGOP_ROW_PUT },
+		{ "row_remove",		WT_LOGOP_ROW_REMOVE },
+		{ "row_truncate",	WT_LOGOP_ROW_TRUNCATE },
+		{ NULL, 0 }
+	};
+	WT_CONFIG_ITEM cval, sval;
+	WT_DECL_RET;
+	const WT_LOG_OPTYPE_NAME *ft;
+
+	WT_RET(__wt_config_gets(session, cfg, "log_batch", &cval));
+	cl->batch_max = (u_int)cval.val;
+
+	WT_RET(__wt_config_gets(session, cfg, "log_operations", &cval));
+	for (ft = optypes; ft->name != NULL; ft++) {
+		if ((ret = __wt_config_subgets(
+		    session, &cval, ft->name, &sval)) == 0 && sval.val != 0)
+			cl->opmask |= 1U << ft->optype;
+		WT_RET_NOTFOUND_OK(ret);
+	}
+
+	WT_RET(__curlog_target(session, cl, cfg));
+	if (cl->opmask != 0 || cl->nfileids != 0)
+		F_SET(cl, WT_CURLOG_FILTER);
+
+	WT_INIT_LSN(&cl->start_lsn);
+	WT_RET(__curlog_lsn_config(
+	    session, cfg, "log_start_lsn", &cl->start_lsn));
+	WT_MAX_LSN(&cl->stop_lsn);
+	WT_RET(__curlog_lsn_config(
+	    session, cfg, "log_stop_lsn", &cl->stop_lsn));
+	return (0);
+}
+
 /*
  * __wt_curlog_open --
  *	Initialize a log cursor.
@@ -353,6 +689,7 @@ __wt_curlog_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curlog_close);		/* close */
 	WT_CURSOR *cursor;
@@ -377,11 +714,13 @@ __wt_curlog_open(WT_SESSION_IMPL *session,
 	WT_ERR(__wt_scr_alloc(session, 0, &cl->logrec));
 	WT_ERR(__wt_scr_alloc(session, 0, &cl->opkey));
 	WT_ERR(__wt_scr_alloc(session, 0, &cl->opvalue));
+	WT_ERR(__wt_scr_alloc(session, 0, &cl->batch));
 	cursor->key_format = LOGC_KEY_FORMAT;
 	cursor->value_format = LOGC_VALUE_FORMAT;
 
+	WT_ERR(__curlog_config(session, cl, cfg));
 	WT_INIT_LSN(cl->cur_lsn);
-	WT_INIT_LSN(cl->next_lsn);
+	*cl->next_lsn = cl->start_lsn;
 
 	WT_ERR(__wt_cursor_init(cursor, uri, NULL, cfg, cursorp));
 
@@ -397,6 +736,8 @@ err:		if (F_ISSET(cursor, WT_CURSTD_OPEN))
 			__wt_scr_free(session, &cl->logrec);
 			__wt_scr_free(session, &cl->opkey);
 			__wt_scr_free(session, &cl->opvalue);
+			__wt_scr_free(session, &cl->batch);
+			__wt_free(session, cl->fileids);
 			/*
 			 * NOTE:  We cannot get on the error path with the
 			 * readlock held.  No need to unlock it unless that
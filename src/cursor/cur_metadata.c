@@ -418,6 +418,7 @@ __wt_curmetadata_open(WT_SESSION_IMPL *session,
 	    __curmetadata_insert,	/* insert */
 	    __curmetadata_update,	/* update */
 	    __curmetadata_remove,	/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curmetadata_close);	/* close */
 	WT_CURSOR *cursor;
@@ -447,6 +448,7 @@ __wt_curmetadata_open(WT_SESSION_IMPL *session,
 		cursor->insert = __wt_cursor_notsup;
 		cursor->update = __wt_cursor_notsup;
 		cursor->remove = __wt_cursor_notsup;
+		cursor->modify = __wt_cursor_modify_notsup;
 	}
 
 	if (0) {
@@ -281,6 +281,25 @@ __curstat_search(WT_CURSOR *cursor)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __curstat_free --
+ *	Free the memory owned by a statistics cursor.
+ */
+static void
+__curstat_free(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
+{
+	int i;
+
+	__wt_buf_free(session, &cst->pv);
+
+	/* Conflict keys are appended to a copy of the statistics. */
+	if (cst->conflict_stats != NULL) {
+		for (i = cst->conflict_first; i < cst->stats_count; ++i)
+			__wt_free(session, cst->conflict_stats[i].desc);
+		__wt_free(session, cst->conflict_stats);
+	}
+}
+
 /*
  * __curstat_close --
  *	WT_CURSOR->close method for the statistics cursor type.
@@ -295,7 +314,7 @@ __curstat_close(WT_CURSOR *cursor)
 	cst = (WT_CURSOR_STAT *)cursor;
 	CURSOR_API_CALL(cursor, session, close, NULL);
 
-	__wt_buf_free(session, &cst->pv);
+	__curstat_free(session, cst);
 
 	WT_ERR(__wt_cursor_close(cursor));
 
@@ -350,6 +369,9 @@ __curstat_file_init(WT_SESSION_IMPL *session,
 		if (F_ISSET(cst, WT_CONN_STAT_CLEAR))
 			__wt_stat_refresh_dsrc_stats(&dhandle->stats);
 		__wt_curstat_dsrc_final(cst);
+
+		/* Append any keys with update conflicts. */
+		ret = __wt_conflict_stat_init(session, cst);
 	}
 
 	/* Release the handle, we're done with it. */
@@ -433,6 +455,7 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* insert */
 	    __wt_cursor_notsup,		/* update */
 	    __wt_cursor_notsup,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curstat_close);		/* close */
 	WT_CONFIG_ITEM cval, sval;
@@ -443,6 +466,7 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 	WT_STATIC_ASSERT(offsetof(WT_CURSOR_STAT, iface) == 0);
 
 	conn = S2C(session);
+	cst = NULL;
 
 	WT_ERR(__wt_calloc_one(session, &cst));
 	cursor = &cst->iface;
@@ -509,7 +533,10 @@ config_err:	WT_ERR_MSG(session, EINVAL,
 	}
 
 	if (0) {
-err:		__wt_free(session, cst);
+err:		if (cst != NULL) {
+			__curstat_free(session, cst);
+			__wt_free(session, cst);
+		}
 	}
 
 	return (ret);
@@ -20,6 +20,20 @@ __wt_cursor_notsup(WT_CURSOR *cursor)
 	return (ENOTSUP);
 }
 
+/*
+ * __wt_cursor_modify_notsup --
+ *	Unsupported cursor modify.
+ */
+int
+__wt_cursor_modify_notsup(WT_CURSOR *cursor, WT_MODIFY *entries, int nentries)
+{
+	WT_UNUSED(cursor);
+	WT_UNUSED(entries);
+	WT_UNUSED(nentries);
+
+	return (ENOTSUP);
+}
+
 /*
  * __wt_cursor_noop --
  *	Cursor noop.
@@ -56,6 +70,7 @@ __wt_cursor_set_notsup(WT_CURSOR *cursor)
 	cursor->insert = __wt_cursor_notsup;
 	cursor->update = __wt_cursor_notsup;
 	cursor->remove = __wt_cursor_notsup;
+	cursor->modify = __wt_cursor_modify_notsup;
 }
 
 /*
@@ -624,6 +639,7 @@ __wt_cursor_init(WT_CURSOR *cursor,
 		cursor->insert = __wt_cursor_notsup;
 		cursor->update = __wt_cursor_notsup;
 		cursor->remove = __wt_cursor_notsup;
+		cursor->modify = __wt_cursor_modify_notsup;
 	} else {
 		WT_RET(
 		    __wt_config_gets_def(session, cfg, "readonly", 0, &cval));
@@ -631,6 +647,7 @@ __wt_cursor_init(WT_CURSOR *cursor,
 			cursor->insert = __wt_cursor_notsup;
 			cursor->update = __wt_cursor_notsup;
 			cursor->remove = __wt_cursor_notsup;
+			cursor->modify = __wt_cursor_modify_notsup;
 		}
 	}
 
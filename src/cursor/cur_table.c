@@ -90,8 +90,9 @@ __apply_idx(WT_CURSOR_TABLE *ctable, size_t func_off, int skip_immutable) {
 	    __wt_cursor_notsup,		/* search-near */
 	    __curextract_insert,	/* insert */
 	    __wt_cursor_notsup,		/* update */
-	    __wt_cursor_notsup,		/* reconfigure */
 	    __wt_cursor_notsup,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
+	    __wt_cursor_notsup,		/* reconfigure */
 	    __wt_cursor_notsup);	/* close */
 	WT_CURSOR **cp;
 	WT_CURSOR_EXTRACTOR extract_cursor;
@@ -848,6 +849,7 @@ __wt_curtable_open(WT_SESSION_IMPL *session,
 	    __curtable_insert,		/* insert */
 	    __curtable_update,		/* update */
 	    __curtable_remove,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_reconfigure,	/* reconfigure */
 	    __curtable_close);		/* close */
 	WT_CONFIG_ITEM cval;
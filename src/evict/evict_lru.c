@@ -1203,7 +1203,8 @@ fast:		/* If the page can't be evicted, give up. */
 		mod = page->modify;
 		if (!modified && mod != NULL && !LF_ISSET(
 		    WT_EVICT_PASS_AGGRESSIVE | WT_EVICT_PASS_WOULD_BLOCK) &&
-		    !__wt_txn_visible_all(session, mod->rec_max_txn))
+		    !__wt_txn_visible_all(session, mod->rec_max_txn) &&
+		    !__wt_page_las_evict(session, page))
 			continue;
 
 		/*
@@ -1218,11 +1219,15 @@ fast:		/* If the page can't be evicted, give up. */
 		 * forced eviction, try anyway: maybe a transaction that was
 		 * running last time we wrote the page has since rolled back,
 		 * or we can help get the checkpoint completed sooner.
+		 *
+		 * Pages that can be written using the lookaside table don't
+		 * need their updates to be globally visible.
 		 */
 		if (modified && !LF_ISSET(
 		    WT_EVICT_PASS_AGGRESSIVE | WT_EVICT_PASS_WOULD_BLOCK) &&
 		    (mod->disk_snap_min == S2C(session)->txn_global.oldest_id ||
-		    !__wt_txn_visible_all(session, mod->update_txn)))
+		    !__wt_txn_visible_all(session, mod->update_txn)) &&
+		    !__wt_page_las_evict(session, page))
 			continue;
 
 		WT_ASSERT(session, evict->ref == NULL);
@@ -442,7 +442,25 @@ __evict_review(WT_SESSION_IMPL *session, WT_REF *ref,
 	 *
 	 * Don't set the update-restore flag for internal pages, they don't
 	 * have updates that can be saved and restored.
+	 *
+	 * Otherwise, if the top-level page is a leaf page with updates running
+	 * transactions may still need, but all of which are committed, set the
+	 * lookaside flag: reconciliation writes the newest committed values to
+	 * the page and older versions to the lookaside table.  A clean page may
+	 * also be holding old versions in memory (it was written while they
+	 * were still needed), mark it dirty so it's written again.  Sessions
+	 * with a transaction ID don't write pages using the lookaside table,
+	 * the oldest running ID they see doesn't include their own updates.
 	 */
+	if (!exclusive && top && page->read_gen != WT_READGEN_OLDEST &&
+	    !F_ISSET(&session->txn, TXN_HAS_ID) &&
+	    __wt_page_las_evict(session, page) &&
+	    !__wt_txn_visible_all(session, __wt_page_is_modified(page) ?
+	    mod->update_txn : mod->rec_max_txn)) {
+		if (!__wt_page_is_modified(page))
+			__wt_page_modify_set(session, page);
+		LF_SET(WT_SKIP_UPDATE_LAS);
+	}
 	if (__wt_page_is_modified(page)) {
 		if (exclusive)
 			LF_SET(WT_SKIP_UPDATE_ERR);
@@ -6,17 +6,48 @@
  * See the file LICENSE for redistribution information.
  */
 
+/*
+ * Blocked Bloom filters set all of an item's bits in a single block the size of
+ * a cache line, so a lookup costs at most one cache miss.  The filter is stored
+ * as a sequence of fixed-size records, and loaded into memory to be read.
+ */
+#define	WT_BLOOM_BLOCK_SIZE	64		/* Bytes per block */
+#define	WT_BLOOM_BLOCK_BITS	(WT_BLOOM_BLOCK_SIZE * 8)
+#define	WT_BLOOM_RECORD_SIZE	4096		/* Bytes per stored record */
+
+/*
+ * Loaded filters can't be evicted: they're limited to a tenth of the cache
+ * size, filters that don't fit are read from disk.
+ */
+#define	WT_BLOOM_BLOCKS_MAX(conn)	((conn)->cache_size / 10)
+
 struct __wt_bloom {
 	const char *uri;
 	char *config;
 	uint8_t *bitstring;     /* For in memory representation. */
 	WT_SESSION_IMPL *session;
 	WT_CURSOR *c;
+	WT_BLOOM_BLOCKS *blocks;/* Blocked filter loaded into memory. */
 
 	uint32_t k;		/* The number of hash functions used. */
 	uint32_t factor;	/* The number of bits per item inserted. */
 	uint64_t m;		/* The number of slots in the bit string. */
 	uint64_t n;		/* The number of items to be inserted. */
+
+#define	WT_BLOOM_BLOCKED	0x01	/* Blocked filter */
+	uint32_t flags;
+};
+
+/*
+ * WT_BLOOM_BLOCKS --
+ *	A blocked Bloom filter loaded into memory, shared by the handles reading
+ * the filter.
+ */
+struct __wt_bloom_blocks {
+	void	*mem;		/* Allocated memory */
+	size_t	 memsize;	/* Allocated memory size */
+	uint8_t	*bitmap;	/* Cache-line aligned bitmap */
+	uint64_t nblocks;	/* Number of blocks in the bitmap */
 };
 
 struct __wt_bloom_hash {
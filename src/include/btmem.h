@@ -166,6 +166,46 @@ struct __wt_ovfl_txnc {
 	WT_OVFL_TXNC *next[0];		/* Forward-linked skip list */
 };
 
+/*
+ * WT_ARENA_BLOCK --
+ *	A block of memory in a page arena.
+ */
+struct __wt_arena_block {
+	WT_ARENA_BLOCK *next;		/* Arena's list of blocks */
+	size_t size;			/* Block size */
+	volatile uint64_t used;		/* Bytes allocated from the block */
+
+	/*
+	 * The block's memory immediately follows the WT_ARENA_BLOCK structure.
+	 */
+#define	WT_ARENA_BLOCK_MEM(b)						\
+	((uint8_t *)(b) + sizeof(WT_ARENA_BLOCK))
+};
+
+/*
+ * WT_ARENA --
+ *	Memory for the inserts and updates on a page, allocated from blocks
+ * without locking and freed all at once when the last page sharing the arena
+ * is discarded.  Allocations are spread across stripes of blocks, selected
+ * by session, so concurrent writers don't contend on a single block.
+ */
+struct __wt_arena {
+	volatile uint32_t ref;		/* Pages sharing the arena */
+
+	/*
+	 * Updates of existing keys are allocated from the heap: if the pages
+	 * sharing the arena have any, they're freed when the pages are.
+	 */
+	uint32_t heap_updates;
+
+#define	WT_ARENA_BLOCK_MIN	(4 * 1024)
+#define	WT_ARENA_BLOCK_MAX	(256 * 1024)
+	WT_ARENA_BLOCK * volatile blocks;	/* All blocks */
+
+#define	WT_ARENA_STRIPES	8
+	WT_ARENA_BLOCK * volatile stripe[WT_ARENA_STRIPES];
+};
+
 /*
  * WT_PAGE_MODIFY --
  *	When a page is modified, there's additional information to maintain.
@@ -334,6 +374,15 @@ struct __wt_page_modify {
 		size_t	  discard_allocated;
 	} *ovfl_track;
 
+	/*
+	 * Inserts and updates on the page are allocated from an arena shared
+	 * with any pages split from it, if the tree is configured for it.
+	 * The arena's blocks, rather than the items allocated from them, are
+	 * charged to the page's memory footprint.
+	 */
+	WT_ARENA *arena;
+	uint64_t arena_bytes;		/* Arena blocks charged to the page */
+
 	/*
 	 * The write generation is incremented when a page is modified, a page
 	 * is clean if the write generation is 0.
@@ -344,6 +393,12 @@ struct __wt_page_modify {
 	 */
 	uint32_t write_gen;
 
+	/*
+	 * Set when an update chain on the page reaches the configured length,
+	 * the update prune server clears it after pruning the page.
+	 */
+	uint8_t prune_chain;
+
 #define	WT_PAGE_LOCK(s, p)						\
 	__wt_spin_lock((s), &S2C(s)->page_lock[(p)->modify->page_lock])
 #define	WT_PAGE_UNLOCK(s, p)						\
@@ -834,6 +889,11 @@ struct __wt_ikey {
  * the page.  A slot points to a WT_UPDATE structure; if more than one update
  * is done for an entry, WT_UPDATE structures are formed into a forward-linked
  * list.
+ *
+ * Row-store updates created by WT_CURSOR::modify may be stored as a list of
+ * changes to the previous value rather than as a complete value, the value
+ * is built by applying the changes, newest last, to the most recent complete
+ * value in the list: see __wt_update_value.
  */
 WT_PACKED_STRUCT_BEGIN(__wt_update)
 	uint64_t txnid;			/* update transaction */
@@ -851,6 +911,30 @@ WT_PACKED_STRUCT_BEGIN(__wt_update)
 	(sizeof(WT_UPDATE) + (WT_UPDATE_DELETED_ISSET(upd) ? 0 : (upd)->size))
 	uint32_t size;			/* update length */
 
+	/*
+	 * Standard updates hold a complete value; modified updates hold a
+	 * packed list of byte-range modifications to be applied to the value
+	 * built from the subsequent updates in the list.
+	 */
+#define	WT_UPDATE_STANDARD	0
+#define	WT_UPDATE_MODIFIED	1
+#define	WT_UPDATE_DELETED	2
+#define	WT_UPDATE_MODIFIED_ISSET(upd)					\
+	((upd)->type == WT_UPDATE_MODIFIED)
+	/*
+	 * Limit the number of modified updates stacked on a complete value so
+	 * readers don't rebuild values from arbitrarily long lists.
+	 */
+#define	WT_MODIFY_UPDATE_MAX	10
+	uint8_t type;			/* update type */
+
+	/*
+	 * Updates allocated from a page's arena are freed with the arena, and
+	 * their memory is charged to the page with the arena's blocks.
+	 */
+#define	WT_UPDATE_ARENA		0x01
+	uint8_t flags;
+
 	/* The untyped value immediately follows the WT_UPDATE structure. */
 #define	WT_UPDATE_DATA(upd)						\
 	((void *)((uint8_t *)(upd) + sizeof(WT_UPDATE)))
@@ -57,6 +57,16 @@
 /* Evict pages if we see this many consecutive deleted records. */
 #define	WT_BTREE_DELETE_THRESHOLD	1000
 
+/*
+ * WT_CONFLICT_KEY --
+ *	A key on which update conflicts have been seen.
+ */
+struct __wt_conflict_key {
+	WT_ITEM  key;			/* Key or record number */
+	uint64_t count;			/* Estimated conflicts */
+	uint64_t error;			/* Maximum over-estimate */
+};
+
 /*
  * WT_BTREE --
  *	A btree handle.
@@ -119,6 +129,7 @@ struct __wt_btree {
 	WT_REF root;			/* Root page reference */
 	int modified;			/* If the tree ever modified */
 	int bulk_load_ok;		/* Bulk-load is a possibility */
+	int page_arena;			/* Allocate updates from page arenas */
 
 	WT_BM	*bm;			/* Block manager reference */
 	u_int	 block_header;		/* WT_PAGE_HEADER_BYTE_SIZE */
@@ -132,6 +143,7 @@ struct __wt_btree {
 	volatile uint32_t evict_busy;	/* Count of threads in eviction */
 
 	int checkpointing;		/* Checkpoint in progress */
+	int prune_pending;		/* Long update chains to prune */
 
 	/*
 	 * We flush pages from the tree (in order to make checkpoint faster),
@@ -140,13 +152,24 @@ struct __wt_btree {
 	 */
 	WT_SPINLOCK	flush_lock;	/* Lock to flush the tree's pages */
 
+	/*
+	 * Keys with the most update conflicts, maintained as a "space-saving"
+	 * sketch: when the sketch is full, a new key replaces the key with the
+	 * fewest conflicts and inherits its count.
+	 */
+	WT_SPINLOCK	 conflict_lock;	/* Lock for the conflict keys */
+	WT_CONFLICT_KEY *conflict_keys;	/* Keys with update conflicts */
+	u_int		 conflict_slots;/* Conflict key slots allocated */
+	u_int		 conflict_entries;/* Conflict key slots in use */
+
 	/* Flags values up to 0xff are reserved for WT_DHANDLE_* */
 #define	WT_BTREE_BULK		0x00100	/* Bulk-load handle */
-#define	WT_BTREE_NO_EVICTION	0x00200	/* Disable eviction */
-#define	WT_BTREE_NO_HAZARD	0x00400	/* Disable hazard pointers */
-#define	WT_BTREE_SALVAGE	0x00800	/* Handle is for salvage */
-#define	WT_BTREE_UPGRADE	0x01000	/* Handle is for upgrade */
-#define	WT_BTREE_VERIFY		0x02000	/* Handle is for verify */
+#define	WT_BTREE_LOOKASIDE	0x00200	/* Handle is the lookaside table */
+#define	WT_BTREE_NO_EVICTION	0x00400	/* Disable eviction */
+#define	WT_BTREE_NO_HAZARD	0x00800	/* Disable hazard pointers */
+#define	WT_BTREE_SALVAGE	0x01000	/* Handle is for salvage */
+#define	WT_BTREE_UPGRADE	0x02000	/* Handle is for upgrade */
+#define	WT_BTREE_VERIFY		0x04000	/* Handle is for verify */
 	uint32_t flags;
 };
 
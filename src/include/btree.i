@@ -235,7 +235,8 @@ __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 /*
  * __wt_update_list_memsize --
- *      The size in memory of a list of updates.
+ *      The size in memory of a list of updates, not including updates
+ * allocated from a page's arena, which are charged with the arena's blocks.
  */
 static inline size_t
 __wt_update_list_memsize(WT_UPDATE *upd)
@@ -243,7 +244,8 @@ __wt_update_list_memsize(WT_UPDATE *upd)
 	size_t upd_size;
 
 	for (upd_size = 0; upd != NULL; upd = upd->next)
-		upd_size += WT_UPDATE_MEMSIZE(upd);
+		if (!F_ISSET(upd, WT_UPDATE_ARENA))
+			upd_size += WT_UPDATE_MEMSIZE(upd);
 
 	return (upd_size);
 }
@@ -888,6 +890,22 @@ __wt_row_leaf_value(WT_PAGE *page, WT_ROW *rip, WT_ITEM *value)
 	return (0);
 }
 
+/*
+ * __wt_update_value --
+ *	Return the value for a row-store update, building it if the update
+ * holds a list of modifications.
+ */
+static inline int
+__wt_update_value(WT_SESSION_IMPL *session, WT_UPDATE *upd, WT_ITEM *value)
+{
+	if (WT_UPDATE_MODIFIED_ISSET(upd))
+		return (__wt_modify_value(session, upd, value));
+
+	value->data = WT_UPDATE_DATA(upd);
+	value->size = upd->size;
+	return (0);
+}
+
 /*
  * __wt_ref_info --
  *	Return the addr/size and type triplet for a reference.
@@ -940,6 +958,35 @@ __wt_ref_info(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __wt_page_las_evict --
+ *	Check whether a page can be evicted by writing the old versions of its
+ * records into the lookaside table.
+ */
+static inline int
+__wt_page_las_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_PAGE_MODIFY *mod;
+	WT_TXN_GLOBAL *txn_global;
+
+	txn_global = &S2C(session)->txn_global;
+
+	/*
+	 * Only row-store leaf pages of ordinary files, where all of the updates
+	 * are committed: reconciliation writes the newest committed values to
+	 * the page and older values to the lookaside table.
+	 *
+	 * Checkpoints may not see the newest committed values, don't write
+	 * pages using the lookaside table while a checkpoint is running.
+	 */
+	return (F_ISSET(S2C(session), WT_CONN_LAS_OPEN) &&
+	    !F_ISSET(S2BT(session), WT_BTREE_LOOKASIDE) &&
+	    page->type == WT_PAGE_ROW_LEAF &&
+	    (mod = page->modify) != NULL &&
+	    !txn_global->checkpoint_running &&
+	    TXNID_LT(mod->update_txn, txn_global->last_running));
+}
+
 /*
  * __wt_page_can_evict --
  *	Check whether a page can be evicted.
@@ -990,11 +1037,13 @@ __wt_page_can_evict(WT_SESSION_IMPL *session, WT_PAGE *page, int check_splits)
 
 	/*
 	 * If we aren't (potentially) doing eviction that can restore updates
-	 * and the updates on this page are too recent, give up.
+	 * or write old versions to the lookaside table, and the updates on
+	 * this page are too recent, give up.
 	 */
 	if (page->read_gen != WT_READGEN_OLDEST &&
 	    !__wt_txn_visible_all(session, __wt_page_is_modified(page) ?
-	    mod->update_txn : mod->rec_max_txn))
+	    mod->update_txn : mod->rec_max_txn) &&
+	    !__wt_page_las_evict(session, page))
 		return (0);
 
 	/*
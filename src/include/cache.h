@@ -23,6 +23,28 @@
 #define	WT_EVICT_PASS_DIRTY		0x04
 #define	WT_EVICT_PASS_WOULD_BLOCK	0x08
 
+/*
+ * The lookaside table: the key is the file ID, the address of the block
+ * written for the page and a counter; the value is the newest transaction ID
+ * saved for the block, the update's transaction ID and type, and the record's
+ * key and value.
+ */
+#define	WT_LAS_URI		"file:WiredTigerLAS.wt"
+#define	WT_LAS_FORMAT		"key_format=IuQ,value_format=QQBuu"
+#define	WT_LAS_SWEEP_ENTRIES	1000	/* Records reviewed per sweep pass */
+
+/*
+ * WT_LAS_SLOT --
+ *	A lookaside table cursor and the session it's opened in.  A thread
+ * evicting or reading a page claims a slot for as long as it uses the cursor.
+ */
+#define	WT_LAS_SLOTS		8	/* Lookaside table cursors */
+struct __wt_las_slot {
+	WT_SESSION_IMPL *session;	/* Lookaside table session */
+	WT_CURSOR	*cursor;	/* Lookaside table cursor */
+	volatile uint32_t busy;		/* Slot claimed */
+};
+
 /*
  * WT_EVICT_ENTRY --
  *	Encapsulation of an eviction candidate.
@@ -62,6 +84,7 @@ struct __wt_cache {
 	uint64_t bytes_dirty;		/* Bytes/pages currently dirty */
 	uint64_t pages_dirty;
 	uint64_t bytes_read;		/* Bytes read into memory */
+	uint64_t bytes_bloom;		/* Bytes in loaded Bloom filters */
 
 	uint64_t evict_max_page_size;	/* Largest page seen at eviction */
 
@@ -66,9 +66,10 @@ struct __wt_named_extractor {
 
 /*
  * Allocate some additional slots for internal sessions.  There is a default
- * session for each connection, plus a session for each server thread.
+ * session for each connection, plus a session for each server thread and
+ * each lookaside table cursor.
  */
-#define	WT_NUM_INTERNAL_SESSIONS	10
+#define	WT_NUM_INTERNAL_SESSIONS	(10 + WT_LAS_SLOTS)
 
 /*
  * WT_CONN_CHECK_PANIC --
@@ -243,6 +244,13 @@ struct __wt_connection_impl {
 	wt_off_t	 ckpt_logsize;	/* Checkpoint log size period */
 	uint32_t	 ckpt_signalled;/* Checkpoint signalled */
 	long		 ckpt_usecs;	/* Checkpoint period */
+	u_int		 ckpt_workers;	/* Checkpoint worker threads */
+
+	WT_SPINLOCK	 ckpt_write_lock;	/* Checkpoint write throttle */
+	uint64_t	 ckpt_write_next;	/* Throttle time, nanoseconds */
+	uint64_t	 ckpt_write_rate;	/* Write rate, bytes/second */
+	uint64_t	 ckpt_write_rate_min;	/* Configured write rate */
+	u_int		 ckpt_write_target;	/* Write target, wait percent */
 
 	int compact_in_memory_pass;	/* Compaction serialization */
 
@@ -255,6 +263,9 @@ struct __wt_connection_impl {
 
 	WT_CONNECTION_STATS stats;	/* Connection statistics */
 
+	u_int conflict_keys;		/* Conflict keys tracked per file */
+	u_int conflict_sample;		/* Track 1 of every N conflicts */
+
 #if SPINLOCK_TYPE == SPINLOCK_PTHREAD_MUTEX_LOGGING
 	/*
 	 * Spinlock registration, so we can track which spinlocks are heavily
@@ -311,6 +322,7 @@ struct __wt_connection_impl {
 #define	WT_CONN_LOG_EXISTED	0x04	/* Log files found */
 #define	WT_CONN_LOG_PREALLOC	0x08	/* Pre-allocation is enabled */
 #define	WT_CONN_LOG_RECOVER_ERR	0x10	/* Error if recovery required */
+#define	WT_CONN_LOG_RECYCLE	0x20	/* Recycle archived log files */
 	uint32_t	 log_flags;	/* Global logging configuration */
 	WT_CONDVAR	*log_cond;	/* Log server wait mutex */
 	WT_SESSION_IMPL *log_session;	/* Log server session */
@@ -329,13 +341,26 @@ struct __wt_connection_impl {
 	wt_off_t	 log_file_max;	/* Log file max size */
 	const char	*log_path;	/* Logging path format */
 	uint32_t	 log_prealloc;	/* Log file pre-allocation */
+	u_int		 log_recover_threads;/* Recovery apply threads */
 	uint32_t	 txn_logsync;	/* Log sync configuration */
+	uint64_t	 txn_logsync_delay;/* Group commit max delay (usecs) */
 
 	WT_SESSION_IMPL *sweep_session;	/* Handle sweep session */
 	wt_thread_t	 sweep_tid;	/* Handle sweep thread */
 	int		 sweep_tid_set;	/* Handle sweep thread set */
 	WT_CONDVAR	*sweep_cond;	/* Handle sweep wait mutex */
 
+	WT_SESSION_IMPL *prune_session;	/* Update prune session */
+	wt_thread_t	 prune_tid;	/* Update prune thread */
+	int		 prune_tid_set;	/* Update prune thread set */
+	WT_CONDVAR	*prune_cond;	/* Update prune wait mutex */
+	u_int		 prune_chain_max;/* Update prune chain length */
+	long		 prune_usecs;	/* Update prune period */
+
+					/* Lookaside table cursors */
+	WT_LAS_SLOT	 las_slots[WT_LAS_SLOTS];
+	uint64_t	 las_entries;	/* Lookaside table record count */
+
 					/* Locked: collator list */
 	TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
 
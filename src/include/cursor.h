@@ -24,6 +24,7 @@
 	insert,								\
 	update,								\
 	remove,								\
+	modify,								\
 	reconfigure,							\
 	close)								\
 	static const WT_CURSOR n = {					\
@@ -45,6 +46,7 @@
 	insert,								\
 	update,								\
 	remove,								\
+	(int (*)(WT_CURSOR *, WT_MODIFY *, int))(modify),		\
 	close,								\
 	(int (*)(WT_CURSOR *, const char *))(reconfigure),		\
 	{ NULL, NULL },			/* TAILQ_ENTRY q */		\
@@ -273,6 +275,20 @@ struct __wt_cursor_log {
 	uint32_t	step_count;	/* Intra-record count */
 	uint32_t	rectype;	/* Record type */
 	uint64_t	txnid;		/* Record txnid */
+
+	WT_ITEM		*batch;		/* Records read ahead */
+	size_t		 batch_next;	/* Offset of the next record */
+	u_int		 batch_count;	/* Records in the batch */
+	u_int		 batch_max;	/* Records to read per log scan */
+
+	WT_LSN		 start_lsn;	/* LSN to start returning records */
+	WT_LSN		 stop_lsn;	/* LSN to stop returning records */
+	uint32_t	 opmask;	/* Operation types to return */
+	uint32_t	*fileids;	/* File IDs to return operations on */
+	size_t		 fileids_alloc;
+	u_int		 nfileids;
+
+#define	WT_CURLOG_FILTER	0x01	/* Filtering operations */
 	uint32_t	flags;
 };
 
@@ -295,6 +311,8 @@ struct __wt_cursor_stat {
 	WT_STATS *stats_first;		/* First stats reference */
 	int	  stats_base;		/* Base statistics value */
 	int	  stats_count;		/* Count of stats elements */
+	WT_STATS *conflict_stats;	/* Stats with conflict keys appended */
+	int	  conflict_first;	/* First conflict key element */
 
 	union {				/* Copies of the statistics */
 		WT_DSRC_STATS dsrc_stats;
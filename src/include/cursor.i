@@ -306,11 +306,8 @@ value:
 	 * caller passes us the update: it has already resolved which one
 	 * (if any) is visible.
 	 */
-	if (upd != NULL) {
-		vb->data = WT_UPDATE_DATA(upd);
-		vb->size = upd->size;
-		return (0);
-	}
+	if (upd != NULL)
+		return (__wt_update_value(session, upd, vb));
 
 	/* Else, simple values have their location encoded in the WT_ROW. */
 	if (__wt_row_leaf_value(page, rip, vb))
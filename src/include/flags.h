@@ -6,27 +6,30 @@
 #define	WT_CONN_CKPT_SYNC				0x00000002
 #define	WT_CONN_CLOSING					0x00000004
 #define	WT_CONN_EVICTION_RUN				0x00000008
-#define	WT_CONN_LEAK_MEMORY				0x00000010
-#define	WT_CONN_LOG_SERVER_RUN				0x00000020
-#define	WT_CONN_LSM_MERGE				0x00000040
-#define	WT_CONN_PANIC					0x00000080
-#define	WT_CONN_SERVER_ASYNC				0x00000100
-#define	WT_CONN_SERVER_CHECKPOINT			0x00000200
-#define	WT_CONN_SERVER_LSM				0x00000400
-#define	WT_CONN_SERVER_RUN				0x00000800
-#define	WT_CONN_SERVER_STATISTICS			0x00001000
-#define	WT_CONN_SERVER_SWEEP				0x00002000
-#define	WT_CONN_WAS_BACKUP				0x00004000
+#define	WT_CONN_LAS_OPEN				0x00000010
+#define	WT_CONN_LEAK_MEMORY				0x00000020
+#define	WT_CONN_LOG_SERVER_RUN				0x00000040
+#define	WT_CONN_LSM_MERGE				0x00000080
+#define	WT_CONN_PANIC					0x00000100
+#define	WT_CONN_SERVER_ASYNC				0x00000200
+#define	WT_CONN_SERVER_CHECKPOINT			0x00000400
+#define	WT_CONN_SERVER_LSM				0x00000800
+#define	WT_CONN_SERVER_PRUNE				0x00001000
+#define	WT_CONN_SERVER_RUN				0x00002000
+#define	WT_CONN_SERVER_STATISTICS			0x00004000
+#define	WT_CONN_SERVER_SWEEP				0x00008000
+#define	WT_CONN_WAS_BACKUP				0x00010000
 #define	WT_EVICTING					0x00000001
 #define	WT_FILE_TYPE_CHECKPOINT				0x00000001
 #define	WT_FILE_TYPE_DATA				0x00000002
 #define	WT_FILE_TYPE_DIRECTORY				0x00000004
 #define	WT_FILE_TYPE_LOG				0x00000008
 #define	WT_FILE_TYPE_TURTLE				0x00000010
-#define	WT_LOGSCAN_FIRST				0x00000001
-#define	WT_LOGSCAN_FROM_CKP				0x00000002
-#define	WT_LOGSCAN_ONE					0x00000004
-#define	WT_LOGSCAN_RECOVER				0x00000008
+#define	WT_LOGSCAN_BATCH				0x00000001
+#define	WT_LOGSCAN_FIRST				0x00000002
+#define	WT_LOGSCAN_FROM_CKP				0x00000004
+#define	WT_LOGSCAN_ONE					0x00000008
+#define	WT_LOGSCAN_RECOVER				0x00000010
 #define	WT_LOG_DSYNC					0x00000001
 #define	WT_LOG_FLUSH					0x00000002
 #define	WT_LOG_FSYNC					0x00000004
@@ -40,22 +43,24 @@
 #define	WT_READ_TRUNCATE				0x00000080
 #define	WT_READ_WONT_NEED				0x00000100
 #define	WT_SESSION_CAN_WAIT				0x00000001
-#define	WT_SESSION_CLEAR_EVICT_WALK			0x00000002
-#define	WT_SESSION_DISCARD_FORCE			0x00000004
-#define	WT_SESSION_HANDLE_LIST_LOCKED			0x00000008
-#define	WT_SESSION_INTERNAL				0x00000010
-#define	WT_SESSION_LOGGING_INMEM			0x00000020
-#define	WT_SESSION_NO_CACHE				0x00000040
-#define	WT_SESSION_NO_CACHE_CHECK			0x00000080
-#define	WT_SESSION_NO_DATA_HANDLES			0x00000100
-#define	WT_SESSION_NO_LOGGING				0x00000200
-#define	WT_SESSION_NO_SCHEMA_LOCK			0x00000400
-#define	WT_SESSION_SALVAGE_CORRUPT_OK			0x00000800
-#define	WT_SESSION_SCHEMA_LOCKED			0x00001000
-#define	WT_SESSION_SERVER_ASYNC				0x00002000
-#define	WT_SESSION_TABLE_LOCKED				0x00004000
+#define	WT_SESSION_CHECKPOINT_THROTTLE			0x00000002
+#define	WT_SESSION_CLEAR_EVICT_WALK			0x00000004
+#define	WT_SESSION_DISCARD_FORCE			0x00000008
+#define	WT_SESSION_HANDLE_LIST_LOCKED			0x00000010
+#define	WT_SESSION_INTERNAL				0x00000020
+#define	WT_SESSION_LOGGING_INMEM			0x00000040
+#define	WT_SESSION_NO_CACHE				0x00000080
+#define	WT_SESSION_NO_CACHE_CHECK			0x00000100
+#define	WT_SESSION_NO_DATA_HANDLES			0x00000200
+#define	WT_SESSION_NO_LOGGING				0x00000400
+#define	WT_SESSION_NO_SCHEMA_LOCK			0x00000800
+#define	WT_SESSION_SALVAGE_CORRUPT_OK			0x00001000
+#define	WT_SESSION_SCHEMA_LOCKED			0x00002000
+#define	WT_SESSION_SERVER_ASYNC				0x00004000
+#define	WT_SESSION_TABLE_LOCKED				0x00008000
 #define	WT_SKIP_UPDATE_ERR				0x00000002
-#define	WT_SKIP_UPDATE_RESTORE				0x00000004
+#define	WT_SKIP_UPDATE_LAS				0x00000004
+#define	WT_SKIP_UPDATE_RESTORE				0x00000008
 #define	WT_SYNC_CHECKPOINT				0x00000001
 #define	WT_SYNC_CLOSE					0x00000002
 #define	WT_SYNC_DISCARD					0x00000004
@@ -144,6 +144,15 @@ typedef struct {
 	/* Notify any waiting threads when write_lsn is updated. */
 	WT_CONDVAR	*log_write_cond;
 
+	/*
+	 * Adaptive group commit: running averages of the flush latency and
+	 * of the gap between durable commits decide how long a slot leader
+	 * waits for more committers before flushing.
+	 */
+	uint64_t	 sync_latency;	/* Average flush latency (usecs) */
+	uint64_t	 sync_interval;	/* Average flush request gap (usecs) */
+	uint64_t	 sync_request;	/* Last flush request time (usecs) */
+
 	/*
 	 * Consolidation array information
 	 * SLOT_ACTIVE must be less than SLOT_POOL.
@@ -161,11 +170,20 @@ typedef struct {
 	uint32_t	 flags;
 } WT_LOG;
 
+/*
+ * WT_LOG_CKSUM_SALT --
+ *	The value a log record's checksum is salted with, given the log file
+ * number and the record's offset: the file header is never salted.
+ */
+#define	WT_LOG_CKSUM_SALT(file, offset)					\
+	((offset) == 0 ? 0 : (uint32_t)(file))
+
 typedef struct {
 	uint32_t	len;		/* 00-03: Record length including hdr */
 	uint32_t	checksum;	/* 04-07: Checksum of the record */
 
 #define	WT_LOG_RECORD_COMPRESSED	0x01	/* Compressed except hdr */
+#define	WT_LOG_RECORD_FILE_END		0x02	/* End of the log file */
 	uint16_t	flags;		/* 08-09: Flags */
 	uint8_t		unused[2];	/* 10-11: Padding */
 	uint32_t	mem_len;	/* 12-15: Uncompressed len if needed */
@@ -181,7 +199,14 @@ struct __wt_log_desc {
 	uint32_t	log_magic;	/* 00-03: Magic number */
 #define	WT_LOG_MAJOR_VERSION	1
 	uint16_t	majorv;		/* 04-05: Major version */
-#define	WT_LOG_MINOR_VERSION	0
+/*
+ * Minor version 1: record checksums (other than the file header's) are salted
+ * with the log file number, so records left behind in a recycled log file
+ * fail their checksum, and a file-end record is written when switching to
+ * the next log file.  Version 1 is only written when log files are recycled,
+ * otherwise log files are written in version 0.
+ */
+#define	WT_LOG_MINOR_VERSION	1
 	uint16_t	minorv;		/* 06-07: Minor version */
 	uint64_t	log_size;	/* 08-15: Log file size */
 };
@@ -46,26 +46,38 @@ struct __wt_cursor_lsm {
 	WT_BLOOM **blooms;		/* Bloom filter handles. */
 	size_t bloom_alloc;
 
+	WT_LSM_CHUNK **merge_chunks;	/* Chunks a merge cursor reads. */
+
+	WT_LSM_CHUNK **keys;		/* Chunks with known key ranges. */
+	size_t keys_alloc;
+
 	WT_CURSOR **cursors;		/* Cursor handles. */
 	size_t cursor_alloc;
 
 	WT_CURSOR *current;     	/* The current cursor for iteration */
+	u_int *heap;			/* Heap of cursors for iteration */
+	size_t heap_alloc;
+	u_int heap_entries;
 	WT_LSM_CHUNK *primary_chunk;	/* The current primary chunk */
 
+	WT_ITEM prefix;			/* Prefix search key */
+	WT_BLOOM_HASH prefix_hash;	/* Bloom filter prefix hash */
+
 	uint64_t *switch_txn;		/* Switch txn for each chunk */
 	size_t txnid_alloc;
 
-	u_int update_count;		/* Updates performed. */
+	uint64_t throttle_debt;		/* Throttle delay owed, nsecs */
 
 #define	WT_CLSM_ACTIVE		0x01    /* Incremented the session count */
 #define	WT_CLSM_ITERATE_NEXT    0x02    /* Forward iteration */
 #define	WT_CLSM_ITERATE_PREV    0x04    /* Backward iteration */
 #define	WT_CLSM_MERGE           0x08    /* Merge cursor, don't update */
 #define	WT_CLSM_MINOR_MERGE	0x10    /* Minor merge, include tombstones */
-#define	WT_CLSM_MULTIPLE        0x20    /* Multiple cursors have values for the
-					   current key */
-#define	WT_CLSM_OPEN_READ	0x40    /* Open for reads */
-#define	WT_CLSM_OPEN_SNAPSHOT	0x80    /* Open for snapshot isolation */
+#define	WT_CLSM_OPEN_READ	0x20    /* Open for reads */
+#define	WT_CLSM_OPEN_SNAPSHOT	0x40    /* Open for snapshot isolation */
+#define	WT_CLSM_PREFIX		0x80    /* Positioned by a prefix search */
+#define	WT_CLSM_PREFIX_BLOOM	0x100   /* Prefix hash is set */
+#define	WT_CLSM_PREFIX_SEARCH	0x200   /* Configured for prefix searches */
 	uint32_t flags;
 };
 
@@ -76,10 +88,14 @@ struct __wt_cursor_lsm {
 struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_lsm_chunk {
 	const char *uri;		/* Data source for this chunk */
 	const char *bloom_uri;		/* URI of Bloom filter, if any */
+	WT_BLOOM_BLOCKS *bloom_blocks;	/* Blocked Bloom filter in memory */
 	struct timespec create_ts;	/* Creation time (for rate limiting) */
 	uint64_t count;			/* Approximate count of records */
 	uint64_t size;			/* Final chunk size */
 
+	WT_ITEM min_key;		/* Smallest key in the chunk */
+	WT_ITEM max_key;		/* Largest key in the chunk */
+
 	uint64_t switch_txn;		/*
 					 * Largest transaction that can write
 					 * to this chunk, set by a worker
@@ -97,12 +113,47 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_lsm_chunk {
 	int8_t evicted;			/* 1/0: in-memory chunk was evicted */
 
 #define	WT_LSM_CHUNK_BLOOM	0x01
-#define	WT_LSM_CHUNK_MERGING	0x02
-#define	WT_LSM_CHUNK_ONDISK	0x04
-#define	WT_LSM_CHUNK_STABLE	0x08
+#define	WT_LSM_CHUNK_BLOOM_BLOCKED	0x02
+#define	WT_LSM_CHUNK_KEYS	0x04
+#define	WT_LSM_CHUNK_MERGING	0x08
+#define	WT_LSM_CHUNK_ONDISK	0x10
+#define	WT_LSM_CHUNK_STABLE	0x20
 	uint32_t flags;
 };
 
+/*
+ * WT_LSM_MERGE_PART --
+ *	A key range of a merge, merged into its own chunk.
+ */
+struct __wt_lsm_merge_part {
+	WT_ITEM start;			/* First key of the range */
+	WT_LSM_CHUNK *chunk;		/* Chunk created for the range */
+	uint64_t insert_count;		/* Records in the chunk */
+};
+
+/*
+ * WT_LSM_MERGE_SPLIT --
+ *	A merge split into key ranges, so several LSM worker threads can merge
+ * the ranges concurrently.  The first range has no start key, and each range
+ * ends where the next one starts.
+ */
+struct __wt_lsm_merge_split {
+	WT_LSM_CHUNK **chunks;		/* Chunks being merged */
+	u_int nchunks;
+	uint64_t record_count;		/* Records in the chunks */
+	uint64_t size;			/* Size of the chunks */
+	uint32_t generation;		/* Merge generation */
+	int create_bloom;		/* Create Bloom filters */
+	int minor;			/* Minor merge, keep tombstones */
+
+	WT_LSM_MERGE_PART *parts;	/* Key ranges */
+	u_int nparts;
+
+	volatile uint32_t next;		/* Next range to merge */
+	volatile uint32_t done;		/* Ranges finished */
+	int error;			/* First error merging a range */
+};
+
 /*
  * Different types of work units. Used by LSM worker threads to choose which
  * type of work they will execute, and by work units to define which action
@@ -121,9 +172,11 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_lsm_chunk {
 struct __wt_lsm_work_unit {
 	TAILQ_ENTRY(__wt_lsm_work_unit) q;	/* Worker unit queue */
 	uint32_t	type;			/* Type of operation */
+#define	WT_LSM_WORK_ACTIVE	0x0002		/* Counted as running */
 #define	WT_LSM_WORK_FORCE	0x0001		/* Force operation */
 	uint32_t	flags;			/* Flags for operation */
 	WT_LSM_TREE *lsm_tree;
+	struct timespec	push_ts;		/* Timestamp work unit added */
 };
 
 /*
@@ -134,8 +187,9 @@ struct __wt_lsm_work_unit {
 struct __wt_lsm_manager {
 	/*
 	 * Queues of work units for LSM worker threads. We maintain three
-	 * queues, to allow us to keep each queue FIFO, rather than needing
-	 * to manage the order of work by shuffling the queue order.
+	 * queues, so work of one kind is never stuck behind work of another.
+	 * Work units are added to the end of a queue, workers take the most
+	 * urgent matching work unit from anywhere in the queue.
 	 * One queue for switches - since switches should never wait for other
 	 *   work to be done.
 	 * One queue for application requested work. For example flushing
@@ -182,27 +236,43 @@ struct __wt_lsm_tree {
 
 	uint64_t dsk_gen;
 
-	long ckpt_throttle;		/* Rate limiting due to checkpoints */
-	long merge_throttle;		/* Rate limiting due to merges */
+#define	WT_LSM_THROTTLE_MAX	(10 * WT_MILLION)
+#define	WT_LSM_THROTTLE_SLEEP	(250 * WT_THOUSAND)
+	uint64_t throttle;		/* Rate limiting: nsecs per update */
+	uint32_t backlog;		/* Chunks waiting to flush or merge */
+	uint32_t backlog_merge;		/* Chunks waiting to merge */
+	uint32_t backlog_last;		/* Backlog at the last switch */
+	uint32_t backlog_predicted;	/* Backlog expected at next switch */
 	uint64_t chunk_fill_ms;		/* Estimate of time to fill a chunk */
 	struct timespec last_flush_ts;	/* Timestamp last flush finished */
 	struct timespec work_push_ts;	/* Timestamp last work unit added */
 	uint64_t merge_progressing;	/* Bumped when merges are active */
+	uint64_t flush_pending;		/* Bytes in chunks waiting to flush */
+	uint32_t work_active;		/* Work units being executed */
 	uint32_t merge_syncing;		/* Bumped when merges are syncing */
 
 	/* Configuration parameters */
 	uint32_t bloom_bit_count;
 	uint32_t bloom_hash_count;
+	uint32_t bloom_prefix;		/* Key prefix added to Bloom filters */
 	uint32_t chunk_count_limit;	/* Limit number of chunks */
+	uint32_t throttle_backlog;	/* Backlog throttling maintains */
 	uint64_t chunk_size;
 	uint64_t chunk_max;		/* Maximum chunk a merge creates */
 	u_int merge_min, merge_max;
+	u_int merge_partitions;		/* Maximum key ranges in a merge */
+	u_int level_multiplier;		/* Leveled merges: level size ratio */
 
 	u_int merge_idle;		/* Count of idle merge threads */
 
+					/* Merge other threads can help */
+	WT_LSM_MERGE_SPLIT * volatile merge_split;
+	WT_CONDVAR *merge_cond;		/* Signalled as key ranges finish */
+
 #define	WT_LSM_BLOOM_MERGED				0x00000001
 #define	WT_LSM_BLOOM_OFF				0x00000002
 #define	WT_LSM_BLOOM_OLDEST				0x00000004
+#define	WT_LSM_BLOOM_BLOCKED				0x00000008
 	uint32_t bloom;			/* Bloom creation policy */
 
 	WT_LSM_CHUNK **chunk;		/* Array of active LSM chunks */
@@ -219,10 +289,11 @@ struct __wt_lsm_tree {
 
 #define	WT_LSM_TREE_ACTIVE		0x01	/* Workers are active */
 #define	WT_LSM_TREE_COMPACTING		0x02	/* Tree being compacted */
-#define	WT_LSM_TREE_MERGES		0x04	/* Tree should run merges */
-#define	WT_LSM_TREE_NEED_SWITCH		0x08	/* New chunk needs creating */
-#define	WT_LSM_TREE_OPEN		0x10	/* The tree is open */
-#define	WT_LSM_TREE_THROTTLE		0x20	/* Throttle updates */
+#define	WT_LSM_TREE_LEVELED		0x04	/* Leveled merge policy */
+#define	WT_LSM_TREE_MERGES		0x08	/* Tree should run merges */
+#define	WT_LSM_TREE_NEED_SWITCH		0x10	/* New chunk needs creating */
+#define	WT_LSM_TREE_OPEN		0x20	/* The tree is open */
+#define	WT_LSM_TREE_THROTTLE		0x40	/* Throttle updates */
 	uint32_t flags;
 };
 
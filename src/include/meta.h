@@ -66,3 +66,38 @@ struct __wt_ckpt {
 #define	WT_CKPT_UPDATE	0x08			/* Checkpoint requires update */
 	uint32_t flags;
 };
+
+/*
+ * WT_CKPT_HANDLE --
+ *	A handle involved in a database checkpoint, and the state of its file's
+ * checkpoint: the checkpoint's session prepares and resolves each file's
+ * checkpoint, the files can be flushed concurrently.
+ */
+struct __wt_ckpt_handle {
+	WT_DATA_HANDLE *dhandle;		/* Locked handle */
+	const char *name;			/* Busy handle's name */
+
+	WT_CKPT	*ckptbase;			/* File's checkpoints */
+	WT_LSN	 ckptlsn;			/* File's checkpoint LSN */
+	char	*name_alloc;			/* Checkpoint name */
+	uint64_t msecs;				/* Time spent flushing */
+	int	 fake_ckpt;			/* Fake the checkpoint */
+	int	 flush;				/* Cache operation to flush */
+	int	 hot_backup_locked;		/* Holding hot backup lock */
+	int	 skip;				/* No checkpoint required */
+	int	 was_modified;			/* Tree was modified */
+};
+
+/*
+ * WT_CKPT_WORKER --
+ *	A thread applying operations to the handles involved in a database
+ * checkpoint, concurrently with the checkpoint's session.
+ */
+struct __wt_ckpt_worker {
+	WT_SESSION_IMPL *session;		/* Worker's session */
+	WT_SESSION_IMPL *ckpt_session;		/* Checkpoint's session */
+
+	wt_thread_t tid;			/* Worker's thread */
+	int	 tid_set;			/* Worker's thread is running */
+	int	 error;				/* Worker's return */
+};
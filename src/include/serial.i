@@ -142,7 +142,7 @@ __wt_col_append_serial(WT_SESSION_IMPL *session, WT_PAGE *page,
 
 	/* Free unused memory on error. */
 	if (ret != 0) {
-		__wt_free(session, new_ins);
+		__wt_page_arena_free(session, page, new_ins);
 		return (ret);
 	}
 
@@ -186,7 +186,7 @@ __wt_insert_serial(WT_SESSION_IMPL *session, WT_PAGE *page,
 
 	/* Free unused memory on error. */
 	if (ret != 0) {
-		__wt_free(session, new_ins);
+		__wt_page_arena_free(session, page, new_ins);
 		return (ret);
 	}
 
@@ -231,7 +231,7 @@ __wt_update_serial(WT_SESSION_IMPL *session, WT_PAGE *page,
 		if ((ret = __wt_txn_update_check(
 		    session, upd->next = *srch_upd)) != 0) {
 			/* Free unused memory on error. */
-			__wt_free(session, upd);
+			__wt_update_free(session, upd);
 			return (ret);
 		}
 		WT_WRITE_BARRIER();
@@ -260,7 +260,7 @@ __wt_update_serial(WT_SESSION_IMPL *session, WT_PAGE *page,
 		/* If we can't lock it, don't scan, that's okay. */
 		if (ret != 0)
 			return (0);
-		obsolete = __wt_update_obsolete_check(session, upd->next);
+		obsolete = __wt_update_obsolete_check(session, page, upd->next);
 		F_CLR_ATOMIC(page, WT_PAGE_SCANNING);
 		if (obsolete != NULL)
 			__wt_update_obsolete_free(session, page, obsolete);
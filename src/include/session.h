@@ -125,13 +125,18 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_session_impl {
 	int	(*block_manager_cleanup)(WT_SESSION_IMPL *);
 
 					/* Checkpoint support */
-	struct {
-		WT_DATA_HANDLE *dhandle;
-		const char *name;
-	} *ckpt_handle;			/* Handle list */
+	WT_CKPT_HANDLE *ckpt_handle;	/* Handle list */
 	u_int   ckpt_handle_next;	/* Next empty slot */
 	size_t  ckpt_handle_allocated;	/* Bytes allocated */
 
+	WT_CKPT_WORKER *ckpt_worker;	/* Checkpoint workers */
+	u_int	ckpt_workers;		/* Count of checkpoint workers */
+					/* Operation applied by workers */
+	int (*ckpt_apply_op)(WT_SESSION_IMPL *, const char *[]);
+	int (*ckpt_apply_handle_op)(WT_SESSION_IMPL *, WT_CKPT_HANDLE *);
+	const char **ckpt_apply_cfg;
+	volatile u_int ckpt_apply_next;	/* Next handle to apply */
+
 	void	*reconcile;		/* Reconciliation support */
 	int	(*reconcile_cleanup)(WT_SESSION_IMPL *);
 
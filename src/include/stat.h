@@ -152,6 +152,8 @@ struct __wt_connection_stats {
 	WT_STATS block_preload;
 	WT_STATS block_read;
 	WT_STATS block_write;
+	WT_STATS cache_arena_alloc;
+	WT_STATS cache_bytes_bloom;
 	WT_STATS cache_bytes_dirty;
 	WT_STATS cache_bytes_inuse;
 	WT_STATS cache_bytes_max;
@@ -178,14 +180,21 @@ struct __wt_connection_stats {
 	WT_STATS cache_eviction_walk;
 	WT_STATS cache_eviction_worker_evicting;
 	WT_STATS cache_inmem_split;
+	WT_STATS cache_lookaside_cursor_wait;
+	WT_STATS cache_lookaside_insert;
+	WT_STATS cache_lookaside_remove;
 	WT_STATS cache_overhead;
 	WT_STATS cache_pages_dirty;
 	WT_STATS cache_pages_inuse;
 	WT_STATS cache_read;
+	WT_STATS cache_read_lookaside;
 	WT_STATS cache_write;
+	WT_STATS cache_write_lookaside;
 	WT_STATS cond_wait;
 	WT_STATS cursor_create;
 	WT_STATS cursor_insert;
+	WT_STATS cursor_modify;
+	WT_STATS cursor_modify_delta;
 	WT_STATS cursor_next;
 	WT_STATS cursor_prev;
 	WT_STATS cursor_remove;
@@ -210,9 +219,12 @@ struct __wt_connection_stats {
 	WT_STATS log_compress_small;
 	WT_STATS log_compress_write_fails;
 	WT_STATS log_compress_writes;
+	WT_STATS log_group_commit_delay_time;
+	WT_STATS log_group_commit_delays;
 	WT_STATS log_max_filesize;
 	WT_STATS log_prealloc_files;
 	WT_STATS log_prealloc_max;
+	WT_STATS log_prealloc_recycled;
 	WT_STATS log_prealloc_used;
 	WT_STATS log_reads;
 	WT_STATS log_release_write_lsn;
@@ -228,12 +240,17 @@ struct __wt_connection_stats {
 	WT_STATS log_slot_toosmall;
 	WT_STATS log_slot_transitions;
 	WT_STATS log_sync;
+	WT_STATS log_sync_commit_gt100;
+	WT_STATS log_sync_commit_lt1;
+	WT_STATS log_sync_commit_lt10;
+	WT_STATS log_sync_commit_lt100;
 	WT_STATS log_sync_dir;
 	WT_STATS log_write_lsn;
 	WT_STATS log_writes;
-	WT_STATS lsm_checkpoint_throttle;
-	WT_STATS lsm_merge_throttle;
+	WT_STATS lsm_bloom_blocks_disk;
+	WT_STATS lsm_merge_ranges_helped;
 	WT_STATS lsm_rows_merged;
+	WT_STATS lsm_throttle;
 	WT_STATS lsm_work_queue_app;
 	WT_STATS lsm_work_queue_manager;
 	WT_STATS lsm_work_queue_max;
@@ -260,15 +277,37 @@ struct __wt_connection_stats {
 	WT_STATS session_open;
 	WT_STATS txn_begin;
 	WT_STATS txn_checkpoint;
+	WT_STATS txn_checkpoint_file_time_max;
+	WT_STATS txn_checkpoint_file_time_total;
 	WT_STATS txn_checkpoint_running;
+	WT_STATS txn_checkpoint_throttle;
+	WT_STATS txn_checkpoint_throttle_time;
 	WT_STATS txn_checkpoint_time_max;
 	WT_STATS txn_checkpoint_time_min;
 	WT_STATS txn_checkpoint_time_recent;
 	WT_STATS txn_checkpoint_time_total;
+	WT_STATS txn_checkpoint_write_rate;
 	WT_STATS txn_commit;
 	WT_STATS txn_fail_cache;
+	WT_STATS txn_group_unit_commit;
+	WT_STATS txn_group_unit_rollback;
 	WT_STATS txn_pinned_range;
+	WT_STATS txn_pinned_snapshot_range;
+	WT_STATS txn_prune_chain_after;
+	WT_STATS txn_prune_chain_before;
+	WT_STATS txn_prune_chain_long;
+	WT_STATS txn_prune_chain_max_after;
+	WT_STATS txn_prune_chain_max_before;
+	WT_STATS txn_prune_chains;
+	WT_STATS txn_prune_pages;
+	WT_STATS txn_prune_passes;
+	WT_STATS txn_prune_updates;
 	WT_STATS txn_rollback;
+	WT_STATS txn_snapshot_rebuild;
+	WT_STATS txn_snapshot_reuse;
+	WT_STATS txn_snapshots_created;
+	WT_STATS txn_snapshots_dropped;
+	WT_STATS txn_update_conflict;
 	WT_STATS write_io;
 };
 
@@ -289,10 +328,12 @@ struct __wt_dsrc_stats {
 	WT_STATS block_size;
 	WT_STATS bloom_count;
 	WT_STATS bloom_false_positive;
+	WT_STATS bloom_flush;
 	WT_STATS bloom_hit;
 	WT_STATS bloom_miss;
 	WT_STATS bloom_page_evict;
 	WT_STATS bloom_page_read;
+	WT_STATS bloom_prefix_miss;
 	WT_STATS bloom_size;
 	WT_STATS btree_column_deleted;
 	WT_STATS btree_column_fix;
@@ -323,8 +364,10 @@ struct __wt_dsrc_stats {
 	WT_STATS cache_inmem_split;
 	WT_STATS cache_overflow_value;
 	WT_STATS cache_read;
+	WT_STATS cache_read_lookaside;
 	WT_STATS cache_read_overflow;
 	WT_STATS cache_write;
+	WT_STATS cache_write_lookaside;
 	WT_STATS compress_raw_fail;
 	WT_STATS compress_raw_fail_temporary;
 	WT_STATS compress_raw_ok;
@@ -336,6 +379,8 @@ struct __wt_dsrc_stats {
 	WT_STATS cursor_insert;
 	WT_STATS cursor_insert_bulk;
 	WT_STATS cursor_insert_bytes;
+	WT_STATS cursor_modify;
+	WT_STATS cursor_modify_bytes;
 	WT_STATS cursor_next;
 	WT_STATS cursor_prev;
 	WT_STATS cursor_remove;
@@ -345,11 +390,22 @@ struct __wt_dsrc_stats {
 	WT_STATS cursor_search_near;
 	WT_STATS cursor_update;
 	WT_STATS cursor_update_bytes;
-	WT_STATS lsm_checkpoint_throttle;
+	WT_STATS lsm_amplification_read;
+	WT_STATS lsm_amplification_space;
+	WT_STATS lsm_amplification_write;
+	WT_STATS lsm_backlog_predicted;
+	WT_STATS lsm_bytes_flushed;
+	WT_STATS lsm_bytes_merged;
 	WT_STATS lsm_chunk_count;
 	WT_STATS lsm_generation_max;
+	WT_STATS lsm_lookup_key_range;
 	WT_STATS lsm_lookup_no_bloom;
-	WT_STATS lsm_merge_throttle;
+	WT_STATS lsm_merge_moved;
+	WT_STATS lsm_throttle;
+	WT_STATS lsm_throttle_delay;
+	WT_STATS lsm_work_queue_wait;
+	WT_STATS lsm_work_queue_wait_max;
+	WT_STATS lsm_work_units_done;
 	WT_STATS rec_dictionary;
 	WT_STATS rec_multiblock_internal;
 	WT_STATS rec_multiblock_leaf;
@@ -25,9 +25,37 @@
 
 #define	WT_SESSION_TXN_STATE(s) (&S2C(s)->txn_global.states[(s)->id])
 
+/*
+ * Sessions that have allocated a transaction ID are tracked in a bitmap, one
+ * bit per session, so snapshots only look at the states of writers.  A bit is
+ * set by the session's first write and cleared when the session is closed:
+ * the published ID says whether the session is running a transaction.
+ */
+#define	WT_TXN_WRITER_WORDS(n)	(((n) + 63) / 64)
+#define	WT_TXN_WRITER_BIT(id)	((uint64_t)1 << ((id) % 64))
+
+/* Spin this many times waiting for a session allocating an ID, then yield. */
+#define	WT_TXN_ALLOC_SPINS	1000
+
 struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_txn_state {
 	volatile uint64_t id;
 	volatile uint64_t snap_min;
+	volatile uint32_t allocating;	/* Session is allocating an ID */
+};
+
+/*
+ * WT_NAMED_SNAPSHOT --
+ *	A named snapshot, created by WT_SESSION::snapshot and used by
+ *	transactions in any session.
+ */
+struct __wt_named_snapshot {
+	const char *name;
+
+	TAILQ_ENTRY(__wt_named_snapshot) q;
+
+	uint64_t snap_min, snap_max;
+	uint64_t *snapshot;
+	uint32_t snapshot_count;
 };
 
 struct __wt_txn_global {
@@ -45,10 +73,36 @@ struct __wt_txn_global {
 	/* The oldest session found in the last scan. */
 	uint32_t oldest_session;
 
-	/* Count of scanning threads, or -1 for exclusive access. */
+	/* The current ID when all sessions were last scanned for oldest ID. */
+	uint64_t oldest_scan_id;
+
+	/*
+	 * Set to -1 while a thread is moving the oldest ID forwards.  Threads
+	 * taking snapshots publish a lower bound for their snap_min before
+	 * scanning and check this hasn't raced with them, they don't update
+	 * any shared state.
+	 */
 	volatile int32_t scan_count;
 
+	/*
+	 * Incremented each time a transaction with an ID commits: snapshots
+	 * taken at the same commit generation are identical.
+	 */
+	volatile uint64_t commit_gen;
+
+	/* A database checkpoint is running (lookaside eviction waits). */
+	volatile uint32_t checkpoint_running;
+
 	WT_TXN_STATE *states;		/* Per-session transaction states */
+	volatile uint64_t *writers;	/* Sessions that allocated IDs */
+
+	/*
+	 * Named snapshots, in creation order, and the oldest ID they need:
+	 * the oldest ID can't move past it while named snapshots exist.
+	 */
+	WT_RWLOCK *nsnap_rwlock;
+	volatile uint64_t nsnap_oldest_id;
+	TAILQ_HEAD(__wt_nsnap_qh, __wt_named_snapshot) nsnaph;
 };
 
 typedef enum __wt_txn_isolation {
@@ -113,6 +167,7 @@ struct __wt_txn {
 	uint64_t snap_min, snap_max;
 	uint64_t *snapshot;
 	uint32_t snapshot_count;
+	uint64_t snapshot_gen;	/* Commit generation of the snapshot */
 	uint32_t txn_logsync;	/* Log sync configuration */
 
 	/* Array of modifications by this transaction. */
@@ -123,6 +178,13 @@ struct __wt_txn {
 	/* Scratch buffer for in-memory log records. */
 	WT_ITEM	       *logrec;
 
+	/*
+	 * Group transactions: where the current unit's operations and log
+	 * records start.
+	 */
+	u_int		unit_mod_count;
+	size_t		unit_logrec_size;
+
 	/* Requested notification when transactions are resolved. */
 	WT_TXN_NOTIFY *notify;
 
@@ -137,5 +199,7 @@ struct __wt_txn {
 #define	TXN_HAS_ID	        0x04
 #define	TXN_HAS_SNAPSHOT	0x08
 #define	TXN_RUNNING		0x10
+#define	TXN_GROUP		0x20
+#define	TXN_UPDATE_CONFLICT	0x40
 	uint32_t flags;
 };
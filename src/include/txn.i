@@ -65,6 +65,16 @@ __wt_txn_modify(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 	WT_DECL_RET;
 	WT_TXN_OP *op;
 
+	/*
+	 * Lookaside table updates are visible to everyone as soon as they're
+	 * made and are never rolled back: don't allocate a transaction ID, a
+	 * page holding them can always be evicted.
+	 */
+	if (F_ISSET(S2BT(session), WT_BTREE_LOOKASIDE)) {
+		upd->txnid = WT_TXN_NONE;
+		return (0);
+	}
+
 	WT_RET(__txn_next_op(session, &op));
 	op->type = F_ISSET(session, WT_SESSION_LOGGING_INMEM) ?
 	    TXN_OP_INMEM : TXN_OP_BASIC;
@@ -211,6 +221,30 @@ __wt_txn_new_id(WT_SESSION_IMPL *session)
 	return (WT_ATOMIC_ADD8(S2C(session)->txn_global.current, 1) - 1);
 }
 
+/*
+ * __wt_txn_writer_set --
+ *	Add or remove the session from the bitmap of writers.
+ */
+static inline void
+__wt_txn_writer_set(WT_SESSION_IMPL *session, int on)
+{
+	volatile uint64_t *wordp;
+	uint64_t bit, v, new_v;
+
+	wordp = &S2C(session)->txn_global.writers[session->id / 64];
+	bit = WT_TXN_WRITER_BIT(session->id);
+	do {
+		/*
+		 * Only the session changes its bit: skip it if unchanged, the
+		 * common case, the bit is set by the session's first write.
+		 */
+		v = *wordp;
+		new_v = on ? v | bit : v & ~bit;
+		if (v == new_v)
+			return;
+	} while (!WT_ATOMIC_CAS8(*wordp, v, new_v));
+}
+
 /*
  * __wt_txn_id_check --
  *	A transaction is going to do an update, start an auto commit
@@ -247,25 +281,30 @@ __wt_txn_id_check(WT_SESSION_IMPL *session)
 		/*
 		 * Allocate a transaction ID.
 		 *
-		 * We use an atomic compare and swap to ensure that we get a
-		 * unique ID that is published before the global counter is
-		 * updated.
+		 * The ID must be published before the global counter moves
+		 * past it, or a thread taking a snapshot could miss it.  Take
+		 * the ID with an atomic fetch-and-add, which always succeeds
+		 * the first time, rather than a compare-and-swap loop, which
+		 * retries when threads race to begin transactions: first flag
+		 * the session as allocating and publish the current global
+		 * value as a lower bound for the ID, then publish the ID and
+		 * clear the flag.  A thread that sees the incremented global
+		 * counter sees the flag or the ID: threads taking snapshots
+		 * wait for the flag to clear, threads moving the oldest ID
+		 * use the lower bound.
 		 *
-		 * If two threads race to allocate an ID, only the latest ID
-		 * will proceed.  The winning thread can be sure its snapshot
-		 * contains all of the earlier active IDs.  Threads that race
-		 * and get an earlier ID may not appear in the snapshot, but
-		 * they will loop and allocate a new ID before proceeding to
-		 * make any updates.
-		 *
-		 * This potentially wastes transaction IDs when threads race to
-		 * begin transactions: that is the price we pay to keep this
-		 * path latch free.
+		 * Add the session to the writers before publishing anything:
+		 * a thread that sees the incremented global counter must find
+		 * the session in the bitmap.  The bit stays set when the
+		 * transaction resolves, so only a session's first write
+		 * updates the shared word.
 		 */
-		do {
-			txn_state->id = txn->id = txn_global->current;
-		} while (!WT_ATOMIC_CAS8(
-		    txn_global->current, txn->id, txn->id + 1));
+		__wt_txn_writer_set(session, 1);
+		WT_PUBLISH(txn_state->allocating, 1);
+		WT_PUBLISH(txn_state->id, txn_global->current);
+		txn->id = WT_ATOMIC_FETCH_ADD8(txn_global->current, 1);
+		WT_PUBLISH(txn_state->id, txn->id);
+		WT_PUBLISH(txn_state->allocating, 0);
 
 		/*
 		 * If we have used 64-bits of transaction IDs, there is nothing
@@ -292,8 +331,11 @@ __wt_txn_update_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 	if (txn->isolation == TXN_ISO_SNAPSHOT)
 		while (upd != NULL && !__wt_txn_visible(session, upd->txnid)) {
 			if (upd->txnid != WT_TXN_ABORTED) {
+				WT_STAT_FAST_CONN_INCR(
+				    session, txn_update_conflict);
 				WT_STAT_FAST_DATA_INCR(
 				    session, txn_update_conflict);
+				F_SET(txn, TXN_UPDATE_CONFLICT);
 				return (WT_ROLLBACK);
 			}
 			upd = upd->next;
@@ -370,9 +412,8 @@ __wt_txn_am_oldest(WT_SESSION_IMPL *session)
 	WT_CONNECTION_IMPL *conn;
 	WT_TXN *txn;
 	WT_TXN_GLOBAL *txn_global;
-	WT_TXN_STATE *s;
-	uint64_t id;
-	uint32_t i, session_cnt;
+	uint64_t bits, id;
+	uint32_t i, session_cnt, w;
 
 	conn = S2C(session);
 	txn = &session->txn;
@@ -382,9 +423,13 @@ __wt_txn_am_oldest(WT_SESSION_IMPL *session)
 		return (0);
 
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states; i < session_cnt; i++, s++)
-		if ((id = s->id) != WT_TXN_NONE && TXNID_LT(id, txn->id))
-			return (0);
+	for (w = 0; w < WT_TXN_WRITER_WORDS(session_cnt); w++)
+		for (bits = txn_global->writers[w],
+		    i = w * 64; bits != 0; bits >>= 1, i++)
+			if ((bits & 1) != 0 &&
+			    (id = txn_global->states[i].id) != WT_TXN_NONE &&
+			    TXNID_LT(id, txn->id))
+				return (0);
 
 	return (1);
 }
@@ -69,6 +69,10 @@ extern "C" {
  */
 struct __wt_addr;
     typedef struct __wt_addr WT_ADDR;
+struct __wt_arena;
+    typedef struct __wt_arena WT_ARENA;
+struct __wt_arena_block;
+    typedef struct __wt_arena_block WT_ARENA_BLOCK;
 struct __wt_async;
     typedef struct __wt_async WT_ASYNC;
 struct __wt_async_cursor;
@@ -89,6 +93,8 @@ struct __wt_block_header;
     typedef struct __wt_block_header WT_BLOCK_HEADER;
 struct __wt_bloom;
     typedef struct __wt_bloom WT_BLOOM;
+struct __wt_bloom_blocks;
+    typedef struct __wt_bloom_blocks WT_BLOOM_BLOCKS;
 struct __wt_bloom_hash;
     typedef struct __wt_bloom_hash WT_BLOOM_HASH;
 struct __wt_bm;
@@ -105,6 +111,10 @@ struct __wt_cell_unpack;
     typedef struct __wt_cell_unpack WT_CELL_UNPACK;
 struct __wt_ckpt;
     typedef struct __wt_ckpt WT_CKPT;
+struct __wt_ckpt_handle;
+    typedef struct __wt_ckpt_handle WT_CKPT_HANDLE;
+struct __wt_ckpt_worker;
+    typedef struct __wt_ckpt_worker WT_CKPT_WORKER;
 struct __wt_col;
     typedef struct __wt_col WT_COL;
 struct __wt_col_rle;
@@ -123,6 +133,8 @@ struct __wt_config_entry;
     typedef struct __wt_config_entry WT_CONFIG_ENTRY;
 struct __wt_config_parser_impl;
     typedef struct __wt_config_parser_impl WT_CONFIG_PARSER_IMPL;
+struct __wt_conflict_key;
+    typedef struct __wt_conflict_key WT_CONFLICT_KEY;
 struct __wt_connection_impl;
     typedef struct __wt_connection_impl WT_CONNECTION_IMPL;
 struct __wt_connection_stats;
@@ -185,6 +197,8 @@ struct __wt_insert;
     typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
     typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_las_slot;
+    typedef struct __wt_las_slot WT_LAS_SLOT;
 struct __wt_log_desc;
     typedef struct __wt_log_desc WT_LOG_DESC;
 struct __wt_log_op_desc;
@@ -197,6 +211,10 @@ struct __wt_lsm_data_source;
     typedef struct __wt_lsm_data_source WT_LSM_DATA_SOURCE;
 struct __wt_lsm_manager;
     typedef struct __wt_lsm_manager WT_LSM_MANAGER;
+struct __wt_lsm_merge_part;
+    typedef struct __wt_lsm_merge_part WT_LSM_MERGE_PART;
+struct __wt_lsm_merge_split;
+    typedef struct __wt_lsm_merge_split WT_LSM_MERGE_SPLIT;
 struct __wt_lsm_tree;
     typedef struct __wt_lsm_tree WT_LSM_TREE;
 struct __wt_lsm_work_unit;
@@ -215,6 +233,8 @@ struct __wt_named_data_source;
     typedef struct __wt_named_data_source WT_NAMED_DATA_SOURCE;
 struct __wt_named_extractor;
     typedef struct __wt_named_extractor WT_NAMED_EXTRACTOR;
+struct __wt_named_snapshot;
+    typedef struct __wt_named_snapshot WT_NAMED_SNAPSHOT;
 struct __wt_ovfl_reuse;
     typedef struct __wt_ovfl_reuse WT_OVFL_REUSE;
 struct __wt_ovfl_track;
@@ -47,6 +47,8 @@ __wt_log_needs_recovery(WT_SESSION_IMPL *session, WT_LSN *ckp_lsn, int *rec)
 	WT_CURSOR *c;
 	WT_DECL_RET;
 	WT_LOG *log;
+	const char *cfg[] = {
+	    WT_CONFIG_BASE(session, session_open_cursor), NULL };
 
 	conn = S2C(session);
 	log = conn->log;
@@ -59,7 +61,7 @@ __wt_log_needs_recovery(WT_SESSION_IMPL *session, WT_LSN *ckp_lsn, int *rec)
 	if (log == NULL)
 		return (0);
 
-	WT_RET(__wt_curlog_open(session, "log:", NULL, &c));
+	WT_RET(__wt_curlog_open(session, "log:", cfg, &c));
 	c->set_key(c, ckp_lsn->file, ckp_lsn->offset, 0);
 	if ((ret = c->search(c)) == 0) {
 		/*
@@ -375,8 +377,19 @@ __log_fill(WT_SESSION_IMPL *session,
 {
 	WT_DECL_RET;
 	WT_LOG_RECORD *logrec;
+	wt_off_t offset;
 
 	logrec = (WT_LOG_RECORD *)record->mem;
+	/*
+	 * If log files are recycled, salt the record's checksum with the log
+	 * file number now we know which file it's going into, so that records
+	 * left behind in recycled log files can't be mistaken for records in
+	 * this one.
+	 */
+	offset = myslot->slot->slot_start_offset + myslot->offset;
+	if (FLD_ISSET(S2C(session)->log_flags, WT_CONN_LOG_RECYCLE))
+		logrec->checksum ^= WT_LOG_CKSUM_SALT(
+		    myslot->slot->slot_start_lsn.file, offset);
 	/*
 	 * Call __wt_write.  For now the offset is the real byte offset.
 	 * If the offset becomes a unit of LOG_ALIGN this is where we would
@@ -384,8 +397,7 @@ __log_fill(WT_SESSION_IMPL *session,
 	 */
 	if (direct)
 		WT_ERR(__wt_write(session, myslot->slot->slot_fh,
-		    myslot->offset + myslot->slot->slot_start_offset,
-		    (size_t)logrec->len, (void *)logrec));
+		    offset, (size_t)logrec->len, (void *)logrec));
 	else
 		memcpy((char *)myslot->slot->slot_buf.mem + myslot->offset,
 		    logrec, logrec->len);
@@ -434,7 +446,12 @@ __log_file_header(
 	desc = (WT_LOG_DESC *)logrec->record;
 	desc->log_magic = WT_LOG_MAGIC;
 	desc->majorv = WT_LOG_MAJOR_VERSION;
-	desc->minorv = WT_LOG_MINOR_VERSION;
+	/*
+	 * Only recycled log files can hold stale records: unless log files are
+	 * recycled, write the original format, earlier releases can read it.
+	 */
+	desc->minorv = FLD_ISSET(conn->log_flags, WT_CONN_LOG_RECYCLE) ?
+	    WT_LOG_MINOR_VERSION : 0;
 	desc->log_size = (uint64_t)conn->log_file_max;
 
 	/*
@@ -498,6 +515,104 @@ err:	__wt_scr_free(session, &path);
 	return (ret);
 }
 
+/*
+ * __log_file_version --
+ *	Check the version in a log file header and return if the record
+ *	checksums in the log file are salted with the log file number.
+ */
+static int
+__log_file_version(
+    WT_SESSION_IMPL *session, WT_FH *fh, uint32_t allocsize, int *saltedp)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_LOG_DESC *desc;
+	WT_LOG_RECORD *logrec;
+
+	*saltedp = 0;
+
+	/*
+	 * Use a scratch buffer to get correct alignment for direct I/O.
+	 */
+	WT_RET(__wt_scr_alloc(session, allocsize, &buf));
+	WT_ERR(__wt_read(session, fh, 0, (size_t)allocsize, buf->mem));
+	logrec = (WT_LOG_RECORD *)buf->mem;
+	desc = (WT_LOG_DESC *)logrec->record;
+	if (desc->log_magic != WT_LOG_MAGIC)
+		goto err;
+	if (desc->majorv > WT_LOG_MAJOR_VERSION ||
+	    (desc->majorv == WT_LOG_MAJOR_VERSION &&
+	    desc->minorv > WT_LOG_MINOR_VERSION))
+		WT_ERR_MSG(session, WT_ERROR,
+		    "unsupported log file version: this build only supports "
+		    "log versions up to %d.%d, and log file %s is version "
+		    "%d.%d",
+		    WT_LOG_MAJOR_VERSION, WT_LOG_MINOR_VERSION,
+		    fh->name, (int)desc->majorv, (int)desc->minorv);
+	if (desc->majorv == WT_LOG_MAJOR_VERSION && desc->minorv >= 1)
+		*saltedp = 1;
+
+err:	__wt_scr_free(session, &buf);
+	return (ret);
+}
+
+/*
+ * __log_file_end --
+ *	Write a file-end record at the end of the current log file.  Recycled
+ *	log files hold stale records after the last record written: the
+ *	file-end record tells a log scan to move on to the next file.  Called
+ *	locked.
+ */
+static int
+__log_file_end(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_LOG_RECORD *logrec;
+	WT_LOGSLOT tmp;
+	WT_MYSLOT myslot;
+
+	conn = S2C(session);
+	log = conn->log;
+
+	/*
+	 * Log files that aren't recycled end with zeroes, and earlier releases
+	 * don't know about file-end records.
+	 */
+	if (!FLD_ISSET(conn->log_flags, WT_CONN_LOG_RECYCLE))
+		return (0);
+
+	/*
+	 * Use a scratch buffer to get correct alignment for direct I/O.
+	 */
+	WT_RET(__wt_scr_alloc(session, log->allocsize, &buf));
+	memset(buf->mem, 0, log->allocsize);
+	logrec = (WT_LOG_RECORD *)buf->mem;
+	logrec->len = log->allocsize;
+	F_SET(logrec, WT_LOG_RECORD_FILE_END);
+	logrec->checksum = 0;
+	logrec->checksum = __wt_cksum(logrec, log->allocsize);
+
+	/*
+	 * Space for the record is always available: allocations stop short of
+	 * the maximum file size and log files are sized to hold the header as
+	 * well.  The record is written past any outstanding writes into the
+	 * file, and it's flushed when the file is closed.
+	 */
+	WT_CLEAR(tmp);
+	tmp.slot_fh = log->log_fh;
+	tmp.slot_start_lsn = log->alloc_lsn;
+	tmp.slot_start_offset = log->alloc_lsn.offset;
+	myslot.slot = &tmp;
+	myslot.offset = 0;
+	ret = __log_fill(session, &myslot, 1, buf, NULL);
+
+	__wt_scr_free(session, &buf);
+	return (ret);
+}
+
 /*
  * __log_alloc_prealloc --
  *	Look for a pre-allocated log file and rename it to use as the next
@@ -696,6 +811,82 @@ err:	__wt_scr_free(session, &path);
 	return (ret);
 }
 
+/*
+ * __wt_log_recycle --
+ *	Given a log number, recycle that log file into the pool of
+ *	pre-allocated log files, or remove it if the pool is already full.
+ *	The file's blocks are reused as they are, only the header is
+ *	rewritten: the records left behind fail their checksums once the
+ *	file is reused under a different log number.
+ */
+int
+__wt_log_recycle(WT_SESSION_IMPL *session, uint32_t lognum)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(from_path);
+	WT_DECL_ITEM(tmp_path);
+	WT_DECL_ITEM(to_path);
+	WT_DECL_RET;
+	WT_FH *log_fh, *tmp_fh;
+	WT_LOG *log;
+	wt_off_t size;
+	uint32_t to_num;
+	u_int logcount;
+	char **logfiles;
+
+	conn = S2C(session);
+	log = conn->log;
+	log_fh = NULL;
+
+	/*
+	 * Don't grow the pool past the number of files we'd pre-allocate.
+	 */
+	WT_RET(__log_get_files(session,
+	    WT_LOG_PREPNAME, &logfiles, &logcount));
+	__wt_log_files_free(session, logfiles, logcount);
+	if (logcount >= conn->log_prealloc)
+		return (__wt_log_remove(session, WT_LOG_FILENAME, lognum));
+
+	/*
+	 * Recycling a log file is much like preparing a new one, except we
+	 * start by renaming the log file to the temporary name:
+	 * - Rewriting the header.
+	 * - Extending the file if it's smaller than a pre-allocated file.
+	 * - Renaming it to the pre-allocated file name.
+	 */
+	to_num = WT_ATOMIC_ADD4(log->prep_fileid, 1);
+	WT_RET(__wt_scr_alloc(session, 0, &from_path));
+	WT_ERR(__wt_scr_alloc(session, 0, &tmp_path));
+	WT_ERR(__wt_scr_alloc(session, 0, &to_path));
+	WT_ERR(__log_filename(session, lognum, WT_LOG_FILENAME, from_path));
+	WT_ERR(__log_filename(session, to_num, WT_LOG_TMPNAME, tmp_path));
+	WT_ERR(__log_filename(session, to_num, WT_LOG_PREPNAME, to_path));
+	WT_ERR(__wt_verbose(session, WT_VERB_LOG,
+	    "log_recycle: recycle log %s to %s",
+	    (char *)from_path->data, (char *)to_path->data));
+	WT_ERR(__wt_rename(session, from_path->data, tmp_path->data));
+
+	WT_ERR(__log_openfile(session, 0, &log_fh, WT_LOG_TMPNAME, to_num));
+	WT_ERR(__log_file_header(session, log_fh, NULL, 1));
+	WT_ERR(__wt_filesize(session, log_fh, &size));
+	if (size < LOG_FIRST_RECORD + conn->log_file_max)
+		WT_ERR(__log_prealloc(session, log_fh));
+	tmp_fh = log_fh;
+	log_fh = NULL;
+	WT_ERR(__wt_fsync(session, tmp_fh));
+	WT_ERR(__wt_close(session, tmp_fh));
+
+	WT_ERR(__wt_rename(session, tmp_path->data, to_path->data));
+	WT_STAT_FAST_CONN_INCR(session, log_prealloc_recycled);
+
+err:	__wt_scr_free(session, &from_path);
+	__wt_scr_free(session, &tmp_path);
+	__wt_scr_free(session, &to_path);
+	if (log_fh != NULL)
+		WT_TRET(__wt_close(session, log_fh));
+	return (ret);
+}
+
 /*
  * __wt_log_open --
  *	Open the appropriate log file for the connection.  The purpose is
@@ -810,6 +1001,7 @@ __wt_log_close(WT_SESSION_IMPL *session)
 	if (log->log_fh != NULL) {
 		WT_RET(__wt_verbose(session, WT_VERB_LOG,
 		    "closing log %s", log->log_fh->name));
+		WT_RET(__log_file_end(session));
 		WT_RET(__wt_fsync(session, log->log_fh));
 		WT_RET(__wt_close(session, log->log_fh));
 		log->log_fh = NULL;
@@ -912,6 +1104,46 @@ err:
 	return (ret);
 }
 
+/*
+ * __log_group_commit_delay --
+ *	Decide whether a slot leader about to flush the log should wait for
+ *	additional committers to join the flush, and wait if so.
+ */
+static int
+__log_group_commit_delay(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LOG *log;
+	uint64_t delay;
+
+	conn = S2C(session);
+	log = conn->log;
+
+	if (conn->txn_logsync_delay == 0 ||
+	    LOG_CMP(&log->sync_lsn, &slot->slot_end_lsn) >= 0)
+		return (0);
+
+	/*
+	 * Waiting only pays off if another committer is likely to arrive
+	 * before a flush would complete; never wait longer than a flush
+	 * takes or than the configured maximum.
+	 */
+	if (log->sync_interval >= log->sync_latency)
+		return (0);
+	delay = WT_MIN(log->sync_latency, conn->txn_logsync_delay);
+	if (delay == 0)
+		return (0);
+
+	/*
+	 * Wait without holding the sync lock, so other threads can flush in
+	 * the meantime: if another thread's flush covers our records, it
+	 * signals the condition variable and we don't wait any longer.
+	 */
+	WT_STAT_FAST_CONN_INCR(session, log_group_commit_delays);
+	WT_STAT_FAST_CONN_INCRV(session, log_group_commit_delay_time, delay);
+	return (__wt_cond_wait(session, log->log_sync_cond, (long)delay));
+}
+
 /*
  * __log_release --
  *	Release a log slot.
@@ -923,6 +1155,7 @@ __log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int *freep)
 	WT_DECL_RET;
 	WT_LOG *log;
 	WT_LSN sync_lsn;
+	struct timespec start, stop;
 	size_t write_size;
 	int locked, yield_count;
 	WT_DECL_SPINLOCK_ID(id);			/* Must appear last */
@@ -980,6 +1213,13 @@ __log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int *freep)
 	if (F_ISSET(slot, SLOT_CLOSEFH))
 		WT_ERR(__wt_cond_signal(session, conn->log_close_cond));
 
+	/*
+	 * Give other committers a chance to join the flush, before acquiring
+	 * the sync lock.
+	 */
+	if (F_ISSET(slot, SLOT_SYNC))
+		WT_ERR(__log_group_commit_delay(session, slot));
+
 	/*
 	 * Try to consolidate calls to fsync to wait less.  Acquire a spin lock
 	 * so that threads finishing writing to the log will wait while the
@@ -1027,10 +1267,22 @@ __log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int *freep)
 		 */
 		if (F_ISSET(slot, SLOT_SYNC) &&
 		    LOG_CMP(&log->sync_lsn, &slot->slot_end_lsn) < 0) {
+			/*
+			 * Groups written to the same file while we waited are
+			 * covered by this flush, their leaders can skip it.
+			 */
+			if (log->write_lsn.file == sync_lsn.file &&
+			    LOG_CMP(&log->write_lsn, &sync_lsn) > 0)
+				sync_lsn = log->write_lsn;
+
 			WT_ERR(__wt_verbose(session, WT_VERB_LOG,
 			    "log_release: sync log %s", log->log_fh->name));
 			WT_STAT_FAST_CONN_INCR(session, log_sync);
+			WT_ERR(__wt_epoch(session, &start));
 			WT_ERR(__wt_fsync(session, log->log_fh));
+			WT_ERR(__wt_epoch(session, &stop));
+			log->sync_latency = (7 * log->sync_latency +
+			    WT_TIMEDIFF(stop, start) / WT_THOUSAND) / 8;
 			log->sync_lsn = sync_lsn;
 			WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
 		}
@@ -1077,6 +1329,8 @@ __wt_log_newfile(WT_SESSION_IMPL *session, int conn_create, int *created)
 		WT_STAT_FAST_CONN_INCR(session, log_close_yields);
 		__wt_yield();
 	}
+	if (log->log_fh != NULL)
+		WT_RET(__log_file_end(session));
 	log->log_close_fh = log->log_fh;
 	log->fileid++;
 
@@ -1177,6 +1431,7 @@ __log_read_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	WT_LOG *log;
 	WT_LOG_RECORD *logrec;
 	uint32_t cksum, rdup_len, reclen;
+	int salted;
 
 	WT_UNUSED(flags);
 	/*
@@ -1195,6 +1450,7 @@ __log_read_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 
 	WT_RET(__log_openfile(
 	    session, 0, &log_fh, WT_LOG_FILENAME, lsnp->file));
+	WT_ERR(__log_file_version(session, log_fh, log->allocsize, &salted));
 	/*
 	 * Read the minimum allocation size a record could be.
 	 */
@@ -1214,6 +1470,9 @@ __log_read_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	}
 	if (reclen > log->allocsize) {
 		rdup_len = __wt_rduppo2(reclen, log->allocsize);
+		if (rdup_len < reclen)
+			WT_ERR_MSG(session, WT_ERROR,
+			    "log_read: Bad record length");
 		WT_ERR(__wt_buf_grow(session, record, rdup_len));
 		WT_ERR(__wt_read(session,
 		    log_fh, lsnp->offset, (size_t)rdup_len, record->mem));
@@ -1225,8 +1484,15 @@ __log_read_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	cksum = logrec->checksum;
 	logrec->checksum = 0;
 	logrec->checksum = __wt_cksum(logrec, logrec->len);
+	if (salted)
+		logrec->checksum ^=
+		    WT_LOG_CKSUM_SALT(lsnp->file, lsnp->offset);
 	if (logrec->checksum != cksum)
 		WT_ERR_MSG(session, WT_ERROR, "log_read: Bad checksum");
+	if (F_ISSET(logrec, WT_LOG_RECORD_FILE_END)) {
+		ret = WT_NOTFOUND;
+		goto err;
+	}
 	record->size = logrec->len;
 	WT_STAT_FAST_CONN_INCR(session, log_reads);
 err:
@@ -1255,7 +1521,7 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 	uint32_t allocsize, cksum, firstlog, lastlog, lognum, rdup_len, reclen;
 	u_int i, logcount;
 	int eol;
-	int firstrecord;
+	int firstrecord, salted;
 	char **logfiles;
 
 	conn = S2C(session);
@@ -1344,6 +1610,7 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 	}
 	WT_ERR(__log_openfile(
 	    session, 0, &log_fh, WT_LOG_FILENAME, start_lsn.file));
+	WT_ERR(__log_file_version(session, log_fh, allocsize, &salted));
 	WT_ERR(__log_filesize(session, log_fh, &log_size));
 	rd_lsn = start_lsn;
 	WT_ERR(__wt_buf_initsize(session, &buf, LOG_ALIGN));
@@ -1372,6 +1639,8 @@ advance:
 				break;
 			WT_ERR(__log_openfile(
 			    session, 0, &log_fh, WT_LOG_FILENAME, rd_lsn.file));
+			WT_ERR(__log_file_version(
+			    session, log_fh, allocsize, &salted));
 			WT_ERR(__log_filesize(session, log_fh, &log_size));
 			continue;
 		}
@@ -1403,8 +1672,16 @@ advance:
 		if (reclen > allocsize) {
 			/*
 			 * The log file end could be the middle of this
-			 * log record.
+			 * log record.  A length that doesn't fit at all
+			 * can only come from a stale record left behind
+			 * in a recycled log file, that's the end of the
+			 * log.
 			 */
+			if (rdup_len < reclen) {
+				if (log != NULL)
+					log->trunc_lsn = rd_lsn;
+				break;
+			}
 			if (rd_lsn.offset + rdup_len > log_size)
 				goto advance;
 			/*
@@ -1424,19 +1701,30 @@ advance:
 		cksum = logrec->checksum;
 		logrec->checksum = 0;
 		logrec->checksum = __wt_cksum(logrec, logrec->len);
+		if (salted)
+			logrec->checksum ^=
+			    WT_LOG_CKSUM_SALT(rd_lsn.file, rd_lsn.offset);
 		if (logrec->checksum != cksum) {
 			/*
 			 * A checksum mismatch means we have reached the end of
 			 * the useful part of the log.  This should be found on
 			 * the first pass through recovery.  In the second pass
 			 * where we truncate the log, this is where it should
-			 * end.
+			 * end.  Stale records in recycled log files are found
+			 * here too, their checksums were salted with a
+			 * different log file number.
 			 */
 			if (log != NULL)
 				log->trunc_lsn = rd_lsn;
 			break;
 		}
 
+		/*
+		 * If we reached the end of this log file, go to the next one.
+		 */
+		if (F_ISSET(logrec, WT_LOG_RECORD_FILE_END))
+			goto advance;
+
 		/*
 		 * We have a valid log record.  If it is not the log file
 		 * header, invoke the callback.
@@ -1446,12 +1734,22 @@ advance:
 			if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED)) {
 				WT_ERR(__log_decompress(session, &buf,
 				    &uncitem));
-				WT_ERR((*func)(session, uncitem, &rd_lsn,
-				    cookie, firstrecord));
+				ret = (*func)(session, uncitem, &rd_lsn,
+				    cookie, firstrecord);
 				__wt_scr_free(session, &uncitem);
 			} else
-				WT_ERR((*func)(session, &buf, &rd_lsn, cookie,
-				    firstrecord));
+				ret = (*func)(session, &buf, &rd_lsn, cookie,
+				    firstrecord);
+
+			/*
+			 * A batched scan ends when the callback returns
+			 * WT_NOTFOUND: it has all the records it wants.
+			 */
+			if (ret == WT_NOTFOUND && LF_ISSET(WT_LOGSCAN_BATCH)) {
+				ret = 0;
+				break;
+			}
+			WT_ERR(ret);
 
 			firstrecord = 0;
 
@@ -1461,11 +1759,21 @@ advance:
 		rd_lsn.offset += (wt_off_t)rdup_len;
 	}
 
-	/* Truncate if we're in recovery. */
-	if (LF_ISSET(WT_LOGSCAN_RECOVER) &&
-	    LOG_CMP(&rd_lsn, &log->trunc_lsn) < 0)
-		WT_ERR(__log_truncate(session,
-		    &rd_lsn, WT_LOG_FILENAME, 0));
+	/*
+	 * Truncate if we're in recovery.  Even if there are no later log files
+	 * to truncate, truncate the file where the log ends if logging has
+	 * since moved on to another file: otherwise a partial write or stale
+	 * records in a recycled file would end any later scan of the log
+	 * before it reached the records in the following files.
+	 */
+	if (LF_ISSET(WT_LOGSCAN_RECOVER)) {
+		if (LOG_CMP(&rd_lsn, &log->trunc_lsn) < 0)
+			WT_ERR(__log_truncate(session,
+			    &rd_lsn, WT_LOG_FILENAME, 0));
+		else if (rd_lsn.file < log->fileid)
+			WT_ERR(__log_truncate(session,
+			    &rd_lsn, WT_LOG_FILENAME, 1));
+	}
 
 err:	WT_STAT_FAST_CONN_INCR(session, log_scans);
 	if (logfiles != NULL)
@@ -1541,6 +1849,8 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	WT_ITEM *ip;
 	WT_LOG *log;
 	WT_LOG_RECORD *complrp;
+	struct timespec start, stop;
+	uint64_t now, usecs;
 	int compression_failed;
 	size_t len, src_len, dst_len, result_len, size;
 	uint8_t *src, *dst;
@@ -1626,7 +1936,40 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 			complrp->mem_len = WT_STORE_SIZE(record->size);
 		}
 	}
-	ret = __log_write_internal(session, ip, lsnp, flags);
+	if (!LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC)) {
+		ret = __log_write_internal(session, ip, lsnp, flags);
+		goto err;
+	}
+
+	/*
+	 * Durable commits are timed so the effect of flush grouping is
+	 * visible in the commit latency histogram.
+	 */
+	WT_ERR(__wt_epoch(session, &start));
+
+	/*
+	 * Track the average gap between durable commits for group commit.
+	 * Concurrent updates can lose samples, the value is only a hint.
+	 */
+	now = (uint64_t)start.tv_sec * WT_MILLION +
+	    (uint64_t)start.tv_nsec / WT_THOUSAND;
+	if (log->sync_request != 0) {
+		usecs = now > log->sync_request ? now - log->sync_request : 0;
+		log->sync_interval = (7 * log->sync_interval + usecs) / 8;
+	}
+	log->sync_request = now;
+
+	WT_ERR(__log_write_internal(session, ip, lsnp, flags));
+	WT_ERR(__wt_epoch(session, &stop));
+	usecs = WT_TIMEDIFF(stop, start) / WT_THOUSAND;
+	if (usecs < 1000)
+		WT_STAT_FAST_CONN_INCR(session, log_sync_commit_lt1);
+	else if (usecs < 10000)
+		WT_STAT_FAST_CONN_INCR(session, log_sync_commit_lt10);
+	else if (usecs < 100000)
+		WT_STAT_FAST_CONN_INCR(session, log_sync_commit_lt100);
+	else
+		WT_STAT_FAST_CONN_INCR(session, log_sync_commit_gt100);
 
 err:	__wt_scr_free(session, &citem);
 	return (ret);
@@ -441,6 +441,69 @@ __wt_logop_row_truncate_print(
 	return (0);
 }
 
+int
+__wt_logop_row_modify_pack(
+    WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    uint32_t fileid, WT_ITEM *key, WT_ITEM *value)
+{
+	const char *fmt = WT_UNCHECKED_STRING(IIIuu);
+	size_t size;
+	uint32_t optype, recsize;
+
+	optype = WT_LOGOP_ROW_MODIFY;
+	WT_RET(__wt_struct_size(session, &size, fmt,
+	    optype, 0, fileid, key, value));
+
+	__wt_struct_size_adjust(session, &size);
+	WT_RET(__wt_buf_extend(session, logrec, logrec->size + size));
+	recsize = (uint32_t)size;
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->data + logrec->size, size, fmt,
+	    optype, recsize, fileid, key, value));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+
+int
+__wt_logop_row_modify_unpack(
+    WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end,
+    uint32_t *fileidp, WT_ITEM *keyp, WT_ITEM *valuep)
+{
+	const char *fmt = WT_UNCHECKED_STRING(IIIuu);
+	uint32_t optype, size;
+
+	WT_RET(__wt_struct_unpack(session, *pp, WT_PTRDIFF(end, *pp), fmt,
+	    &optype, &size, fileidp, keyp, valuep));
+	WT_ASSERT(session, optype == WT_LOGOP_ROW_MODIFY);
+
+	*pp += size;
+	return (0);
+}
+
+int
+__wt_logop_row_modify_print(
+    WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out)
+{
+	uint32_t fileid;
+	WT_ITEM key;
+	WT_ITEM value;
+	char *escaped;
+
+	escaped = NULL;
+	WT_RET(__wt_logop_row_modify_unpack(
+	    session, pp, end, &fileid, &key, &value));
+
+	fprintf(out, " \"optype\": \"row_modify\",\n");
+	fprintf(out, "        \"fileid\": \"%" PRIu32 "\",\n", fileid);
+	WT_RET(__logrec_jsonify_str(session, &escaped, &key));
+	fprintf(out, "        \"key\": \"%s\",\n", escaped);
+	WT_RET(__logrec_jsonify_str(session, &escaped, &value));
+	fprintf(out, "        \"value\": \"%s\"", escaped);
+	__wt_free(session, escaped);
+	return (0);
+}
+
 int
 __wt_txn_op_printlog(
     WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out)
@@ -476,6 +539,10 @@ __wt_txn_op_printlog(
 		WT_RET(__wt_logop_row_truncate_print(session, pp, end, out));
 		break;
 
+	case WT_LOGOP_ROW_MODIFY:
+		WT_RET(__wt_logop_row_modify_print(session, pp, end, out));
+		break;
+
 	WT_ILLEGAL_VALUE(session);
 	}
 
@@ -16,7 +16,7 @@
 	__wt_compare(s, (lsm_tree)->collator, &(c1)->key, &(c2)->key, &cmp)
 
 static int __clsm_lookup(WT_CURSOR_LSM *, WT_ITEM *);
-static int __clsm_open_cursors(WT_CURSOR_LSM *, int, u_int, uint32_t);
+static int __clsm_open_cursors(WT_CURSOR_LSM *, int);
 static int __clsm_reset_cursors(WT_CURSOR_LSM *, WT_CURSOR *);
 
 /*
@@ -234,7 +234,7 @@ __clsm_enter(WT_CURSOR_LSM *clsm, int reset, int update)
 			break;
 
 open:		WT_WITH_SCHEMA_LOCK(session,
-		    ret = __clsm_open_cursors(clsm, update, 0, 0));
+		    ret = __clsm_open_cursors(clsm, update));
 		WT_RET(ret);
 	}
 
@@ -362,6 +362,7 @@ __clsm_close_cursors(WT_CURSOR_LSM *clsm, u_int start, u_int end)
 			clsm->blooms[i] = NULL;
 			WT_RET(__wt_bloom_close(bloom));
 		}
+		clsm->keys[i] = NULL;
 	}
 
 	return (0);
@@ -372,8 +373,7 @@ __clsm_close_cursors(WT_CURSOR_LSM *clsm, u_int start, u_int end)
  *	Open cursors for the current set of files.
  */
 static int
-__clsm_open_cursors(
-    WT_CURSOR_LSM *clsm, int update, u_int start_chunk, uint32_t start_id)
+__clsm_open_cursors(WT_CURSOR_LSM *clsm, int update)
 {
 	WT_BTREE *btree;
 	WT_CURSOR *c, **cp, *primary;
@@ -417,29 +417,10 @@ __clsm_open_cursors(
 	WT_RET(__wt_lsm_tree_readlock(session, lsm_tree));
 	locked = 1;
 
-	/* Merge cursors have already figured out how many chunks they need. */
+	/* Merge cursors have already figured out which chunks they need. */
 retry:	if (F_ISSET(clsm, WT_CLSM_MERGE)) {
 		nchunks = clsm->nchunks;
 		ngood = 0;
-
-		/*
-		 * We may have raced with another merge completing.  Check that
-		 * we're starting at the right offset in the chunk array.
-		 */
-		if (start_chunk >= lsm_tree->nchunks ||
-		    lsm_tree->chunk[start_chunk]->id != start_id) {
-			for (start_chunk = 0;
-			    start_chunk < lsm_tree->nchunks;
-			    start_chunk++) {
-				chunk = lsm_tree->chunk[start_chunk];
-				if (chunk->id == start_id)
-					break;
-			}
-			/* We have to find the start chunk: merge locked it. */
-			WT_ASSERT(session, start_chunk < lsm_tree->nchunks);
-		}
-
-		WT_ASSERT(session, start_chunk + nchunks <= lsm_tree->nchunks);
 	} else {
 		nchunks = lsm_tree->nchunks;
 
@@ -551,12 +532,15 @@ retry:	if (F_ISSET(clsm, WT_CLSM_MERGE)) {
 	    &clsm->bloom_alloc, nchunks, &clsm->blooms));
 	WT_ERR(__wt_realloc_def(session,
 	    &clsm->cursor_alloc, nchunks, &clsm->cursors));
+	WT_ERR(__wt_realloc_def(session,
+	    &clsm->keys_alloc, nchunks, &clsm->keys));
 
 	clsm->nchunks = nchunks;
 
 	/* Open the cursors for chunks that have changed. */
 	for (i = ngood, cp = clsm->cursors + i; i != nchunks; i++, cp++) {
-		chunk = lsm_tree->chunk[i + start_chunk];
+		chunk = F_ISSET(clsm, WT_CLSM_MERGE) ?
+		    clsm->merge_chunks[i] : lsm_tree->chunk[i];
 		/* Copy the maximum transaction ID. */
 		if (F_ISSET(clsm, WT_CLSM_OPEN_SNAPSHOT))
 			clsm->switch_txn[i] = chunk->switch_txn;
@@ -593,12 +577,27 @@ retry:	if (F_ISSET(clsm, WT_CLSM_MERGE)) {
 			(*cp)->insert = __wt_curfile_update_check;
 
 		if (!F_ISSET(clsm, WT_CLSM_MERGE) &&
+		    F_ISSET(chunk, WT_LSM_CHUNK_BLOOM_BLOCKED)) {
+			WT_ERR(__wt_lsm_tree_bloom_load(session, chunk));
+			WT_ERR(__wt_bloom_open_blocks(session,
+			    chunk->bloom_uri, chunk->bloom_blocks,
+			    lsm_tree->bloom_bit_count,
+			    lsm_tree->bloom_hash_count,
+			    c, &clsm->blooms[i]));
+		} else if (!F_ISSET(clsm, WT_CLSM_MERGE) &&
 		    F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_bloom_open(session, chunk->bloom_uri,
 			    lsm_tree->bloom_bit_count,
 			    lsm_tree->bloom_hash_count,
 			    c, &clsm->blooms[i]));
 
+		/*
+		 * Remember the chunk if its key range is known: it can't
+		 * change while the chunk is open.
+		 */
+		clsm->keys[i] = F_ISSET(chunk, WT_LSM_CHUNK_ONDISK) &&
+		    F_ISSET(chunk, WT_LSM_CHUNK_KEYS) ? chunk : NULL;
+
 		/* Child cursors always use overwrite and raw mode. */
 		F_SET(*cp, WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
 	}
@@ -612,11 +611,13 @@ retry:	if (F_ISSET(clsm, WT_CLSM_MERGE)) {
 		/*
 		 * Disable eviction for the in-memory chunk.  Also clear the
 		 * bulk load flag here, otherwise eviction will be enabled by
-		 * the first update.
+		 * the first update.  Updates to the in-memory chunk are only
+		 * discarded when the chunk is, allocate them from page arenas.
 		 */
 		btree = ((WT_CURSOR_BTREE *)(primary))->btree;
 		if (btree->bulk_load_ok) {
 			btree->bulk_load_ok = 0;
+			btree->page_arena = 1;
 			WT_WITH_BTREE(session, btree,
 			    __wt_btree_evictable(session, 0));
 		}
@@ -629,7 +630,8 @@ err:
 	/* Check that all cursors are open as expected. */
 	if (ret == 0 && F_ISSET(clsm, WT_CLSM_OPEN_READ)) {
 		for (i = 0, cp = clsm->cursors; i != clsm->nchunks; cp++, i++) {
-			chunk = lsm_tree->chunk[i + start_chunk];
+			chunk = F_ISSET(clsm, WT_CLSM_MERGE) ?
+			    clsm->merge_chunks[i] : lsm_tree->chunk[i];
 
 			/* Make sure the cursor is open. */
 			WT_ASSERT(session, *cp != NULL);
@@ -660,11 +662,13 @@ err:
 
 /*
  * __wt_clsm_init_merge --
- *	Initialize an LSM cursor for a merge.
+ *	Initialize an LSM cursor for a merge of a set of chunks, in the order
+ *	they appear in the LSM tree.  The chunks can't go away while they are
+ *	being merged, the caller owns the array.
  */
 int
 __wt_clsm_init_merge(
-    WT_CURSOR *cursor, u_int start_chunk, uint32_t start_id, u_int nchunks)
+    WT_CURSOR *cursor, WT_LSM_CHUNK **chunks, u_int nchunks, int minor)
 {
 	WT_CURSOR_LSM *clsm;
 	WT_DECL_RET;
@@ -674,55 +678,313 @@ __wt_clsm_init_merge(
 	session = (WT_SESSION_IMPL *)cursor->session;
 
 	F_SET(clsm, WT_CLSM_MERGE);
-	if (start_chunk != 0)
+	if (minor)
 		F_SET(clsm, WT_CLSM_MINOR_MERGE);
+	clsm->merge_chunks = chunks;
 	clsm->nchunks = nchunks;
 
 	WT_WITH_SCHEMA_LOCK(session,
-	    ret = __clsm_open_cursors(clsm, 0, start_chunk, start_id));
+	    ret = __clsm_open_cursors(clsm, 0));
 	return (ret);
 }
 
 /*
- * __clsm_get_current --
- *	Find the smallest / largest of the cursors and copy its key/value.
+ * __clsm_key_range --
+ *	Check a key against a chunk's key range: set the result to -1 if the
+ *	key sorts before the chunk's smallest key, 1 if it sorts after the
+ *	chunk's largest key, and 0 otherwise (including if the chunk's key
+ *	range is unknown).
+ */
+static inline int
+__clsm_key_range(WT_SESSION_IMPL *session,
+    WT_CURSOR_LSM *clsm, u_int i, const WT_ITEM *key, int *rangep)
+{
+	WT_LSM_CHUNK *chunk;
+	int cmp;
+
+	*rangep = 0;
+	if ((chunk = clsm->keys[i]) == NULL)
+		return (0);
+
+	WT_RET(__wt_compare(session,
+	    clsm->lsm_tree->collator, key, &chunk->min_key, &cmp));
+	if (cmp < 0) {
+		*rangep = -1;
+		return (0);
+	}
+	WT_RET(__wt_compare(session,
+	    clsm->lsm_tree->collator, key, &chunk->max_key, &cmp));
+	if (cmp > 0)
+		*rangep = 1;
+	return (0);
+}
+
+/*
+ * __clsm_prefix_init --
+ *	Start a prefix search for the cursor's key.
  */
 static int
-__clsm_get_current(
-    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int smallest, int *deletedp)
+__clsm_prefix_init(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm)
 {
-	WT_CURSOR *c, *current;
-	int cmp, multiple;
-	u_int i;
+	WT_CURSOR *cursor;
+	WT_ITEM prefix;
+	size_t size;
 
-	current = NULL;
-	multiple = 0;
+	cursor = &clsm->iface;
 
-	WT_FORALL_CURSORS(clsm, c, i) {
-		if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-			continue;
-		if (current == NULL) {
-			current = c;
-			continue;
+	/* The nul byte ending a packed string isn't part of the prefix. */
+	size = cursor->key.size;
+	if (size > 0 && strcmp(cursor->key_format, "S") == 0 &&
+	    ((const char *)cursor->key.data)[size - 1] == '\0')
+		--size;
+	WT_RET(__wt_buf_set(session, &clsm->prefix, cursor->key.data, size));
+	F_SET(clsm, WT_CLSM_PREFIX);
+
+	/*
+	 * If the prefix is long enough, hash the part of it added to Bloom
+	 * filters.
+	 */
+	if (clsm->lsm_tree->bloom_prefix != 0 &&
+	    size >= clsm->lsm_tree->bloom_prefix) {
+		WT_CLEAR(prefix);
+		prefix.data = cursor->key.data;
+		prefix.size = clsm->lsm_tree->bloom_prefix;
+		WT_RET(__wt_bloom_hash(NULL, &prefix, &clsm->prefix_hash));
+		F_SET(clsm, WT_CLSM_PREFIX_BLOOM);
+	}
+	return (0);
+}
+
+/*
+ * __clsm_prefix_match --
+ *	Check whether a key begins with the prefix being searched for.
+ */
+static inline int
+__clsm_prefix_match(WT_CURSOR_LSM *clsm, const WT_ITEM *key)
+{
+	return (key->size >= clsm->prefix.size &&
+	    memcmp(key->data, clsm->prefix.data, clsm->prefix.size) == 0);
+}
+
+/*
+ * __clsm_prefix_skip --
+ *	Check whether a prefix search can skip a chunk: either its smallest
+ *	key sorts after the keys beginning with the prefix, or its Bloom
+ *	filter has no keys beginning with the prefix.
+ */
+static inline int
+__clsm_prefix_skip(
+    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, u_int i, int *skipp)
+{
+	WT_BLOOM *bloom;
+	WT_DECL_RET;
+	WT_LSM_CHUNK *chunk;
+
+	*skipp = 0;
+	if (!F_ISSET(clsm, WT_CLSM_PREFIX))
+		return (0);
+
+	if ((chunk = clsm->keys[i]) != NULL &&
+	    !__clsm_prefix_match(clsm, &chunk->min_key) &&
+	    memcmp(chunk->min_key.data, clsm->prefix.data,
+	    WT_MIN(chunk->min_key.size, clsm->prefix.size)) > 0) {
+		WT_STAT_FAST_INCR(session,
+		    &clsm->lsm_tree->stats, lsm_lookup_key_range);
+		*skipp = 1;
+		return (0);
+	}
+
+	if (!F_ISSET(clsm, WT_CLSM_PREFIX_BLOOM) ||
+	    (bloom = clsm->blooms[i]) == NULL)
+		return (0);
+	if ((ret = __wt_bloom_hash_get(bloom, &clsm->prefix_hash)) == 0)
+		return (0);
+	WT_RET_NOTFOUND_OK(ret);
+	WT_STAT_FAST_INCR(session, &clsm->lsm_tree->stats, bloom_prefix_miss);
+	*skipp = 1;
+	return (0);
+}
+
+/*
+ * __clsm_prefix_end --
+ *	Finish a prefix search, there are no more keys with the prefix.
+ */
+static int
+__clsm_prefix_end(WT_CURSOR_LSM *clsm)
+{
+	F_CLR(&clsm->iface, WT_CURSTD_KEY_SET | WT_CURSTD_KEY_INT |
+	    WT_CURSTD_VALUE_SET | WT_CURSTD_VALUE_INT);
+	WT_RET(__clsm_reset_cursors(clsm, NULL));
+	return (WT_NOTFOUND);
+}
+
+/*
+ * The chunk cursors are kept in a binary heap while iterating, so finding the
+ * next key costs O(log chunks) comparisons rather than comparing every chunk
+ * cursor's key.  The top of the heap is the cursor with the smallest key when
+ * iterating forward, or the largest key when iterating backward; cursors with
+ * the same key are ordered newest chunk first, and exhausted cursors are not
+ * in the heap at all.
+ */
+
+/*
+ * __clsm_heap_before --
+ *	Check whether one heap entry sorts before another.
+ */
+static inline int
+__clsm_heap_before(WT_SESSION_IMPL *session,
+    WT_CURSOR_LSM *clsm, u_int a, u_int b, int *beforep)
+{
+	int cmp;
+
+	WT_RET(WT_LSM_CURCMP(session,
+	    clsm->lsm_tree, clsm->cursors[a], clsm->cursors[b], cmp));
+	if (F_ISSET(clsm, WT_CLSM_ITERATE_PREV))
+		cmp = -cmp;
+	*beforep = cmp < 0 || (cmp == 0 && a > b);
+	return (0);
+}
+
+/*
+ * __clsm_heap_sift --
+ *	Move a heap entry down until it sorts before its children.
+ */
+static int
+__clsm_heap_sift(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, u_int slot)
+{
+	u_int child, entry, *heap;
+	int before;
+
+	heap = clsm->heap;
+	for (entry = heap[slot];; slot = child) {
+		if ((child = 2 * slot + 1) >= clsm->heap_entries)
+			break;
+		if (child + 1 < clsm->heap_entries) {
+			WT_RET(__clsm_heap_before(session,
+			    clsm, heap[child + 1], heap[child], &before));
+			if (before)
+				++child;
+		}
+		WT_RET(__clsm_heap_before(
+		    session, clsm, entry, heap[child], &before));
+		if (before)
+			break;
+		heap[slot] = heap[child];
+	}
+	heap[slot] = entry;
+	return (0);
+}
+
+/*
+ * __clsm_heap_advance --
+ *	Move the cursor in a heap slot to its next key, removing it from the
+ *	heap if it has no more keys.  Only used for the top of the heap or its
+ *	children, which sort after the top whatever key they move to.
+ */
+static int
+__clsm_heap_advance(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, u_int slot)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+
+	c = clsm->cursors[clsm->heap[slot]];
+	ret = F_ISSET(clsm, WT_CLSM_ITERATE_NEXT) ? c->next(c) : c->prev(c);
+	if (ret == WT_NOTFOUND) {
+		if (--clsm->heap_entries == slot)
+			return (0);
+		clsm->heap[slot] = clsm->heap[clsm->heap_entries];
+	} else
+		WT_RET(ret);
+	return (__clsm_heap_sift(session, clsm, slot));
+}
+
+/*
+ * __clsm_heap_top --
+ *	Move past the key at the top of the heap in cursors from older chunks:
+ *	the top of the heap is from the newest chunk with the key, and hides
+ *	them.
+ */
+static int
+__clsm_heap_top(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm)
+{
+	u_int child;
+	int before, cmp;
+
+	/* The next key in the heap is one of the top's children. */
+	while (clsm->heap_entries > 1) {
+		child = 1;
+		if (clsm->heap_entries > 2) {
+			WT_RET(__clsm_heap_before(session,
+			    clsm, clsm->heap[2], clsm->heap[1], &before));
+			if (before)
+				child = 2;
 		}
-		WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree, c, current, cmp));
-		if (smallest ? cmp < 0 : cmp > 0) {
-			current = c;
-			multiple = 0;
-		} else if (cmp == 0)
-			multiple = 1;
+		WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree,
+		    clsm->cursors[clsm->heap[child]],
+		    clsm->cursors[clsm->heap[0]], cmp));
+		if (cmp != 0)
+			break;
+		WT_RET(__clsm_heap_advance(session, clsm, child));
 	}
+	return (0);
+}
+
+/*
+ * __clsm_heap_init --
+ *	Build the heap from the positioned chunk cursors, and check whether the
+ *	top of the heap is positioned at the cursor's key.
+ */
+static int
+__clsm_heap_init(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int *atkeyp)
+{
+	WT_CURSOR *c, *cursor;
+	u_int i, n, slot;
+	int cmp;
+
+	cursor = &clsm->iface;
+	*atkeyp = 0;
+
+	WT_RET(__wt_realloc_def(session,
+	    &clsm->heap_alloc, clsm->nchunks, &clsm->heap));
+	n = 0;
+	WT_FORALL_CURSORS(clsm, c, i)
+		if (F_ISSET(c, WT_CURSTD_KEY_INT))
+			clsm->heap[n++] = i;
+	clsm->heap_entries = n;
+	for (slot = n / 2; slot > 0;)
+		WT_RET(__clsm_heap_sift(session, clsm, --slot));
+	if (n == 0)
+		return (0);
+
+	/*
+	 * Check the key before moving any cursors: the cursor's key may
+	 * reference one of them.
+	 */
+	if (F_ISSET(cursor, WT_CURSTD_KEY_SET)) {
+		c = clsm->cursors[clsm->heap[0]];
+		WT_RET(__wt_compare(session,
+		    clsm->lsm_tree->collator, &c->key, &cursor->key, &cmp));
+		*atkeyp = cmp == 0;
+	}
+	return (__clsm_heap_top(session, clsm));
+}
+
+/*
+ * __clsm_get_current --
+ *	Copy the key/value from the cursor at the top of the heap.
+ */
+static int
+__clsm_get_current(WT_CURSOR_LSM *clsm, int *deletedp)
+{
+	WT_CURSOR *c, *current;
 
 	c = &clsm->iface;
-	if ((clsm->current = current) == NULL) {
+	if (clsm->heap_entries == 0) {
+		clsm->current = NULL;
 		F_CLR(c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 		return (WT_NOTFOUND);
 	}
-
-	if (multiple)
-		F_SET(clsm, WT_CLSM_MULTIPLE);
-	else
-		F_CLR(clsm, WT_CLSM_MULTIPLE);
+	current = clsm->current = clsm->cursors[clsm->heap[0]];
 
 	WT_RET(current->get_key(current, &c->key));
 	WT_RET(current->get_value(current, &c->value));
@@ -778,7 +1040,7 @@ __clsm_next(WT_CURSOR *cursor)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	u_int i;
-	int check, cmp, deleted;
+	int atkey, cmp, deleted, range, skip;
 
 	clsm = (WT_CURSOR_LSM *)cursor;
 
@@ -788,23 +1050,24 @@ __clsm_next(WT_CURSOR *cursor)
 
 	/* If we aren't positioned for a forward scan, get started. */
 	if (clsm->current == NULL || !F_ISSET(clsm, WT_CLSM_ITERATE_NEXT)) {
-		F_CLR(clsm, WT_CLSM_MULTIPLE);
 		WT_FORALL_CURSORS(clsm, c, i) {
 			if (!F_ISSET(cursor, WT_CURSTD_KEY_SET)) {
 				WT_ERR(c->reset(c));
 				ret = c->next(c);
 			} else if (c != clsm->current) {
+				/* Skip chunks with no keys after the key. */
+				WT_ERR(__clsm_key_range(
+				    session, clsm, i, &cursor->key, &range));
+				WT_ERR(__clsm_prefix_skip(
+				    session, clsm, i, &skip));
+				if (range > 0 || skip) {
+					WT_ERR(c->reset(c));
+					continue;
+				}
 				c->set_key(c, &cursor->key);
 				if ((ret = c->search_near(c, &cmp)) == 0) {
 					if (cmp < 0)
 						ret = c->next(c);
-					else if (cmp == 0) {
-						if (clsm->current == NULL)
-							clsm->current = c;
-						else
-							F_SET(clsm,
-							    WT_CLSM_MULTIPLE);
-					}
 				} else
 					F_CLR(c, WT_CURSTD_KEY_SET);
 			}
@@ -812,41 +1075,26 @@ __clsm_next(WT_CURSOR *cursor)
 		}
 		F_SET(clsm, WT_CLSM_ITERATE_NEXT);
 		F_CLR(clsm, WT_CLSM_ITERATE_PREV);
+		WT_ERR(__clsm_heap_init(session, clsm, &atkey));
 
-		/* We just positioned *at* the key, now move. */
-		if (clsm->current != NULL)
+		/* If we positioned *at* the key, move. */
+		if (atkey)
 			goto retry;
 	} else {
-retry:		/*
-		 * If there are multiple cursors on that key, move them
-		 * forward.
-		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = 0;
-			WT_FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-					continue;
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session,
-					    clsm->lsm_tree, c, clsm->current,
-					    cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->next(c));
-				}
-				if (c == clsm->current)
-					check = 1;
-			}
-		}
-
-		/* Move the smallest cursor forward. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->next(c));
+retry:		/* Move the cursor at the top of the heap forward. */
+		WT_ERR(__clsm_heap_advance(session, clsm, 0));
+		WT_ERR(__clsm_heap_top(session, clsm));
 	}
 
-	/* Find the cursor(s) with the smallest key. */
-	if ((ret = __clsm_get_current(session, clsm, 1, &deleted)) == 0 &&
-	    deleted)
-		goto retry;
+	/* The cursor at the top of the heap has the smallest key. */
+	if ((ret = __clsm_get_current(clsm, &deleted)) == 0) {
+		/* Prefix searches end at the first key without the prefix. */
+		if (F_ISSET(clsm, WT_CLSM_PREFIX) &&
+		    !__clsm_prefix_match(clsm, &cursor->key))
+			WT_ERR(__clsm_prefix_end(clsm));
+		if (deleted)
+			goto retry;
+	}
 
 err:	__clsm_leave(clsm);
 	API_END(session, ret);
@@ -867,7 +1115,7 @@ __clsm_prev(WT_CURSOR *cursor)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	u_int i;
-	int check, cmp, deleted;
+	int atkey, cmp, deleted, range, skip;
 
 	clsm = (WT_CURSOR_LSM *)cursor;
 
@@ -877,64 +1125,51 @@ __clsm_prev(WT_CURSOR *cursor)
 
 	/* If we aren't positioned for a reverse scan, get started. */
 	if (clsm->current == NULL || !F_ISSET(clsm, WT_CLSM_ITERATE_PREV)) {
-		F_CLR(clsm, WT_CLSM_MULTIPLE);
 		WT_FORALL_CURSORS(clsm, c, i) {
 			if (!F_ISSET(cursor, WT_CURSTD_KEY_SET)) {
 				WT_ERR(c->reset(c));
 				ret = c->prev(c);
 			} else if (c != clsm->current) {
+				/* Skip chunks with no keys before the key. */
+				WT_ERR(__clsm_key_range(
+				    session, clsm, i, &cursor->key, &range));
+				WT_ERR(__clsm_prefix_skip(
+				    session, clsm, i, &skip));
+				if (range < 0 || skip) {
+					WT_ERR(c->reset(c));
+					continue;
+				}
 				c->set_key(c, &cursor->key);
 				if ((ret = c->search_near(c, &cmp)) == 0) {
 					if (cmp > 0)
 						ret = c->prev(c);
-					else if (cmp == 0) {
-						if (clsm->current == NULL)
-							clsm->current = c;
-						else
-							F_SET(clsm,
-							    WT_CLSM_MULTIPLE);
-					}
-				}
+				} else
+					F_CLR(c, WT_CURSTD_KEY_SET);
 			}
 			WT_ERR_NOTFOUND_OK(ret);
 		}
 		F_SET(clsm, WT_CLSM_ITERATE_PREV);
 		F_CLR(clsm, WT_CLSM_ITERATE_NEXT);
+		WT_ERR(__clsm_heap_init(session, clsm, &atkey));
 
-		/* We just positioned *at* the key, now move. */
-		if (clsm->current != NULL)
+		/* If we positioned *at* the key, move. */
+		if (atkey)
 			goto retry;
 	} else {
-retry:		/*
-		 * If there are multiple cursors on that key, move them
-		 * backwards.
-		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = 0;
-			WT_FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-					continue;
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session,
-					    clsm->lsm_tree, c, clsm->current,
-					    cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->prev(c));
-				}
-				if (c == clsm->current)
-					check = 1;
-			}
-		}
-
-		/* Move the smallest cursor backwards. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->prev(c));
+retry:		/* Move the cursor at the top of the heap backwards. */
+		WT_ERR(__clsm_heap_advance(session, clsm, 0));
+		WT_ERR(__clsm_heap_top(session, clsm));
 	}
 
-	/* Find the cursor(s) with the largest key. */
-	if ((ret = __clsm_get_current(session, clsm, 0, &deleted)) == 0 &&
-	    deleted)
-		goto retry;
+	/* The cursor at the top of the heap has the largest key. */
+	if ((ret = __clsm_get_current(clsm, &deleted)) == 0) {
+		/* Prefix searches end at the first key without the prefix. */
+		if (F_ISSET(clsm, WT_CLSM_PREFIX) &&
+		    !__clsm_prefix_match(clsm, &cursor->key))
+			WT_ERR(__clsm_prefix_end(clsm));
+		if (deleted)
+			goto retry;
+	}
 
 err:	__clsm_leave(clsm);
 	API_END(session, ret);
@@ -957,6 +1192,9 @@ __clsm_reset_cursors(WT_CURSOR_LSM *clsm, WT_CURSOR *skip)
 	WT_DECL_RET;
 	u_int i;
 
+	/* Repositioning the cursor ends any prefix search. */
+	F_CLR(clsm, WT_CLSM_PREFIX | WT_CLSM_PREFIX_BLOOM);
+
 	/* Fast path if the cursor is not positioned. */
 	if ((clsm->current == NULL || clsm->current == skip) &&
 	    !F_ISSET(clsm, WT_CLSM_ITERATE_NEXT | WT_CLSM_ITERATE_PREV))
@@ -1015,7 +1253,7 @@ __clsm_lookup(WT_CURSOR_LSM *clsm, WT_ITEM *value)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	u_int i;
-	int have_hash;
+	int have_hash, range;
 
 	c = NULL;
 	cursor = &clsm->iface;
@@ -1023,6 +1261,15 @@ __clsm_lookup(WT_CURSOR_LSM *clsm, WT_ITEM *value)
 	session = (WT_SESSION_IMPL *)cursor->session;
 
 	WT_FORALL_CURSORS(clsm, c, i) {
+		/* Skip chunks whose key range can't include the key. */
+		WT_ERR(__clsm_key_range(
+		    session, clsm, i, &cursor->key, &range));
+		if (range != 0) {
+			WT_STAT_FAST_INCR(session,
+			    &clsm->lsm_tree->stats, lsm_lookup_key_range);
+			continue;
+		}
+
 		/* If there is a Bloom filter, see if we can skip the read. */
 		bloom = NULL;
 		if ((bloom = clsm->blooms[i]) != NULL) {
@@ -1114,11 +1361,11 @@ __clsm_search_near(WT_CURSOR *cursor, int *exactp)
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	u_int i;
-	int cmp, deleted, exact;
+	int cmp, deleted, exact, prefix, range, skip;
 
 	closest = NULL;
 	clsm = (WT_CURSOR_LSM *)cursor;
-	deleted = exact = 0;
+	deleted = exact = prefix = 0;
 
 	CURSOR_API_CALL(cursor, session, search_near, NULL);
 	WT_CURSOR_NEEDKEY(cursor);
@@ -1126,6 +1373,12 @@ __clsm_search_near(WT_CURSOR *cursor, int *exactp)
 	WT_ERR(__clsm_enter(clsm, 1, 0));
 	F_CLR(clsm, WT_CLSM_ITERATE_NEXT | WT_CLSM_ITERATE_PREV);
 
+	/* Search for keys beginning with the search key, if configured. */
+	if (F_ISSET(clsm, WT_CLSM_PREFIX_SEARCH)) {
+		WT_ERR(__clsm_prefix_init(session, clsm));
+		prefix = 1;
+	}
+
 	/*
 	 * search_near is somewhat fiddly: we can't just use a nearby key from
 	 * the in-memory chunk because there could be a closer key on disk.
@@ -1137,6 +1390,14 @@ __clsm_search_near(WT_CURSOR *cursor, int *exactp)
 	 * position on the last record in the tree.
 	 */
 	WT_FORALL_CURSORS(clsm, c, i) {
+		/* Skip chunks with no keys after the search key. */
+		WT_ERR(__clsm_key_range(
+		    session, clsm, i, &cursor->key, &range));
+		WT_ERR(__clsm_prefix_skip(session, clsm, i, &skip));
+		if (range > 0 || skip) {
+			WT_ERR(c->reset(c));
+			continue;
+		}
 		c->set_key(c, &cursor->key);
 		if ((ret = c->search_near(c, &cmp)) == WT_NOTFOUND) {
 			ret = 0;
@@ -1207,7 +1468,16 @@ __clsm_search_near(WT_CURSOR *cursor, int *exactp)
 		}
 		WT_ERR_NOTFOUND_OK(ret);
 	}
-	if (deleted) {
+
+	/*
+	 * Prefix searches only find keys beginning with the search key, they
+	 * never move backwards.  Moving forward may already have ended
+	 * the prefix search.
+	 */
+	if (prefix) {
+		if (deleted || !__clsm_prefix_match(clsm, &cursor->key))
+			WT_ERR(__clsm_prefix_end(clsm));
+	} else if (deleted) {
 		clsm->current = NULL;
 		WT_ERR(cursor->prev(cursor));
 		cmp = -1;
@@ -1239,6 +1509,7 @@ __clsm_put(WT_SESSION_IMPL *session,
 {
 	WT_CURSOR *c, *primary;
 	WT_LSM_TREE *lsm_tree;
+	uint64_t sleep_us;
 	u_int i, slot;
 
 	lsm_tree = clsm->lsm_tree;
@@ -1277,26 +1548,24 @@ __clsm_put(WT_SESSION_IMPL *session,
 	/*
 	 * Update the record count.  It is in a shared structure, but it's only
 	 * approximate, so don't worry about protecting access.
-	 *
-	 * Throttle if necessary.  Every 100 update operations on each cursor,
-	 * check if throttling is required.  Don't rely only on the shared
-	 * counter because it can race, and because for some workloads, there
-	 * may not be enough records per chunk to get effective throttling.
 	 */
-	if ((++clsm->primary_chunk->count % 100 == 0 ||
-	    ++clsm->update_count >= 100) &&
-	    lsm_tree->merge_throttle + lsm_tree->ckpt_throttle > 0) {
-		clsm->update_count = 0;
-		WT_STAT_FAST_INCRV(session, &clsm->lsm_tree->stats,
-		    lsm_checkpoint_throttle, (uint64_t)lsm_tree->ckpt_throttle);
-		WT_STAT_FAST_CONN_INCRV(session,
-		    lsm_checkpoint_throttle, (uint64_t)lsm_tree->ckpt_throttle);
-		WT_STAT_FAST_INCRV(session, &clsm->lsm_tree->stats,
-		    lsm_merge_throttle, (uint64_t)lsm_tree->merge_throttle);
-		WT_STAT_FAST_CONN_INCRV(session,
-		    lsm_merge_throttle, (uint64_t)lsm_tree->merge_throttle);
-		__wt_sleep(0,
-		    lsm_tree->ckpt_throttle + lsm_tree->merge_throttle);
+	++clsm->primary_chunk->count;
+
+	/*
+	 * Throttle if necessary.  Each update adds the tree's current delay
+	 * to the cursor's debt, and the cursor sleeps whenever it owes enough
+	 * time: every writer is slowed in proportion to its updates, by short,
+	 * regular sleeps rather than occasional long ones.
+	 */
+	if (lsm_tree->throttle > 0 &&
+	    (clsm->throttle_debt += lsm_tree->throttle) >=
+	    WT_LSM_THROTTLE_SLEEP) {
+		sleep_us = clsm->throttle_debt / WT_THOUSAND;
+		clsm->throttle_debt %= WT_THOUSAND;
+		WT_STAT_FAST_INCRV(session,
+		    &clsm->lsm_tree->stats, lsm_throttle, sleep_us);
+		WT_STAT_FAST_CONN_INCRV(session, lsm_throttle, sleep_us);
+		__wt_sleep(0, (long)sleep_us);
 	}
 
 	return (0);
@@ -1419,7 +1688,10 @@ __clsm_close(WT_CURSOR *cursor)
 	WT_TRET(__clsm_close_cursors(clsm, 0, clsm->nchunks));
 	__wt_free(session, clsm->blooms);
 	__wt_free(session, clsm->cursors);
+	__wt_free(session, clsm->keys);
+	__wt_free(session, clsm->heap);
 	__wt_free(session, clsm->switch_txn);
+	__wt_buf_free(session, &clsm->prefix);
 
 	/* In case we were somehow left positioned, clear that. */
 	__clsm_leave(clsm);
@@ -1457,6 +1729,7 @@ __wt_clsm_open(WT_SESSION_IMPL *session,
 	    __clsm_insert,		/* insert */
 	    __clsm_update,		/* update */
 	    __clsm_remove,		/* remove */
+	    __wt_cursor_modify_notsup,	/* modify */
 	    __wt_cursor_reconfigure,	/* reconfigure */
 	    __clsm_close);		/* close */
 	WT_CURSOR *cursor;
@@ -1491,6 +1764,15 @@ __wt_clsm_open(WT_SESSION_IMPL *session,
 
 	clsm->lsm_tree = lsm_tree;
 
+	WT_ERR(__wt_config_gets_def(session, cfg, "prefix_search", 0, &cval));
+	if (cval.val != 0) {
+		if (lsm_tree->collator != NULL)
+			WT_ERR_MSG(session, EINVAL,
+			    "LSM prefix searches are not supported with a "
+			    "custom collator");
+		F_SET(clsm, WT_CLSM_PREFIX_SEARCH);
+	}
+
 	/*
 	 * The tree's dsk_gen starts at one, so starting the cursor on zero
 	 * will force a call into open_cursors on the first operation.
@@ -259,6 +259,8 @@ __wt_lsm_manager_free_work_unit(
 	if (entry != NULL) {
 		WT_ASSERT(session, entry->lsm_tree->queue_ref > 0);
 
+		if (F_ISSET(entry, WT_LSM_WORK_ACTIVE))
+			(void)WT_ATOMIC_SUB4(entry->lsm_tree->work_active, 1);
 		(void)WT_ATOMIC_SUB4(entry->lsm_tree->queue_ref, 1);
 		__wt_free(session, entry);
 	}
@@ -580,36 +582,112 @@ __wt_lsm_manager_clear_tree(
 	return (0);
 }
 
+/*
+ * Work units gain one point of urgency for every WT_LSM_WORK_AGE_MS
+ * milliseconds they wait in a queue, so work for quiet trees is not starved
+ * by busy trees.
+ */
+#define	WT_LSM_WORK_AGE_MS	10
+
+/*
+ * __lsm_manager_urgency --
+ *	Return how urgently an LSM tree needs maintenance. The tree is read
+ *	without locking, the result is only a hint.
+ */
+static uint64_t
+__lsm_manager_urgency(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	uint64_t cache_size, urgency;
+	u_int limit;
+
+	/*
+	 * The number of chunks, as a percentage of the configured chunk count
+	 * limit or, if there isn't one, of the chunks a merge can combine.
+	 */
+	limit = lsm_tree->chunk_count_limit != 0 ?
+	    lsm_tree->chunk_count_limit : lsm_tree->merge_max;
+	urgency = limit == 0 ? 0 : (uint64_t)lsm_tree->nchunks * 100 / limit;
+
+	/*
+	 * Trees throttling updates are slowing the application down: add the
+	 * same again as a tree at its limit, plus one for every 100us each
+	 * update is delayed.
+	 */
+	if (lsm_tree->throttle > 0)
+		urgency += 100 + lsm_tree->throttle / (100 * WT_THOUSAND);
+
+	/* Chunks waiting to be flushed, as a percentage of the cache. */
+	cache_size = S2C(session)->cache_size;
+	if (cache_size != 0)
+		urgency += lsm_tree->flush_pending * 100 / cache_size;
+
+	return (urgency);
+}
+
+/*
+ * __lsm_manager_score --
+ *	Return the priority of a queued work unit: the urgency of its tree,
+ *	shared between the work units already running for the tree, plus
+ *	the time the unit has been waiting.
+ */
+static uint64_t
+__lsm_manager_score(WT_SESSION_IMPL *session,
+    WT_LSM_WORK_UNIT *entry, struct timespec *now)
+{
+	WT_LSM_TREE *lsm_tree;
+	uint64_t score;
+
+	lsm_tree = entry->lsm_tree;
+	score = __lsm_manager_urgency(session, lsm_tree) /
+	    (1 + lsm_tree->work_active);
+	if (WT_TIMECMP(*now, entry->push_ts) > 0)
+		score += WT_TIMEDIFF(*now, entry->push_ts) /
+		    (WT_LSM_WORK_AGE_MS * WT_MILLION);
+	return (score);
+}
+
 /*
  * We assume this is only called from __wt_lsm_manager_pop_entry and we
- * have session, entry and type available to use.  If the queue is empty
- * we may return from the macro.
+ * have session, entry, current, now, score, best_score and type available
+ * to use.  If the queue is empty we may return from the macro.  Take the
+ * matching work unit with the highest score, the oldest if there is a tie.
  */
 #define	LSM_POP_ENTRY(qh, qlock, qlen) do {				\
 	if (TAILQ_EMPTY(qh))						\
 		return (0);						\
+	WT_RET(__wt_epoch(session, &now));				\
+	best_score = 0;							\
 	__wt_spin_lock(session, qlock);					\
-	TAILQ_FOREACH(entry, (qh), q) {					\
-		if (FLD_ISSET(type, entry->type)) {			\
-			TAILQ_REMOVE(qh, entry, q);			\
-			WT_STAT_FAST_CONN_DECR(session, qlen);		\
-			break;						\
+	TAILQ_FOREACH(current, (qh), q) {				\
+		if (!FLD_ISSET(type, current->type))			\
+			continue;					\
+		score = __lsm_manager_score(session, current, &now);	\
+		if (entry == NULL || score > best_score) {		\
+			entry = current;				\
+			best_score = score;				\
 		}							\
 	}								\
+	if (entry != NULL) {						\
+		TAILQ_REMOVE(qh, entry, q);				\
+		WT_STAT_FAST_CONN_DECR(session, qlen);			\
+	}								\
 	__wt_spin_unlock(session, (qlock));				\
 } while (0)
 
 /*
  * __wt_lsm_manager_pop_entry --
- *	Retrieve the head of the queue, if it matches the requested work
- *	unit type.
+ *	Retrieve the most urgent work unit from the queue matching the
+ *	requested work unit type.
  */
 int
 __wt_lsm_manager_pop_entry(
     WT_SESSION_IMPL *session, uint32_t type, WT_LSM_WORK_UNIT **entryp)
 {
 	WT_LSM_MANAGER *manager;
-	WT_LSM_WORK_UNIT *entry;
+	WT_LSM_TREE *lsm_tree;
+	WT_LSM_WORK_UNIT *current, *entry;
+	struct timespec now;
+	uint64_t best_score, score, waitus;
 
 	manager = &S2C(session)->lsm_manager;
 	*entryp = NULL;
@@ -627,8 +705,27 @@ __wt_lsm_manager_pop_entry(
 	else
 		LSM_POP_ENTRY(&manager->appqh,
 		    &manager->app_lock, lsm_work_queue_app);
-	if (entry != NULL)
+	if (entry != NULL) {
 		WT_STAT_FAST_CONN_INCR(session, lsm_work_units_done);
+
+		/*
+		 * The work unit is running: other work for the tree gives way
+		 * to work for other trees until it completes.
+		 */
+		lsm_tree = entry->lsm_tree;
+		F_SET(entry, WT_LSM_WORK_ACTIVE);
+		(void)WT_ATOMIC_ADD4(lsm_tree->work_active, 1);
+
+		waitus = WT_TIMECMP(now, entry->push_ts) > 0 ?
+		    WT_TIMEDIFF(now, entry->push_ts) / WT_THOUSAND : 0;
+		WT_STAT_FAST_INCR(
+		    session, &lsm_tree->stats, lsm_work_units_done);
+		WT_STAT_FAST_INCRV(session,
+		    &lsm_tree->stats, lsm_work_queue_wait, waitus);
+		if (waitus > WT_STAT(&lsm_tree->stats, lsm_work_queue_wait_max))
+			WT_STAT_FAST_SET(session,
+			    &lsm_tree->stats, lsm_work_queue_wait_max, waitus);
+	}
 	*entryp = entry;
 	return (0);
 }
@@ -679,6 +776,7 @@ __wt_lsm_manager_push_entry(WT_SESSION_IMPL *session,
 	entry->type = type;
 	entry->flags = flags;
 	entry->lsm_tree = lsm_tree;
+	entry->push_ts = lsm_tree->work_push_ts;
 	(void)WT_ATOMIC_ADD4(lsm_tree->queue_ref, 1);
 	WT_STAT_FAST_CONN_INCR(session, lsm_work_units_created);
 
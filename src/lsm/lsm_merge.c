@@ -13,28 +13,36 @@ static int __lsm_merge_span(
 
 /*
  * __wt_lsm_merge_update_tree --
- *	Merge a set of chunks and populate a new one.
+ *	Merge a set of chunks and populate one or more new ones.
  *	Must be called with the LSM lock held.
  */
 int
 __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks,
-    WT_LSM_CHUNK *chunk)
+    WT_LSM_CHUNK **chunks, u_int nnew)
 {
 	size_t chunks_after_merge;
 
+	/* A merge split into key ranges can create more chunks than it uses. */
+	if (nnew > nchunks)
+		WT_RET(__wt_realloc_def(session, &lsm_tree->chunk_alloc,
+		    lsm_tree->nchunks + (nnew - nchunks), &lsm_tree->chunk));
+
 	WT_RET(__wt_lsm_tree_retire_chunks(
 	    session, lsm_tree, start_chunk, nchunks));
 
 	/* Update the current chunk list. */
 	chunks_after_merge = lsm_tree->nchunks - (nchunks + start_chunk);
-	memmove(lsm_tree->chunk + start_chunk + 1,
+	memmove(lsm_tree->chunk + start_chunk + nnew,
 	    lsm_tree->chunk + start_chunk + nchunks,
 	    chunks_after_merge * sizeof(*lsm_tree->chunk));
-	lsm_tree->nchunks -= nchunks - 1;
-	memset(lsm_tree->chunk + lsm_tree->nchunks, 0,
-	    (nchunks - 1) * sizeof(*lsm_tree->chunk));
-	lsm_tree->chunk[start_chunk] = chunk;
+	if (nchunks > nnew) {
+		lsm_tree->nchunks -= nchunks - nnew;
+		memset(lsm_tree->chunk + lsm_tree->nchunks, 0,
+		    (nchunks - nnew) * sizeof(*lsm_tree->chunk));
+	} else
+		lsm_tree->nchunks += nnew - nchunks;
+	memcpy(lsm_tree->chunk + start_chunk, chunks, nnew * sizeof(*chunks));
 
 	return (0);
 }
@@ -79,7 +87,14 @@ __lsm_merge_span(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
 	merge_min = (aggressive > WT_LSM_AGGRESSIVE_THRESHOLD) ?
 	    2 : lsm_tree->merge_min;
 	max_gap = (aggressive + 4) / 5;
-	max_level = (lsm_tree->merge_throttle > 0) ? 0 : id + aggressive;
+
+	/*
+	 * If updates are being throttled and most of the backlog is waiting
+	 * for merges, only merge level 0 chunks.
+	 */
+	max_level = (lsm_tree->throttle > 0 &&
+	    2 * lsm_tree->backlog_merge > lsm_tree->backlog) ?
+	    0 : id + aggressive;
 
 	/*
 	 * If there aren't any chunks to merge, or some of the chunks aren't
@@ -226,91 +241,341 @@ __lsm_merge_span(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
 }
 
 /*
- * __wt_lsm_merge --
- *	Merge a set of chunks of an LSM tree.
+ * __lsm_merge_key_range --
+ *	Find the range of keys in a set of chunks.  The range is unknown (the
+ *	keys are NULL) if the range of any of the chunks is unknown.
  */
-int
-__wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
+static int
+__lsm_merge_key_range(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_CHUNK **chunks, u_int nchunks, WT_ITEM **minp, WT_ITEM **maxp)
+{
+	WT_ITEM *max_key, *min_key;
+	WT_LSM_CHUNK *chunk;
+	u_int i;
+	int cmp;
+
+	*minp = *maxp = NULL;
+
+	max_key = min_key = NULL;
+	for (i = 0; i < nchunks; i++) {
+		chunk = chunks[i];
+		if (!F_ISSET(chunk, WT_LSM_CHUNK_KEYS))
+			return (0);
+		if (min_key == NULL) {
+			min_key = &chunk->min_key;
+			max_key = &chunk->max_key;
+			continue;
+		}
+		WT_RET(__wt_compare(session,
+		    lsm_tree->collator, &chunk->min_key, min_key, &cmp));
+		if (cmp < 0)
+			min_key = &chunk->min_key;
+		WT_RET(__wt_compare(session,
+		    lsm_tree->collator, &chunk->max_key, max_key, &cmp));
+		if (cmp > 0)
+			max_key = &chunk->max_key;
+	}
+
+	*minp = min_key;
+	*maxp = max_key;
+	return (0);
+}
+
+/*
+ * __lsm_merge_overlaps --
+ *	Check whether a chunk could contain keys in a range.  Chunks with an
+ *	unknown range, and unknown ranges, overlap everything.
+ */
+static int
+__lsm_merge_overlaps(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_CHUNK *chunk, WT_ITEM *min_key, WT_ITEM *max_key, int *overlapp)
+{
+	int cmp;
+
+	*overlapp = 1;
+	if (min_key == NULL || !F_ISSET(chunk, WT_LSM_CHUNK_KEYS))
+		return (0);
+
+	WT_RET(__wt_compare(session,
+	    lsm_tree->collator, &chunk->max_key, min_key, &cmp));
+	if (cmp < 0) {
+		*overlapp = 0;
+		return (0);
+	}
+	WT_RET(__wt_compare(session,
+	    lsm_tree->collator, &chunk->min_key, max_key, &cmp));
+	*overlapp = cmp <= 0;
+	return (0);
+}
+
+/*
+ * __lsm_merge_minor --
+ *	Check whether a merge is "minor", that is, whether older chunks could
+ *	contain keys in the range being merged, so tombstones must be kept.
+ *	If the key ranges of the chunks are known and none of the older chunks
+ *	overlap the chunks being merged, tombstones can be discarded as if the
+ *	oldest chunk were included in the merge.
+ */
+static int
+__lsm_merge_minor(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks, int *minorp)
+{
+	WT_ITEM *max_key, *min_key;
+	u_int i;
+	int overlap;
+
+	*minorp = start_chunk != 0;
+	if (start_chunk == 0)
+		return (0);
+
+	/* Find the range of keys being merged. */
+	WT_RET(__lsm_merge_key_range(session, lsm_tree,
+	    lsm_tree->chunk + start_chunk, nchunks, &min_key, &max_key));
+	if (min_key == NULL)
+		return (0);
+
+	/* Check the older chunks don't overlap that range. */
+	for (i = 0; i < start_chunk; i++) {
+		WT_RET(__lsm_merge_overlaps(session,
+		    lsm_tree, lsm_tree->chunk[i], min_key, max_key, &overlap));
+		if (overlap)
+			return (0);
+	}
+
+	*minorp = 0;
+	return (0);
+}
+
+/*
+ * __lsm_merge_resplit --
+ *	Check whether a merge would only concatenate the key ranges an earlier
+ *	merge split its output into: chunks of the same generation, with no
+ *	overlapping keys, no more of them than a merge is split into.  Merging
+ *	them would rewrite the records and split them into the same chunks.
+ */
+static int
+__lsm_merge_resplit(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int nchunks, int *resplitp)
+{
+	WT_LSM_CHUNK *a, *b;
+	u_int i, j;
+	int cmp;
+
+	*resplitp = 0;
+	if (nchunks > lsm_tree->merge_partitions)
+		return (0);
+
+	for (i = 0; i < nchunks; i++) {
+		a = lsm_tree->chunk[start_chunk + i];
+		if (!F_ISSET(a, WT_LSM_CHUNK_KEYS) || a->generation == 0 ||
+		    a->generation != lsm_tree->chunk[start_chunk]->generation)
+			return (0);
+		for (j = 0; j < i; j++) {
+			b = lsm_tree->chunk[start_chunk + j];
+			WT_RET(__wt_compare(session, lsm_tree->collator,
+			    &a->max_key, &b->min_key, &cmp));
+			if (cmp < 0)
+				continue;
+			WT_RET(__wt_compare(session, lsm_tree->collator,
+			    &a->min_key, &b->max_key, &cmp));
+			if (cmp <= 0)
+				return (0);
+		}
+	}
+
+	*resplitp = 1;
+	return (0);
+}
+
+/*
+ * __lsm_merge_discard --
+ *	Discard a chunk created by a merge that failed.
+ */
+static int
+__lsm_merge_discard(WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk)
+{
+	WT_DECL_RET;
+	int tret;
+	const char *drop_cfg[] =
+	    { WT_CONFIG_BASE(session, session_drop), "force", NULL };
+
+	/* Drop the newly-created files. */
+	if (chunk->uri != NULL) {
+		WT_WITH_SCHEMA_LOCK(session,
+		    tret = __wt_schema_drop(session, chunk->uri, drop_cfg));
+		WT_TRET(tret);
+	}
+	if (chunk->bloom_uri != NULL) {
+		WT_WITH_SCHEMA_LOCK(session,
+		    tret = __wt_schema_drop(
+		    session, chunk->bloom_uri, drop_cfg));
+		WT_TRET(tret);
+	}
+	__wt_bloom_blocks_free(session, &chunk->bloom_blocks);
+	__wt_buf_free(session, &chunk->min_key);
+	__wt_buf_free(session, &chunk->max_key);
+	__wt_free(session, chunk->bloom_uri);
+	__wt_free(session, chunk->uri);
+	__wt_free(session, chunk);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_split_free --
+ *	Free a merge's key ranges.
+ */
+static void
+__lsm_merge_split_free(WT_SESSION_IMPL *session, WT_LSM_MERGE_SPLIT *split)
+{
+	u_int i;
+
+	for (i = 0; i < split->nparts; i++)
+		__wt_buf_free(session, &split->parts[i].start);
+	__wt_free(session, split->parts);
+	__wt_free(session, split->chunks);
+	__wt_free(session, split);
+}
+
+/*
+ * __lsm_merge_split --
+ *	Split a merge into at most nparts key ranges.  The ranges start at
+ *	quantiles of a random sample of keys from the chunks being merged, with
+ *	each chunk sampled in proportion to its records, so the ranges hold
+ *	roughly the same number of records.
+ */
+static int
+__lsm_merge_split(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_MERGE_SPLIT *split, u_int nparts)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_ITEM key, *samples, tmp;
+	WT_LSM_CHUNK **chunks;
+	uint64_t n, total;
+	u_int i, j, nsamples;
+	int cmp;
+	const char *cfg[3];
+
+	c = NULL;
+	chunks = split->chunks;
+	samples = NULL;
+	nsamples = 0;
+
+	WT_RET(__wt_calloc_def(session, nparts, &split->parts));
+	split->nparts = 1;
+	if (nparts == 1)
+		return (0);
+
+#define	WT_LSM_MERGE_SAMPLES	20	/* Keys sampled for each key range */
+	total = (uint64_t)WT_LSM_MERGE_SAMPLES * nparts;
+	WT_ERR(__wt_calloc_def(
+	    session, (size_t)total + split->nchunks, &samples));
+
+	cfg[0] = WT_CONFIG_BASE(session, session_open_cursor);
+	cfg[1] = "checkpoint=" WT_CHECKPOINT ",raw,next_random";
+	cfg[2] = NULL;
+	for (i = 0; i < split->nchunks; i++) {
+		if (split->record_count == 0)
+			n = total / split->nchunks + 1;
+		else
+			n = total * chunks[i]->count / split->record_count + 1;
+		WT_ERR(__wt_open_cursor(
+		    session, chunks[i]->uri, NULL, cfg, &c));
+		for (; n > 0 && (ret = c->next(c)) == 0; --n) {
+			WT_ERR(c->get_key(c, &key));
+			WT_ERR(__wt_buf_set(session,
+			    &samples[nsamples], key.data, key.size));
+			++nsamples;
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+		WT_ERR(c->close(c));
+		c = NULL;
+	}
+
+	/* Sort the sample: it is small, an insertion sort is fine. */
+	for (i = 1; i < nsamples; i++)
+		for (j = i; j > 0; j--) {
+			WT_ERR(__wt_compare(session, lsm_tree->collator,
+			    &samples[j - 1], &samples[j], &cmp));
+			if (cmp <= 0)
+				break;
+			tmp = samples[j - 1];
+			samples[j - 1] = samples[j];
+			samples[j] = tmp;
+		}
+
+	/* Start a key range at each quantile, skipping duplicate keys. */
+	for (i = 1; nsamples > 0 && i < nparts; i++) {
+		j = (u_int)((uint64_t)i * nsamples / nparts);
+		if (split->nparts > 1) {
+			WT_ERR(__wt_compare(session, lsm_tree->collator,
+			    &samples[j], &split->parts[split->nparts - 1].start,
+			    &cmp));
+			if (cmp <= 0)
+				continue;
+		}
+		WT_ERR(__wt_buf_set(session, &split->parts[split->nparts].start,
+		    samples[j].data, samples[j].size));
+		++split->nparts;
+	}
+
+err:	if (c != NULL)
+		WT_TRET(c->close(c));
+	if (samples != NULL) {
+		for (i = 0; i < nsamples; i++)
+			__wt_buf_free(session, &samples[i]);
+		__wt_free(session, samples);
+	}
+	return (ret);
+}
+
+/*
+ * __lsm_merge_part --
+ *	Merge a key range of a set of chunks into a new chunk.  Returns
+ *	WT_NOTFOUND if there are no records in the key range, other than the
+ *	first: it always creates a chunk, so a merge always has a chunk to
+ *	install in place of the chunks it merged.
+ */
+static int
+__lsm_merge_part(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_MERGE_SPLIT *split, u_int partno)
 {
 	WT_BLOOM *bloom;
 	WT_CURSOR *dest, *src;
+	WT_DECL_ITEM(prefix);
 	WT_DECL_RET;
 	WT_ITEM key, value;
 	WT_LSM_CHUNK *chunk;
-	uint32_t generation;
+	WT_LSM_MERGE_PART *next, *part;
 	uint64_t insert_count, record_count;
-	u_int dest_id, end_chunk, i, nchunks, start_chunk, start_id;
-	u_int created_chunk, verb;
-	int create_bloom, locked, in_sync, tret;
+	int cmp, exact, in_sync;
 	const char *cfg[3];
-	const char *drop_cfg[] =
-	    { WT_CONFIG_BASE(session, session_drop), "force", NULL };
 
 	bloom = NULL;
-	chunk = NULL;
-	create_bloom = 0;
-	created_chunk = 0;
 	dest = src = NULL;
-	locked = 0;
-	start_id = 0;
 	in_sync = 0;
+	insert_count = 0;
 
-	/* Fast path if it's obvious no merges could be done. */
-	if (lsm_tree->nchunks < lsm_tree->merge_min &&
-	    lsm_tree->merge_aggressiveness < WT_LSM_AGGRESSIVE_THRESHOLD)
-		return (WT_NOTFOUND);
+	part = &split->parts[partno];
+	next = partno + 1 < split->nparts ? part + 1 : NULL;
 
 	/*
-	 * Use the lsm_tree lock to read the chunks (so no switches occur), but
-	 * avoid holding it while the merge is in progress: that may take a
-	 * long time.
+	 * Size the Bloom filter for the key range's share of the records,
+	 * allowing for the ranges not being split evenly.
 	 */
-	WT_RET(__wt_lsm_tree_writelock(session, lsm_tree));
-	locked = 1;
-
-	WT_ERR(__lsm_merge_span(session,
-	    lsm_tree, id, &start_chunk, &end_chunk, &record_count));
-	nchunks = (end_chunk + 1) - start_chunk;
-
-	WT_ASSERT(session, nchunks > 0);
-	start_id = lsm_tree->chunk[start_chunk]->id;
+	record_count = split->record_count;
+	if (split->nparts > 1)
+		record_count = WT_MIN(
+		    record_count, 2 * record_count / split->nparts + 1);
 
-	/* Find the merge generation. */
-	for (generation = 0, i = 0; i < nchunks; i++)
-		generation = WT_MAX(generation,
-		    lsm_tree->chunk[start_chunk + i]->generation + 1);
+	WT_RET(__wt_calloc_one(session, &chunk));
+	chunk->id = WT_ATOMIC_ADD4(lsm_tree->last, 1);
+	chunk->generation = split->generation;
 
-	WT_ERR(__wt_lsm_tree_writeunlock(session, lsm_tree));
-	locked = 0;
-
-	/* Allocate an ID for the merge. */
-	dest_id = WT_ATOMIC_ADD4(lsm_tree->last, 1);
-
-	/*
-	 * We only want to do the chunk loop if we're running with verbose,
-	 * so we wrap these statements in the conditional.  Avoid the loop
-	 * in the normal path.
-	 */
-	if (WT_VERBOSE_ISSET(session, WT_VERB_LSM)) {
+	if (split->nparts > 1)
 		WT_ERR(__wt_verbose(session, WT_VERB_LSM,
-		    "Merging %s chunks %u-%u into %u (%" PRIu64 " records)"
-		    ", generation %" PRIu32,
-		    lsm_tree->name,
-		    start_chunk, end_chunk, dest_id, record_count, generation));
-		for (verb = start_chunk; verb <= end_chunk; verb++)
-			WT_ERR(__wt_verbose(session, WT_VERB_LSM,
-			    "%s: Chunk[%u] id %u",
-			    lsm_tree->name, verb, lsm_tree->chunk[verb]->id));
-	}
-
-	WT_ERR(__wt_calloc_one(session, &chunk));
-	created_chunk = 1;
-	chunk->id = dest_id;
-
-	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
-	    (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) ||
-	    start_chunk > 0) && record_count > 0)
-		create_bloom = 1;
+		    "Merging %s key range %u of %u into %u",
+		    lsm_tree->name, partno + 1, split->nparts, chunk->id));
 
 	/*
 	 * Special setup for the merge cursor:
@@ -320,18 +585,22 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	 */
 	WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
 	F_SET(src, WT_CURSTD_RAW);
-	WT_ERR(__wt_clsm_init_merge(src, start_chunk, start_id, nchunks));
+	WT_ERR(__wt_clsm_init_merge(
+	    src, split->chunks, split->nchunks, split->minor));
 
 	WT_WITH_SCHEMA_LOCK(session,
 	    ret = __wt_lsm_tree_setup_chunk(session, lsm_tree, chunk));
 	WT_ERR(ret);
-	if (create_bloom) {
+	if (split->create_bloom) {
 		WT_ERR(__wt_lsm_tree_setup_bloom(session, lsm_tree, chunk));
+		WT_ERR(__wt_scr_alloc(session, 0, &prefix));
 
 		WT_ERR(__wt_bloom_create(session, chunk->bloom_uri,
 		    lsm_tree->bloom_config,
 		    record_count, lsm_tree->bloom_bit_count,
-		    lsm_tree->bloom_hash_count, &bloom));
+		    lsm_tree->bloom_hash_count,
+		    FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_BLOCKED) ?
+		    WT_BLOOM_BLOCKED : 0, &bloom));
 	}
 
 	/* Discard pages we read as soon as we're done with them. */
@@ -342,8 +611,17 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	cfg[2] = NULL;
 	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
 
+	/* Position the merge cursor at the start of the key range. */
+	if (partno == 0)
+		ret = src->next(src);
+	else {
+		src->set_key(src, &part->start);
+		if ((ret = src->search_near(src, &exact)) == 0 && exact < 0)
+			ret = src->next(src);
+	}
+
 #define	LSM_MERGE_CHECK_INTERVAL	1000
-	for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
+	for (; ret == 0; insert_count++, ret = src->next(src)) {
 		if (insert_count % LSM_MERGE_CHECK_INTERVAL == 0) {
 			if (!F_ISSET(lsm_tree, WT_LSM_TREE_ACTIVE))
 				WT_ERR(EINTR);
@@ -354,12 +632,19 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 		}
 
 		WT_ERR(src->get_key(src, &key));
+		if (next != NULL) {
+			WT_ERR(__wt_compare(session,
+			    lsm_tree->collator, &key, &next->start, &cmp));
+			if (cmp >= 0)
+				break;
+		}
 		dest->set_key(dest, &key);
 		WT_ERR(src->get_value(src, &value));
 		dest->set_value(dest, &value);
 		WT_ERR(dest->insert(dest));
-		if (create_bloom)
-			WT_ERR(__wt_bloom_insert(bloom, &key));
+		if (split->create_bloom)
+			WT_ERR(__wt_lsm_tree_bloom_insert(
+			    session, lsm_tree, bloom, &key, prefix));
 	}
 	WT_ERR_NOTFOUND_OK(ret);
 
@@ -396,17 +681,25 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	 */
 	F_SET(session, WT_SESSION_NO_CACHE_CHECK);
 
-	if (create_bloom) {
+	/* Don't create chunks for empty key ranges, other than the first. */
+	if (ret == 0 && insert_count == 0 && partno != 0)
+		ret = WT_NOTFOUND;
+
+	if (split->create_bloom) {
 		if (ret == 0)
 			WT_TRET(__wt_bloom_finalize(bloom));
 
 		/*
 		 * Read in a key to make sure the Bloom filters btree handle is
-		 * open before it becomes visible to application threads.
-		 * Otherwise application threads will stall while it is opened
-		 * and internal pages are read into cache.
+		 * open before it becomes visible to application threads, or
+		 * load a blocked filter into memory.  Otherwise application
+		 * threads will stall while it is opened and internal pages are
+		 * read into cache.
 		 */
-		if (ret == 0) {
+		if (ret == 0 &&
+		    FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_BLOCKED))
+			WT_TRET(__wt_lsm_tree_bloom_load(session, chunk));
+		else if (ret == 0) {
 			WT_CLEAR(key);
 			WT_TRET_NOTFOUND_OK(__wt_bloom_get(bloom, &key));
 		}
@@ -431,33 +724,601 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	WT_ERR_NOTFOUND_OK(ret);
 
 	WT_ERR(__wt_lsm_tree_set_chunk_size(session, chunk));
+	WT_STAT_FAST_INCRV(session,
+	    &lsm_tree->stats, lsm_bytes_merged, chunk->size);
+	if ((ret = __wt_lsm_tree_set_chunk_keys(session, chunk)) == 0)
+		F_SET(chunk, WT_LSM_CHUNK_KEYS);
+	WT_ERR_NOTFOUND_OK(ret);
+
+	/* The chunk isn't visible until the merge installs it. */
+	if (split->create_bloom) {
+		F_SET(chunk, WT_LSM_CHUNK_BLOOM);
+		if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_BLOCKED))
+			F_SET(chunk, WT_LSM_CHUNK_BLOOM_BLOCKED);
+	}
+	chunk->count = insert_count;
+	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+	part->chunk = chunk;
+
+err:	if (in_sync)
+		(void)WT_ATOMIC_SUB4(lsm_tree->merge_syncing, 1);
+	if (src != NULL)
+		WT_TRET(src->close(src));
+	if (dest != NULL)
+		WT_TRET(dest->close(dest));
+	if (bloom != NULL)
+		WT_TRET(__wt_bloom_close(bloom));
+	__wt_scr_free(session, &prefix);
+	if (ret != 0) {
+		WT_TRET(__lsm_merge_discard(session, chunk));
+
+		if (ret == EINTR)
+			WT_TRET(__wt_verbose(session, WT_VERB_LSM,
+			    "Merge aborted due to close"));
+		else if (ret != WT_NOTFOUND)
+			WT_TRET(__wt_verbose(session, WT_VERB_LSM,
+			    "Merge failed with %s",
+			   __wt_strerror(session, ret, NULL, 0)));
+	}
+	F_CLR(session, WT_SESSION_NO_CACHE | WT_SESSION_NO_CACHE_CHECK);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_range --
+ *	Merge a key range claimed by this thread, then flag the range done.
+ *	Once it has been flagged done, the split merge may be freed.
+ */
+static void
+__lsm_merge_range(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_MERGE_SPLIT *split, u_int partno)
+{
+	WT_DECL_RET;
+
+	/* Empty key ranges don't create a chunk, they aren't an error. */
+	if (split->error == 0 && (ret = __lsm_merge_part(
+	    session, lsm_tree, split, partno)) != 0 && ret != WT_NOTFOUND)
+		split->error = ret;
+	(void)WT_ATOMIC_ADD4(split->done, 1);
+	(void)__wt_cond_signal(session, lsm_tree->merge_cond);
+}
+
+/*
+ * __lsm_merge_help --
+ *	Help with a merge split into key ranges by another thread, if there is
+ *	one.  Returns WT_NOTFOUND if there is no key range left to merge.
+ */
+static int
+__lsm_merge_help(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	WT_LSM_MERGE_SPLIT *split;
+	u_int partno;
+	int claimed, helped;
+
+	for (helped = 0;; helped = 1) {
+		/*
+		 * The merge can't finish until ranges that have been claimed
+		 * are done, the lock stops it finishing while we claim one.
+		 */
+		claimed = 0;
+		partno = 0;
+		WT_RET(__wt_lsm_tree_readlock(session, lsm_tree));
+		if ((split = lsm_tree->merge_split) != NULL) {
+			partno = WT_ATOMIC_ADD4(split->next, 1) - 1;
+			claimed = partno < split->nparts;
+		}
+		WT_RET(__wt_lsm_tree_readunlock(session, lsm_tree));
+		if (!claimed)
+			break;
+
+		__lsm_merge_range(session, lsm_tree, split, partno);
+		WT_STAT_FAST_CONN_INCR(session, lsm_merge_ranges_helped);
+	}
+	return (helped ? 0 : WT_NOTFOUND);
+}
+
+/*
+ * __lsm_merge_tier --
+ *	Choose the chunks for a tiered merge: a span of chunks of similar
+ *	sizes.  Called with the LSM tree locked.
+ */
+static int
+__lsm_merge_tier(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, u_int id, WT_LSM_MERGE_SPLIT *split, u_int *npartsp)
+{
+	uint64_t nparts;
+	u_int end_chunk, i, nchunks, start_chunk;
+	int resplit;
+
+	WT_RET(__lsm_merge_span(session,
+	    lsm_tree, id, &start_chunk, &end_chunk, &split->record_count));
+	nchunks = (end_chunk + 1) - start_chunk;
+
+	WT_ASSERT(session, nchunks > 0);
+
+	/* Don't merge the chunks an earlier merge split its output into. */
+	WT_RET(__lsm_merge_resplit(
+	    session, lsm_tree, start_chunk, nchunks, &resplit));
+	if (resplit) {
+		for (i = 0; i < nchunks; i++)
+			F_CLR(lsm_tree->chunk[start_chunk + i],
+			    WT_LSM_CHUNK_MERGING);
+		return (WT_NOTFOUND);
+	}
+
+	/*
+	 * Remember the chunks being merged, they can't go away while they are
+	 * flagged as merging.  Find the merge generation and size.
+	 */
+	WT_RET(__wt_calloc_def(session, nchunks, &split->chunks));
+	split->nchunks = nchunks;
+	for (i = 0; i < nchunks; i++) {
+		split->chunks[i] = lsm_tree->chunk[start_chunk + i];
+		split->generation =
+		    WT_MAX(split->generation, split->chunks[i]->generation + 1);
+		split->size += split->chunks[i]->size;
+	}
+
+	/* Check whether the merge must keep tombstones. */
+	WT_RET(__lsm_merge_minor(
+	    session, lsm_tree, start_chunk, nchunks, &split->minor));
+
+	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
+	    (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) ||
+	    start_chunk > 0) && split->record_count > 0)
+		split->create_bloom = 1;
+
+	/*
+	 * Split merges into key ranges, up to the configured maximum.  Small
+	 * merges are quick and splitting them only creates more chunks to be
+	 * merged again: don't create chunks smaller than a minimum merge of
+	 * in-memory chunks.
+	 */
+	nparts = WT_MIN(lsm_tree->merge_partitions, split->size /
+	    WT_MAX(lsm_tree->chunk_size * lsm_tree->merge_min, 1));
+	*npartsp = (u_int)WT_MAX(nparts, 1);
+	return (0);
+}
+
+/*
+ * __lsm_merge_level_insert --
+ *	Insert chunks of a level into a leveled tree, after the chunks in the
+ *	same and deeper levels.  The chunk array must have room for them.
+ *	Called with the LSM tree locked.
+ */
+static void
+__lsm_merge_level_insert(
+    WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK **chunks, u_int nchunks)
+{
+	u_int i;
+
+	for (i = 0; i < lsm_tree->nchunks; i++)
+		if (lsm_tree->chunk[i]->generation < chunks[0]->generation)
+			break;
+	memmove(lsm_tree->chunk + i + nchunks, lsm_tree->chunk + i,
+	    (lsm_tree->nchunks - i) * sizeof(*lsm_tree->chunk));
+	memcpy(lsm_tree->chunk + i, chunks, nchunks * sizeof(*chunks));
+	lsm_tree->nchunks += nchunks;
+}
+
+/*
+ * __lsm_merge_level_chunks --
+ *	Set up a leveled merge of a run of chunks from one level into the next
+ *	level, along with the chunks in the next level with overlapping keys.
+ *	Returns WT_NOTFOUND if a chunk that must be merged is busy.  If there
+ *	are no chunks to merge with a single chunk, it is moved into the next
+ *	level instead, without rewriting it.  Called with the LSM tree locked.
+ */
+static int
+__lsm_merge_level_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    u_int start_chunk, u_int end_chunk, WT_LSM_MERGE_SPLIT *split,
+    int *movedp)
+{
+	WT_ITEM *max_key, *min_key;
+	WT_LSM_CHUNK *chunk;
+	uint32_t generation;
+	u_int i, noverlap, ninputs;
+	int overlap;
+
+	*movedp = 0;
+	ninputs = (end_chunk + 1) - start_chunk;
+	generation = lsm_tree->chunk[start_chunk]->generation + 1;
+
+	/*
+	 * Count the chunks in the next level with keys in the range being
+	 * merged.
+	 */
+	WT_RET(__lsm_merge_key_range(session, lsm_tree,
+	    lsm_tree->chunk + start_chunk, ninputs, &min_key, &max_key));
+	for (noverlap = 0, i = 0; i < start_chunk; i++) {
+		chunk = lsm_tree->chunk[i];
+		if (chunk->generation != generation)
+			continue;
+		WT_RET(__lsm_merge_overlaps(
+		    session, lsm_tree, chunk, min_key, max_key, &overlap));
+		if (!overlap)
+			continue;
+		if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING))
+			return (WT_NOTFOUND);
+		++noverlap;
+	}
+
+	/* Move a single chunk that doesn't overlap the next level. */
+	if (noverlap == 0 && ninputs == 1) {
+		chunk = lsm_tree->chunk[start_chunk];
+		memmove(lsm_tree->chunk + start_chunk,
+		    lsm_tree->chunk + start_chunk + 1,
+		    (lsm_tree->nchunks - (start_chunk + 1)) *
+		    sizeof(*lsm_tree->chunk));
+		--lsm_tree->nchunks;
+		chunk->generation = generation;
+		__lsm_merge_level_insert(lsm_tree, &chunk, 1);
+		*movedp = 1;
+		return (0);
+	}
+
+	/*
+	 * Remember the chunks being merged in the order they appear in the
+	 * tree: the chunks in the next level are older, they come first.
+	 */
+	WT_RET(__wt_calloc_def(session, noverlap + ninputs, &split->chunks));
+	for (i = 0; i < start_chunk; i++) {
+		chunk = lsm_tree->chunk[i];
+		if (chunk->generation != generation)
+			continue;
+		WT_RET(__lsm_merge_overlaps(
+		    session, lsm_tree, chunk, min_key, max_key, &overlap));
+		if (overlap)
+			split->chunks[split->nchunks++] = chunk;
+	}
+	for (i = start_chunk; i <= end_chunk; i++)
+		split->chunks[split->nchunks++] = lsm_tree->chunk[i];
+
+	for (i = 0; i < split->nchunks; i++) {
+		chunk = split->chunks[i];
+		F_SET(chunk, WT_LSM_CHUNK_MERGING);
+		split->record_count += chunk->count;
+		split->size += chunk->size;
+	}
+	split->generation = generation;
+
+	/*
+	 * The merge must keep tombstones if deeper levels could contain keys
+	 * in the range being merged.
+	 */
+	WT_RET(__lsm_merge_key_range(session, lsm_tree,
+	    split->chunks, split->nchunks, &min_key, &max_key));
+	for (i = 0; i < lsm_tree->nchunks; i++) {
+		chunk = lsm_tree->chunk[i];
+		if (chunk->generation <= generation)
+			break;
+		WT_RET(__lsm_merge_overlaps(
+		    session, lsm_tree, chunk, min_key, max_key, &overlap));
+		if (overlap) {
+			split->minor = 1;
+			break;
+		}
+	}
+
+	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
+	    (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) ||
+	    lsm_tree->chunk[0]->generation > generation) &&
+	    split->record_count > 0)
+		split->create_bloom = 1;
+	return (0);
+}
+
+/*
+ * __lsm_merge_level --
+ *	Choose the chunks for a leveled merge.  Chunks are kept in levels (the
+ *	level is the chunk's generation), deepest first, with flushed chunks
+ *	in level 0.  The chunks in each deeper level have no overlapping keys,
+ *	and each level can hold level_multiplier times the data of the level
+ *	above it.  Merge the level that is fullest relative to its size into
+ *	the next level.  Called with the LSM tree locked.
+ */
+static int
+__lsm_merge_level(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_MERGE_SPLIT *split, u_int *npartsp,
+    int *movedp)
+{
+	WT_DECL_RET;
+	WT_LSM_CHUNK *chunk;
+	uint64_t multiplier, nparts, *scores, target;
+	uint32_t best, deepest, level;
+	u_int end_chunk, i, nready, start_chunk;
+	int aggressive;
+
+	*movedp = 0;
+	scores = NULL;
+
+	/*
+	 * If the tree is open read-only or we are compacting, be very
+	 * aggressive, as for tiered merges.
+	 */
+	if (!lsm_tree->modified ||
+	    F_ISSET(lsm_tree, WT_LSM_TREE_COMPACTING))
+		lsm_tree->merge_aggressiveness = 10;
+	aggressive =
+	    lsm_tree->merge_aggressiveness > WT_LSM_AGGRESSIVE_THRESHOLD;
+
+	if (lsm_tree->nchunks == 0)
+		return (WT_NOTFOUND);
+	deepest = lsm_tree->chunk[0]->generation;
+	WT_RET(__wt_calloc_def(session, deepest + 1, &scores));
+
+	/*
+	 * Level 0 can be merged once enough of the oldest flushed chunks have
+	 * Bloom filters (or are on disk, if there are no Bloom filters).
+	 */
+	for (start_chunk = 0; start_chunk < lsm_tree->nchunks; start_chunk++)
+		if (lsm_tree->chunk[start_chunk]->generation == 0)
+			break;
+	for (end_chunk = start_chunk; end_chunk < lsm_tree->nchunks;
+	    end_chunk++) {
+		chunk = lsm_tree->chunk[end_chunk];
+		if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING) || chunk->bloom_busy ||
+		    !F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
+			break;
+		if (!F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) && chunk->count != 0 &&
+		    !FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF))
+			break;
+	}
+	nready = end_chunk - start_chunk;
+	scores[0] = (uint64_t)nready * 100 / lsm_tree->merge_min;
+	if (aggressive && nready > 0)
+		scores[0] = WT_MAX(scores[0], 100);
+
+	/*
+	 * Deeper levels are merged once they grow larger than their target
+	 * size.  When compacting, push everything into the deepest level.
+	 */
+	for (i = 0; i < start_chunk; i++)
+		scores[lsm_tree->chunk[i]->generation] +=
+		    lsm_tree->chunk[i]->size;
+	target = lsm_tree->chunk_size * lsm_tree->merge_max;
+	multiplier = lsm_tree->level_multiplier;
+	for (level = 1; level <= deepest; level++) {
+		if (level > 1)
+			target = target > UINT64_MAX / multiplier ?
+			    UINT64_MAX : target * multiplier;
+		if (scores[level] == 0)
+			continue;
+		scores[level] /= WT_MAX(target / 100, 1);
+		if (F_ISSET(lsm_tree, WT_LSM_TREE_COMPACTING) &&
+		    level < deepest)
+			scores[level] = WT_MAX(scores[level], 100);
+	}
+
+	/*
+	 * Try the levels in order of their scores, and the chunks in a level
+	 * in the order they were added to it, until a merge can be set up.
+	 */
+	for (ret = WT_NOTFOUND; ret == WT_NOTFOUND;) {
+		for (best = 0, level = 1; level <= deepest; level++)
+			if (scores[level] > scores[best])
+				best = level;
+		if (scores[best] < 100)
+			break;
+		scores[best] = 0;
+
+		if (best == 0) {
+			ret = __lsm_merge_level_chunks(session, lsm_tree,
+			    start_chunk, end_chunk - 1, split, movedp);
+			continue;
+		}
+		for (i = 0; i < start_chunk && ret == WT_NOTFOUND; i++) {
+			chunk = lsm_tree->chunk[i];
+			if (chunk->generation != best ||
+			    F_ISSET(chunk, WT_LSM_CHUNK_MERGING))
+				continue;
+			ret = __lsm_merge_level_chunks(
+			    session, lsm_tree, i, i, split, movedp);
+		}
+	}
+	WT_ERR(ret);
+
+	/*
+	 * Split the merge into chunks the size of a minimum merge of
+	 * in-memory chunks, so deeper levels are made up of chunks that can
+	 * be merged into the next level a few at a time.
+	 */
+#define	WT_LSM_LEVEL_PARTS_MAX	64
+	nparts = split->size /
+	    WT_MAX(lsm_tree->chunk_size * lsm_tree->merge_min, 1);
+	*npartsp = (u_int)WT_MAX(WT_MIN(nparts, WT_LSM_LEVEL_PARTS_MAX), 1);
+
+err:	__wt_free(session, scores);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_update_level --
+ *	Replace the chunks a leveled merge used with the chunks it created.
+ *	Must be called with the LSM lock held.
+ */
+static int
+__lsm_merge_update_level(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_MERGE_SPLIT *split, WT_LSM_CHUNK **chunks, u_int nnew)
+{
+	u_int i, j, k, nchunks;
+
+	/* Allocate space up front: the update can't fail part way through. */
+	WT_RET(__wt_realloc_def(session, &lsm_tree->chunk_alloc,
+	    lsm_tree->nchunks + nnew, &lsm_tree->chunk));
+	WT_RET(__wt_realloc_def(session, &lsm_tree->old_alloc,
+	    lsm_tree->nold_chunks + split->nchunks, &lsm_tree->old_chunks));
+
+	/* The chunks being merged needn't be adjacent in a leveled tree. */
+	nchunks = lsm_tree->nchunks;
+	for (i = j = 0; i < nchunks; i++) {
+		for (k = 0; k < split->nchunks; k++)
+			if (lsm_tree->chunk[i] == split->chunks[k])
+				break;
+		if (k < split->nchunks)
+			WT_RET(__wt_lsm_tree_retire_chunks(
+			    session, lsm_tree, i, 1));
+		else
+			lsm_tree->chunk[j++] = lsm_tree->chunk[i];
+	}
+	lsm_tree->nchunks = j;
+	__lsm_merge_level_insert(lsm_tree, chunks, nnew);
+	if (lsm_tree->nchunks < nchunks)
+		memset(lsm_tree->chunk + lsm_tree->nchunks, 0,
+		    (nchunks - lsm_tree->nchunks) * sizeof(*lsm_tree->chunk));
+	return (0);
+}
+
+/*
+ * __wt_lsm_merge --
+ *	Merge a set of chunks of an LSM tree.
+ */
+int
+__wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
+{
+	WT_DECL_RET;
+	WT_LSM_CHUNK **new_chunks;
+	WT_LSM_MERGE_SPLIT *split;
+	u_int i, nnew, nparts, partno, start_chunk, verb;
+	int installed, locked, moved, published, tret;
+
+	new_chunks = NULL;
+	split = NULL;
+	installed = locked = moved = published = 0;
+	nparts = 1;
+	tret = 0;
+
+	/* Help with a merge split into key ranges, if there is one. */
+	if (lsm_tree->merge_split != NULL &&
+	    (ret = __lsm_merge_help(session, lsm_tree)) != WT_NOTFOUND)
+		return (ret);
+
+	/* Fast path if it's obvious no merges could be done. */
+	if (!F_ISSET(lsm_tree, WT_LSM_TREE_LEVELED) &&
+	    lsm_tree->nchunks < lsm_tree->merge_min &&
+	    lsm_tree->merge_aggressiveness < WT_LSM_AGGRESSIVE_THRESHOLD)
+		return (WT_NOTFOUND);
+
+	WT_RET(__wt_calloc_one(session, &split));
+
+	/*
+	 * Use the lsm_tree lock to read the chunks (so no switches occur), but
+	 * avoid holding it while the merge is in progress: that may take a
+	 * long time.
+	 */
 	WT_ERR(__wt_lsm_tree_writelock(session, lsm_tree));
 	locked = 1;
 
+	if (F_ISSET(lsm_tree, WT_LSM_TREE_LEVELED))
+		WT_ERR(__lsm_merge_level(
+		    session, lsm_tree, split, &nparts, &moved));
+	else
+		WT_ERR(__lsm_merge_tier(session, lsm_tree, id, split, &nparts));
+
+	/* A chunk moved into the next level only needs the metadata updated. */
+	if (moved) {
+		if ((ret = __wt_lsm_meta_write(session, lsm_tree)) != 0)
+			WT_PANIC_ERR(
+			    session, ret, "Failed finalizing LSM merge");
+		lsm_tree->dsk_gen++;
+		WT_STAT_FAST_INCR(session, &lsm_tree->stats, lsm_merge_moved);
+		goto err;
+	}
+
+	WT_ERR(__wt_lsm_tree_writeunlock(session, lsm_tree));
+	locked = 0;
+
+	WT_ERR(__lsm_merge_split(session, lsm_tree, split, nparts));
+
 	/*
-	 * Check whether we raced with another merge, and adjust the chunk
-	 * array offset as necessary.
+	 * We only want to do the chunk loop if we're running with verbose,
+	 * so we wrap these statements in the conditional.  Avoid the loop
+	 * in the normal path.
 	 */
-	if (start_chunk >= lsm_tree->nchunks ||
-	    lsm_tree->chunk[start_chunk]->id != start_id)
-		for (start_chunk = 0;
-		    start_chunk < lsm_tree->nchunks;
-		    start_chunk++)
-			if (lsm_tree->chunk[start_chunk]->id == start_id)
-				break;
+	if (WT_VERBOSE_ISSET(session, WT_VERB_LSM)) {
+		WT_ERR(__wt_verbose(session, WT_VERB_LSM,
+		    "Merging %s %u chunks in %u key ranges"
+		    " (%" PRIu64 " records), generation %" PRIu32,
+		    lsm_tree->name, split->nchunks, split->nparts,
+		    split->record_count, split->generation));
+		for (verb = 0; verb < split->nchunks; verb++)
+			WT_ERR(__wt_verbose(session, WT_VERB_LSM,
+			    "%s: Chunk id %u generation %" PRIu32,
+			    lsm_tree->name, split->chunks[verb]->id,
+			    split->chunks[verb]->generation));
+	}
+
+	/*
+	 * Let other worker threads help with the key ranges, unless another
+	 * merge is already being helped.  If we can't schedule the help, merge
+	 * the ranges ourselves.
+	 */
+	if (split->nparts > 1) {
+		WT_ERR(__wt_lsm_tree_writelock(session, lsm_tree));
+		if (lsm_tree->merge_split == NULL) {
+			lsm_tree->merge_split = split;
+			published = 1;
+		}
+		WT_TRET(__wt_lsm_tree_writeunlock(session, lsm_tree));
+	}
+	for (i = 1; ret == 0 && published && i < split->nparts; i++)
+		if (__wt_lsm_manager_push_entry(
+		    session, WT_LSM_WORK_MERGE, 0, lsm_tree) != 0)
+			break;
+
+	/*
+	 * Once the split is published, don't give up on it until every key
+	 * range is done: other threads may be merging them.  Merge key ranges
+	 * until they have all been claimed, then wait for the ranges other
+	 * threads claimed.
+	 */
+	while ((partno = WT_ATOMIC_ADD4(split->next, 1) - 1) < split->nparts)
+		__lsm_merge_range(session, lsm_tree, split, partno);
+	while (split->done < split->nparts)
+		WT_TRET(__wt_cond_wait(session, lsm_tree->merge_cond, 10000));
+
+	/*
+	 * Stop other threads finding the split before it is freed, even if
+	 * the tree can't be locked: every key range has been claimed.
+	 */
+	if ((tret = __wt_lsm_tree_writelock(session, lsm_tree)) == 0)
+		locked = 1;
+	if (published) {
+		lsm_tree->merge_split = NULL;
+		published = 0;
+	}
+	WT_TRET(tret);
+	WT_ERR(ret);
+	WT_ERR(split->error);
+
+	/* Empty key ranges other than the first don't create a chunk. */
+	WT_ERR(__wt_calloc_def(session, split->nparts, &new_chunks));
+	for (nnew = 0, i = 0; i < split->nparts; i++)
+		if (split->parts[i].chunk != NULL)
+			new_chunks[nnew++] = split->parts[i].chunk;
+	WT_ASSERT(session, nnew > 0);
 
 	/*
 	 * It is safe to error out here - since the update can only fail
 	 * prior to making updates to the tree.
 	 */
-	WT_ERR(__wt_lsm_merge_update_tree(
-	    session, lsm_tree, start_chunk, nchunks, chunk));
-
-	if (create_bloom)
-		F_SET(chunk, WT_LSM_CHUNK_BLOOM);
-	chunk->count = insert_count;
-	chunk->generation = generation;
-	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+	if (F_ISSET(lsm_tree, WT_LSM_TREE_LEVELED))
+		WT_ERR(__lsm_merge_update_level(
+		    session, lsm_tree, split, new_chunks, nnew));
+	else {
+		/*
+		 * Other merges may have changed the tree, find where the
+		 * chunks being merged start.
+		 */
+		for (start_chunk = 0;
+		    start_chunk < lsm_tree->nchunks; start_chunk++)
+			if (lsm_tree->chunk[start_chunk]->id ==
+			    split->chunks[0]->id)
+				break;
+		WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree,
+		    start_chunk, split->nchunks, new_chunks, nnew));
+	}
+	installed = 1;
 
 	/*
 	 * We have no current way of continuing if the metadata update fails,
@@ -479,41 +1340,28 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 	WT_ERR(__wt_lsm_manager_push_entry(
 	    session, WT_LSM_WORK_DROP, 0, lsm_tree));
 
-err:	if (locked)
+err:	/*
+	 * If the merge wasn't installed, the chunks it was merging can be
+	 * merged again (or dropped).
+	 */
+	if (split != NULL && !installed && split->nchunks > 0) {
+		if (!locked &&
+		    (tret = __wt_lsm_tree_writelock(session, lsm_tree)) == 0)
+			locked = 1;
+		WT_TRET(tret);
+		for (i = 0; i < split->nchunks; i++)
+			F_CLR(split->chunks[i], WT_LSM_CHUNK_MERGING);
+	}
+	if (locked)
 		WT_TRET(__wt_lsm_tree_writeunlock(session, lsm_tree));
-	if (in_sync)
-		(void)WT_ATOMIC_SUB4(lsm_tree->merge_syncing, 1);
-	if (src != NULL)
-		WT_TRET(src->close(src));
-	if (dest != NULL)
-		WT_TRET(dest->close(dest));
-	if (bloom != NULL)
-		WT_TRET(__wt_bloom_close(bloom));
-	if (ret != 0 && created_chunk) {
-		/* Drop the newly-created files on error. */
-		if (chunk->uri != NULL) {
-			WT_WITH_SCHEMA_LOCK(session, tret =
-			    __wt_schema_drop(session, chunk->uri, drop_cfg));
-			WT_TRET(tret);
-		}
-		if (create_bloom && chunk->bloom_uri != NULL) {
-			WT_WITH_SCHEMA_LOCK(session,
-			    tret = __wt_schema_drop(
-			    session, chunk->bloom_uri, drop_cfg));
-			WT_TRET(tret);
-		}
-		__wt_free(session, chunk->bloom_uri);
-		__wt_free(session, chunk->uri);
-		__wt_free(session, chunk);
-
-		if (ret == EINTR)
-			WT_TRET(__wt_verbose(session, WT_VERB_LSM,
-			    "Merge aborted due to close"));
-		else
-			WT_TRET(__wt_verbose(session, WT_VERB_LSM,
-			    "Merge failed with %s",
-			   __wt_strerror(session, ret, NULL, 0)));
+	if (split != NULL) {
+		if (ret != 0 && !installed)
+			for (i = 0; i < split->nparts; i++)
+				if (split->parts[i].chunk != NULL)
+					WT_TRET(__lsm_merge_discard(
+					    session, split->parts[i].chunk));
+		__lsm_merge_split_free(session, split);
 	}
-	F_CLR(session, WT_SESSION_NO_CACHE | WT_SESSION_NO_CACHE_CHECK);
+	__wt_free(session, new_chunks);
 	return (ret);
 }
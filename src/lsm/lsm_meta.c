@@ -78,11 +78,15 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			lsm_tree->bloom_bit_count = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("bloom_hash_count", ck.str, ck.len))
 			lsm_tree->bloom_hash_count = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH("bloom_prefix", ck.str, ck.len))
+			lsm_tree->bloom_prefix = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("chunk_count_limit", ck.str, ck.len)) {
 			lsm_tree->chunk_count_limit = (uint32_t)cv.val;
 			if (cv.val != 0)
 				F_CLR(lsm_tree, WT_LSM_TREE_MERGES);
-		} else if (WT_STRING_MATCH("chunk_max", ck.str, ck.len))
+		} else if (WT_STRING_MATCH("throttle_backlog", ck.str, ck.len))
+			lsm_tree->throttle_backlog = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH("chunk_max", ck.str, ck.len))
 			lsm_tree->chunk_max = (uint64_t)cv.val;
 		else if (WT_STRING_MATCH("chunk_size", ck.str, ck.len))
 			lsm_tree->chunk_size = (uint64_t)cv.val;
@@ -90,6 +94,15 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			lsm_tree->merge_max = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("merge_min", ck.str, ck.len))
 			lsm_tree->merge_min = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH("merge_partitions", ck.str, ck.len))
+			lsm_tree->merge_partitions = (u_int)cv.val;
+		else if (WT_STRING_MATCH("leveled", ck.str, ck.len)) {
+			if (cv.val)
+				F_SET(lsm_tree, WT_LSM_TREE_LEVELED);
+			else
+				F_CLR(lsm_tree, WT_LSM_TREE_LEVELED);
+		} else if (WT_STRING_MATCH("level_multiplier", ck.str, ck.len))
+			lsm_tree->level_multiplier = (u_int)cv.val;
 		else if (WT_STRING_MATCH("last", ck.str, ck.len))
 			lsm_tree->last = (u_int)cv.val;
 		else if (WT_STRING_MATCH("chunks", ck.str, ck.len)) {
@@ -116,6 +129,11 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 					    chunk->id, &chunk->bloom_uri));
 					F_SET(chunk, WT_LSM_CHUNK_BLOOM);
 					continue;
+				} else if (WT_STRING_MATCH(
+				    "bloom_blocked", lk.str, lk.len)) {
+					F_SET(chunk,
+					    WT_LSM_CHUNK_BLOOM_BLOCKED);
+					continue;
 				} else if (WT_STRING_MATCH(
 				    "chunk_size", lk.str, lk.len)) {
 					chunk->size = (uint64_t)lv.val;
@@ -128,6 +146,17 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 				    "generation", lk.str, lk.len)) {
 					chunk->generation = (uint32_t)lv.val;
 					continue;
+				} else if (WT_STRING_MATCH(
+				    "min_key", lk.str, lk.len)) {
+					WT_ERR(__wt_nhex_to_raw(session,
+					    lv.str, lv.len, &chunk->min_key));
+					continue;
+				} else if (WT_STRING_MATCH(
+				    "max_key", lk.str, lk.len)) {
+					WT_ERR(__wt_nhex_to_raw(session,
+					    lv.str, lv.len, &chunk->max_key));
+					F_SET(chunk, WT_LSM_CHUNK_KEYS);
+					continue;
 				}
 			}
 			WT_ERR_NOTFOUND_OK(ret);
@@ -169,6 +198,12 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	if (lsm_tree->merge_min < 2)
 		lsm_tree->merge_min = WT_MAX(2, lsm_tree->merge_max / 2);
 
+	/* Trees created before merges were split merge a single key range. */
+	if (lsm_tree->merge_partitions == 0)
+		lsm_tree->merge_partitions = 1;
+	if (lsm_tree->level_multiplier == 0)
+		lsm_tree->level_multiplier = 10;
+
 err:	__wt_free(session, lsmconfig);
 	return (ret);
 }
@@ -181,12 +216,14 @@ int
 __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 {
 	WT_DECL_ITEM(buf);
+	WT_DECL_ITEM(hex);
 	WT_DECL_RET;
 	WT_LSM_CHUNK *chunk;
 	u_int i;
 	int first;
 
 	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_scr_alloc(session, 0, &hex));
 	WT_ERR(__wt_buf_fmt(session, buf,
 	    "key_format=%s,value_format=%s,bloom_config=(%s),file_config=(%s)",
 	    lsm_tree->key_format, lsm_tree->value_format,
@@ -200,16 +237,26 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	    ",chunk_max=%" PRIu64
 	    ",chunk_size=%" PRIu64
 	    ",auto_throttle=%" PRIu32
+	    ",throttle_backlog=%" PRIu32
 	    ",merge_max=%" PRIu32
 	    ",merge_min=%" PRIu32
+	    ",merge_partitions=%u"
+	    ",leveled=%d"
+	    ",level_multiplier=%u"
 	    ",bloom=%" PRIu32
 	    ",bloom_bit_count=%" PRIu32
-	    ",bloom_hash_count=%" PRIu32,
+	    ",bloom_hash_count=%" PRIu32
+	    ",bloom_prefix=%" PRIu32,
 	    lsm_tree->last, lsm_tree->chunk_count_limit,
 	    lsm_tree->chunk_max, lsm_tree->chunk_size,
 	    F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) ? 1 : 0,
-	    lsm_tree->merge_max, lsm_tree->merge_min, lsm_tree->bloom,
-	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count));
+	    lsm_tree->throttle_backlog,
+	    lsm_tree->merge_max, lsm_tree->merge_min,
+	    lsm_tree->merge_partitions,
+	    F_ISSET(lsm_tree, WT_LSM_TREE_LEVELED) ? 1 : 0,
+	    lsm_tree->level_multiplier, lsm_tree->bloom,
+	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count,
+	    lsm_tree->bloom_prefix));
 	WT_ERR(__wt_buf_catfmt(session, buf, ",chunks=["));
 	for (i = 0; i < lsm_tree->nchunks; i++) {
 		chunk = lsm_tree->chunk[i];
@@ -218,6 +265,9 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		WT_ERR(__wt_buf_catfmt(session, buf, "id=%" PRIu32, chunk->id));
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_buf_catfmt(session, buf, ",bloom"));
+		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM_BLOCKED))
+			WT_ERR(__wt_buf_catfmt(
+			    session, buf, ",bloom_blocked"));
 		if (chunk->size != 0)
 			WT_ERR(__wt_buf_catfmt(session, buf,
 			    ",chunk_size=%" PRIu64, chunk->size));
@@ -226,6 +276,16 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			    session, buf, ",count=%" PRIu64, chunk->count));
 		WT_ERR(__wt_buf_catfmt(
 		    session, buf, ",generation=%" PRIu32, chunk->generation));
+		if (F_ISSET(chunk, WT_LSM_CHUNK_KEYS)) {
+			WT_ERR(__wt_raw_to_hex(session,
+			    chunk->min_key.data, chunk->min_key.size, hex));
+			WT_ERR(__wt_buf_catfmt(session,
+			    buf, ",min_key=\"%s\"", (const char *)hex->data));
+			WT_ERR(__wt_raw_to_hex(session,
+			    chunk->max_key.data, chunk->max_key.size, hex));
+			WT_ERR(__wt_buf_catfmt(session,
+			    buf, ",max_key=\"%s\"", (const char *)hex->data));
+		}
 	}
 	WT_ERR(__wt_buf_catfmt(session, buf, "]"));
 	WT_ERR(__wt_buf_catfmt(session, buf, ",old_chunks=["));
@@ -247,5 +307,6 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	WT_ERR(ret);
 
 err:	__wt_scr_free(session, &buf);
+	__wt_scr_free(session, &hex);
 	return (ret);
 }
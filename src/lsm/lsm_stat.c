@@ -22,7 +22,9 @@ __curstat_lsm_init(
 	WT_DSRC_STATS *new, *stats;
 	WT_LSM_CHUNK *chunk;
 	WT_LSM_TREE *lsm_tree;
-	u_int i;
+	uint64_t deepest_size, flushed, merged, size;
+	uint32_t deepest;
+	u_int blooms, i, searched;
 	int locked;
 	char config[64];
 	const char *cfg[] = {
@@ -31,6 +33,9 @@ __curstat_lsm_init(
 	   WT_CONFIG_BASE(session, session_open_cursor),
 	   "checkpoint=" WT_CHECKPOINT, NULL, NULL };
 
+	deepest = 0;
+	deepest_size = size = 0;
+	blooms = searched = 0;
 	locked = 0;
 	WT_WITH_DHANDLE_LOCK(session,
 	    ret = __wt_lsm_tree_get(session, uri, 0, &lsm_tree));
@@ -69,6 +74,23 @@ __curstat_lsm_init(
 	for (i = 0; i < lsm_tree->nchunks; i++) {
 		chunk = lsm_tree->chunk[i];
 
+		/*
+		 * Queries search every chunk of a tiered tree, but only one
+		 * chunk in each level of a leveled tree, where the chunks in
+		 * a level have no overlapping keys.
+		 */
+		if (!F_ISSET(lsm_tree, WT_LSM_TREE_LEVELED) ||
+		    chunk->generation == 0 || i == 0 ||
+		    chunk->generation != lsm_tree->chunk[i - 1]->generation)
+			++searched;
+		if (chunk->generation > deepest || i == 0) {
+			deepest = chunk->generation;
+			deepest_size = 0;
+		}
+		if (chunk->generation == deepest)
+			deepest_size += chunk->size;
+		size += chunk->size;
+
 		/*
 		 * Get the statistics for the chunk's underlying object.
 		 *
@@ -102,7 +124,7 @@ __curstat_lsm_init(
 			continue;
 
 		/* Maintain a count of bloom filters. */
-		WT_STAT_INCR(&lsm_tree->stats, bloom_count);
+		++blooms;
 
 		/* Get the bloom filter's underlying object. */
 		WT_ERR(__wt_buf_fmt(
@@ -128,7 +150,17 @@ __curstat_lsm_init(
 	}
 
 	/* Set statistics that aren't aggregated directly into the cursor */
+	WT_STAT_SET(stats, bloom_count, blooms);
 	WT_STAT_SET(stats, lsm_chunk_count, lsm_tree->nchunks);
+	WT_STAT_SET(stats, lsm_amplification_read, searched);
+	WT_STAT_SET(stats, lsm_amplification_space,
+	    deepest_size == 0 ? 0 : size * 100 / deepest_size);
+	flushed = WT_STAT(&lsm_tree->stats, lsm_bytes_flushed);
+	merged = WT_STAT(&lsm_tree->stats, lsm_bytes_merged);
+	WT_STAT_SET(stats, lsm_amplification_write,
+	    flushed == 0 ? 0 : (flushed + merged) * 100 / flushed);
+	WT_STAT_SET(stats, lsm_backlog_predicted, lsm_tree->backlog_predicted);
+	WT_STAT_SET(stats, lsm_throttle_delay, lsm_tree->throttle);
 
 	/* Aggregate, and optionally clear, LSM-level specific information. */
 	__wt_stat_aggregate_dsrc_stats(&lsm_tree->stats, stats);
@@ -47,11 +47,15 @@ __lsm_tree_discard(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int final)
 	__wt_free(session, lsm_tree->file_config);
 
 	WT_TRET(__wt_rwlock_destroy(session, &lsm_tree->rwlock));
+	WT_TRET(__wt_cond_destroy(session, &lsm_tree->merge_cond));
 
 	for (i = 0; i < lsm_tree->nchunks; i++) {
 		if ((chunk = lsm_tree->chunk[i]) == NULL)
 			continue;
 
+		__wt_bloom_blocks_free(session, &chunk->bloom_blocks);
+		__wt_buf_free(session, &chunk->min_key);
+		__wt_buf_free(session, &chunk->max_key);
 		__wt_free(session, chunk->bloom_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, chunk);
@@ -62,6 +66,9 @@ __lsm_tree_discard(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int final)
 		chunk = lsm_tree->old_chunks[i];
 		WT_ASSERT(session, chunk != NULL);
 
+		__wt_bloom_blocks_free(session, &chunk->bloom_blocks);
+		__wt_buf_free(session, &chunk->min_key);
+		__wt_buf_free(session, &chunk->max_key);
 		__wt_free(session, chunk->bloom_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, chunk);
@@ -219,6 +226,36 @@ __wt_lsm_tree_set_chunk_size(
 	return (0);
 }
 
+/*
+ * __wt_lsm_tree_set_chunk_keys --
+ *	Record the smallest and largest keys in a chunk, returning WT_NOTFOUND
+ *	if the chunk is empty.  Should only be called for chunks that have been
+ *	checkpointed, before they are marked on disk.
+ */
+int
+__wt_lsm_tree_set_chunk_keys(WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_ITEM key;
+	const char *cfg[] = { WT_CONFIG_BASE(session, session_open_cursor),
+	    "checkpoint=" WT_CHECKPOINT ",raw", NULL };
+
+	WT_RET(__wt_open_cursor(session, chunk->uri, NULL, cfg, &c));
+
+	WT_ERR(c->next(c));
+	WT_ERR(c->get_key(c, &key));
+	WT_ERR(__wt_buf_set(session, &chunk->min_key, key.data, key.size));
+
+	WT_ERR(c->reset(c));
+	WT_ERR(c->prev(c));
+	WT_ERR(c->get_key(c, &key));
+	WT_ERR(__wt_buf_set(session, &chunk->max_key, key.data, key.size));
+
+err:	WT_TRET(c->close(c));
+	return (ret);
+}
+
 /*
  * __lsm_tree_cleanup_old --
  *	Cleanup any old LSM chunks that might conflict with one we are
@@ -290,6 +327,51 @@ __wt_lsm_tree_setup_bloom(
 	return (ret);
 }
 
+/*
+ * __wt_lsm_tree_bloom_load --
+ *	Load a chunk's blocked Bloom filter into memory, if it isn't already.
+ * The filter isn't loaded if the memory used by loaded filters is over the
+ * limit, it's read from disk instead.
+ */
+int
+__wt_lsm_tree_bloom_load(WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk)
+{
+	WT_BLOOM_BLOCKS *blocks;
+
+	if (chunk->bloom_blocks != NULL)
+		return (0);
+
+	/* Threads can race to load the filter, the first one wins. */
+	WT_RET(__wt_bloom_blocks_load(session, chunk->bloom_uri, &blocks));
+	if (blocks != NULL &&
+	    !WT_ATOMIC_CAS8(chunk->bloom_blocks, NULL, blocks))
+		__wt_bloom_blocks_free(session, &blocks);
+	return (0);
+}
+
+/*
+ * __wt_lsm_tree_bloom_insert --
+ *	Insert a key into a chunk's Bloom filter, and the key's prefix if the
+ *	tree is configured with prefix Bloom filters.  Keys are inserted in
+ *	order, the prefix buffer holds the last prefix inserted so each prefix
+ *	is only inserted once.
+ */
+int
+__wt_lsm_tree_bloom_insert(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_BLOOM *bloom, WT_ITEM *key, WT_ITEM *prefix)
+{
+	WT_RET(__wt_bloom_insert(bloom, key));
+
+	if (lsm_tree->bloom_prefix == 0 || key->size <= lsm_tree->bloom_prefix)
+		return (0);
+	if (prefix->size == lsm_tree->bloom_prefix &&
+	    memcmp(prefix->data, key->data, prefix->size) == 0)
+		return (0);
+	WT_RET(__wt_buf_set(
+	    session, prefix, key->data, lsm_tree->bloom_prefix));
+	return (__wt_bloom_insert(bloom, prefix));
+}
+
 /*
  * __wt_lsm_tree_create --
  *	Create an LSM tree structure for the given name.
@@ -359,6 +441,9 @@ __wt_lsm_tree_create(WT_SESSION_IMPL *session,
 	WT_ERR(__wt_config_gets(session, cfg, "lsm.bloom_oldest", &cval));
 	if (cval.val != 0)
 		FLD_SET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST);
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.bloom_blocked", &cval));
+	if (cval.val != 0)
+		FLD_SET(lsm_tree->bloom, WT_LSM_BLOOM_BLOCKED);
 
 	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF) &&
 	    FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST))
@@ -378,12 +463,16 @@ __wt_lsm_tree_create(WT_SESSION_IMPL *session,
 	lsm_tree->bloom_bit_count = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm.bloom_hash_count", &cval));
 	lsm_tree->bloom_hash_count = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.bloom_prefix", &cval));
+	lsm_tree->bloom_prefix = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm.chunk_count_limit", &cval));
 	lsm_tree->chunk_count_limit = (uint32_t)cval.val;
 	if (cval.val == 0)
 		F_SET(lsm_tree, WT_LSM_TREE_MERGES);
 	else
 		F_CLR(lsm_tree, WT_LSM_TREE_MERGES);
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.throttle_backlog", &cval));
+	lsm_tree->throttle_backlog = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm.chunk_max", &cval));
 	lsm_tree->chunk_max = (uint64_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm.chunk_size", &cval));
@@ -399,6 +488,15 @@ __wt_lsm_tree_create(WT_SESSION_IMPL *session,
 	if (lsm_tree->merge_min > lsm_tree->merge_max)
 		WT_ERR_MSG(session, EINVAL,
 		    "LSM merge_min must be less than or equal to merge_max");
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_partitions", &cval));
+	lsm_tree->merge_partitions = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_policy", &cval));
+	if (WT_STRING_MATCH("leveled", cval.str, cval.len))
+		F_SET(lsm_tree, WT_LSM_TREE_LEVELED);
+	else
+		F_CLR(lsm_tree, WT_LSM_TREE_LEVELED);
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.level_multiplier", &cval));
+	lsm_tree->level_multiplier = (u_int)cval.val;
 
 	/*
 	 * Set up the config for each chunk.
@@ -560,6 +658,8 @@ __lsm_tree_open(
 	/* Try to open the tree. */
 	WT_RET(__wt_calloc_one(session, &lsm_tree));
 	WT_ERR(__wt_rwlock_alloc(session, &lsm_tree->rwlock, "lsm tree"));
+	WT_ERR(__wt_cond_alloc(
+	    session, "lsm merge", 0, &lsm_tree->merge_cond));
 
 	WT_ERR(__lsm_tree_set_name(session, lsm_tree, uri));
 
@@ -629,25 +729,8 @@ __wt_lsm_tree_release(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	(void)WT_ATOMIC_SUB4(lsm_tree->refcnt, 1);
 }
 
-/* How aggressively to ramp up or down throttle due to level 0 merging */
-#define	WT_LSM_MERGE_THROTTLE_BUMP_PCT	(100 / lsm_tree->merge_max)
-/* Number of level 0 chunks that need to be present to throttle inserts */
-#define	WT_LSM_MERGE_THROTTLE_THRESHOLD					\
-	(2 * lsm_tree->merge_min)
-/* Minimal throttling time */
-#define	WT_LSM_THROTTLE_START		20
-
-#define	WT_LSM_MERGE_THROTTLE_INCREASE(val)	do {			\
-	(val) += ((val) * WT_LSM_MERGE_THROTTLE_BUMP_PCT) / 100;	\
-	if ((val) < WT_LSM_THROTTLE_START)				\
-		(val) = WT_LSM_THROTTLE_START;				\
-	} while (0)
-
-#define	WT_LSM_MERGE_THROTTLE_DECREASE(val)	do {			\
-	(val) -= ((val) * WT_LSM_MERGE_THROTTLE_BUMP_PCT) / 100;	\
-	if ((val) < WT_LSM_THROTTLE_START)				\
-		(val) = 0;						\
-	} while (0)
+/* Throttling ignores delays of less than a microsecond per update. */
+#define	WT_LSM_THROTTLE_MIN	WT_THOUSAND
 
 /*
  * __wt_lsm_tree_throttle --
@@ -659,40 +742,40 @@ __wt_lsm_tree_throttle(
     WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int decrease_only)
 {
 	WT_LSM_CHUNK *last_chunk, **cp, *ondisk, *prev_chunk;
-	uint64_t cache_sz, cache_used, oldtime, record_count, timediff;
-	uint32_t in_memory, gen0_chunks;
+	uint64_t cache_sz, cache_used, delay, insert_ns, oldtime, timediff;
+	uint32_t backlog, gen0_chunks, in_memory, predicted, target;
 
 	/* Never throttle in small trees. */
 	if (lsm_tree->nchunks < 3) {
-		lsm_tree->ckpt_throttle = lsm_tree->merge_throttle = 0;
+		lsm_tree->throttle = 0;
+		lsm_tree->backlog = lsm_tree->backlog_merge = 0;
+		lsm_tree->backlog_last = lsm_tree->backlog_predicted = 0;
+		lsm_tree->flush_pending = 0;
 		return;
 	}
 
 	cache_sz = S2C(session)->cache_size;
 
 	/*
-	 * In the steady state, we expect that the checkpoint worker thread
-	 * will keep up with inserts.  If not, throttle the insert rate to
-	 * avoid filling the cache with in-memory chunks.  Threads sleep every
-	 * 100 operations, so take that into account in the calculation.
-	 *
-	 * Also throttle based on whether merge threads are keeping up.  If
-	 * there are enough chunks that have never been merged we slow down
-	 * inserts so that merges have some chance of keeping up.
+	 * Throttling is a feedback loop on the tree's backlog: the number of
+	 * in-memory chunks waiting to be flushed (if the tree is configured
+	 * to throttle when flushes aren't keeping up), plus the number of
+	 * on-disk, level 0 chunks waiting to be merged.  Updates are delayed
+	 * in proportion to how far the backlog expected at the next switch
+	 * is over its target, and the delay moves gradually, so updates see
+	 * a steady latency rather than a series of stalls.
 	 *
 	 * Count the number of in-memory chunks, the number of unmerged chunk
 	 * on disk, and find the most recent on-disk chunk (if any).
 	 */
-	record_count = 1;
 	gen0_chunks = in_memory = 0;
 	ondisk = NULL;
 	for (cp = lsm_tree->chunk + lsm_tree->nchunks - 1;
 	    cp >= lsm_tree->chunk;
 	    --cp)
-		if (!F_ISSET(*cp, WT_LSM_CHUNK_ONDISK)) {
-			record_count += (*cp)->count;
+		if (!F_ISSET(*cp, WT_LSM_CHUNK_ONDISK))
 			++in_memory;
-		} else {
+		else {
 			/*
 			 * Assign ondisk to the last chunk that has been
 			 * flushed since the tree was last opened (i.e it's on
@@ -709,61 +792,88 @@ __wt_lsm_tree_throttle(
 		}
 
 	last_chunk = lsm_tree->chunk[lsm_tree->nchunks - 1];
+	prev_chunk = lsm_tree->chunk[lsm_tree->nchunks - 2];
 
-	/* Checkpoint throttling, based on the number of in-memory chunks. */
-	if (!F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) || in_memory <= 3)
-		lsm_tree->ckpt_throttle = 0;
-	else if (decrease_only)
-		; /* Nothing to do */
-	else if (ondisk == NULL) {
-		/*
-		 * No checkpoint has completed this run.  Keep slowing down
-		 * inserts until one does.
-		 */
-		lsm_tree->ckpt_throttle =
-		    WT_MAX(WT_LSM_THROTTLE_START, 2 * lsm_tree->ckpt_throttle);
-	} else {
-		WT_ASSERT(session,
-		    WT_TIMECMP(last_chunk->create_ts, ondisk->create_ts) >= 0);
-		timediff =
-		    WT_TIMEDIFF(last_chunk->create_ts, ondisk->create_ts);
-		lsm_tree->ckpt_throttle =
-		    (long)((in_memory - 2) * timediff / (20 * record_count));
+	/*
+	 * Every in-memory chunk other than the primary is waiting to be
+	 * flushed: the LSM manager uses that to decide how urgently the tree
+	 * needs work done.
+	 */
+	lsm_tree->flush_pending =
+	    in_memory > 1 ? (in_memory - 1) * lsm_tree->chunk_size : 0;
 
-		/*
-		 * Get more aggressive as the number of in memory chunks
-		 * consumes a large proportion of the cache. In memory chunks
-		 * are allowed to grow up to twice as large as the configured
-		 * value when checkpoints aren't keeping up. That worst case
-		 * is when this calculation is relevant.
-		 * There is nothing particularly special about the chosen
-		 * multipliers.
-		 */
-		cache_used = in_memory * lsm_tree->chunk_size * 2;
-		if (cache_used > cache_sz * 0.8)
-			lsm_tree->ckpt_throttle *= 5;
+	/*
+	 * Sum the backlog and its target.  By default, allow two chunks to
+	 * wait for a flush and, once the tree holds a full merge of chunks,
+	 * two minimum merges of level 0 chunks to wait for a merge.
+	 */
+	backlog = target = 0;
+	if (F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE)) {
+		backlog += in_memory > 1 ? in_memory - 1 : 0;
+		target += 2;
 	}
+	lsm_tree->backlog_merge = 0;
+	if (F_ISSET(lsm_tree, WT_LSM_TREE_MERGES) &&
+	    lsm_tree->nchunks >= lsm_tree->merge_max) {
+		lsm_tree->backlog_merge = gen0_chunks;
+		backlog += gen0_chunks;
+		target += 2 * lsm_tree->merge_min;
+	}
+	if (target != 0 && lsm_tree->throttle_backlog != 0)
+		target = lsm_tree->throttle_backlog;
 
 	/*
-	 * Merge throttling, based on the number of on-disk, level 0 chunks.
-	 *
-	 * Don't throttle if the tree has less than a single level's number
-	 * of chunks.
+	 * Predict the backlog at the next switch by assuming it keeps growing
+	 * as it did since the last switch.  Flushes and merges between
+	 * switches only shrink the current backlog.
+	 */
+	predicted = backlog;
+	if (backlog > lsm_tree->backlog_last)
+		predicted += backlog - lsm_tree->backlog_last;
+	if (!decrease_only)
+		lsm_tree->backlog_last = backlog;
+	lsm_tree->backlog = backlog;
+	lsm_tree->backlog_predicted = predicted;
+
+	/*
+	 * Estimate how long each update takes without throttling, from the
+	 * time taken to fill the previous chunk less the delay applied to
+	 * each of its updates.
 	 */
-	if (F_ISSET(lsm_tree, WT_LSM_TREE_MERGES)) {
-		if (lsm_tree->nchunks < lsm_tree->merge_max)
-			lsm_tree->merge_throttle = 0;
-		else if (gen0_chunks < WT_LSM_MERGE_THROTTLE_THRESHOLD)
-			WT_LSM_MERGE_THROTTLE_DECREASE(
-			    lsm_tree->merge_throttle);
-		else if (!decrease_only)
-			WT_LSM_MERGE_THROTTLE_INCREASE(
-			    lsm_tree->merge_throttle);
+	insert_ns = WT_LSM_THROTTLE_MIN;
+	if (lsm_tree->chunk_fill_ms != 0 && prev_chunk->count != 0) {
+		insert_ns =
+		    lsm_tree->chunk_fill_ms * WT_MILLION / prev_chunk->count;
+		insert_ns =
+		    insert_ns > lsm_tree->throttle + WT_LSM_THROTTLE_MIN ?
+		    insert_ns - lsm_tree->throttle : WT_LSM_THROTTLE_MIN;
 	}
 
-	/* Put an upper bound of 1s on both throttle calculations. */
-	lsm_tree->ckpt_throttle = WT_MIN(1000000, lsm_tree->ckpt_throttle);
-	lsm_tree->merge_throttle = WT_MIN(1000000, lsm_tree->merge_throttle);
+	/*
+	 * Slow updates by the fraction the predicted backlog is over its
+	 * target: for example, twice the target backlog doubles the time each
+	 * update takes.  In-memory chunks are allowed to grow up to twice as
+	 * large as the configured value when flushes aren't keeping up: if
+	 * they could fill most of the cache, slow updates at least that much.
+	 */
+	delay = 0;
+	if (target != 0 && predicted > target)
+		delay = insert_ns * (predicted - target) / target;
+	cache_used = in_memory * lsm_tree->chunk_size * 2;
+	if (F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) &&
+	    in_memory > 3 && cache_used > cache_sz * 0.8)
+		delay = WT_MAX(delay, insert_ns);
+	delay = WT_MIN(delay, WT_LSM_THROTTLE_MAX);
+
+	/*
+	 * Move half way to the new delay, so a single slow flush or merge
+	 * doesn't stall updates.  Flushes and merges can only reduce the
+	 * delay, it grows as chunks are switched.
+	 */
+	if (!decrease_only || delay < lsm_tree->throttle)
+		lsm_tree->throttle = (lsm_tree->throttle + delay) / 2;
+	if (lsm_tree->throttle < WT_LSM_THROTTLE_MIN)
+		lsm_tree->throttle = 0;
 
 	/*
 	 * Update our estimate of how long each in-memory chunk stays active.
@@ -773,7 +883,6 @@ __wt_lsm_tree_throttle(
 	 * period, we can calculate a crazy value.
 	 */
 	if (in_memory > 1 && ondisk != NULL) {
-		prev_chunk = lsm_tree->chunk[lsm_tree->nchunks - 2];
 		WT_ASSERT(session, prev_chunk->generation == 0);
 		WT_ASSERT(session, WT_TIMECMP(
 		    last_chunk->create_ts, prev_chunk->create_ts) >= 0);
@@ -827,9 +936,10 @@ __wt_lsm_tree_switch(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	    nchunks + 1, &lsm_tree->chunk));
 
 	WT_ERR(__wt_verbose(session, WT_VERB_LSM,
-	    "Tree %s switch to: %" PRIu32 ", checkpoint throttle %ld, "
-	    "merge throttle %ld", lsm_tree->name,
-	    new_id, lsm_tree->ckpt_throttle, lsm_tree->merge_throttle));
+	    "Tree %s switch to: %" PRIu32 ", backlog %" PRIu32
+	    ", predicted %" PRIu32 ", throttle %" PRIu64 "ns",
+	    lsm_tree->name, new_id, lsm_tree->backlog,
+	    lsm_tree->backlog_predicted, lsm_tree->throttle));
 
 	WT_ERR(__wt_calloc_one(session, &chunk));
 	chunk->id = new_id;
@@ -1084,7 +1194,7 @@ __wt_lsm_tree_truncate(
 
 	/* Mark all chunks old. */
 	WT_ERR(__wt_lsm_merge_update_tree(
-	    session, lsm_tree, 0, lsm_tree->nchunks, chunk));
+	    session, lsm_tree, 0, lsm_tree->nchunks, &chunk, 1));
 
 	WT_ERR(__wt_lsm_meta_write(session, lsm_tree));
 
@@ -1230,8 +1340,11 @@ __wt_lsm_compact(WT_SESSION_IMPL *session, const char *name, int *skip)
 	WT_ERR(__wt_lsm_tree_writelock(session, lsm_tree));
 	locked = 1;
 
-	/* Clear any merge throttle: compact throws out that calculation. */
-	lsm_tree->merge_throttle = 0;
+	/*
+	 * Clear the merge backlog: compact throws out that calculation, and
+	 * merges shouldn't be limited to level 0 chunks.
+	 */
+	lsm_tree->backlog_merge = 0;
 	lsm_tree->merge_aggressiveness = 0;
 	progress = lsm_tree->merge_progressing;
 
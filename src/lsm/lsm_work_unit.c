@@ -10,6 +10,8 @@
 
 static int __lsm_bloom_create(
     WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_CHUNK *, u_int);
+static int __lsm_bloom_flush(WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_CHUNK *);
+static void __lsm_bloom_set(WT_LSM_TREE *, WT_LSM_CHUNK *);
 static int __lsm_discard_handle(WT_SESSION_IMPL *, const char *, const char *);
 
 /*
@@ -257,6 +259,9 @@ __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session,
 {
 	WT_DECL_RET;
 	WT_TXN_ISOLATION saved_isolation;
+	int bloom, keys;
+
+	bloom = keys = 0;
 
 	/*
 	 * If the chunk is already checkpointed, make sure it is also evicted.
@@ -324,14 +329,43 @@ __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session,
 	if (ret != 0)
 		WT_RET_MSG(session, ret, "LSM checkpoint");
 
-	/* Now the file is written, get the chunk size. */
+	/* Now the file is written, get the chunk size and key range. */
 	WT_RET(__wt_lsm_tree_set_chunk_size(session, chunk));
+	WT_STAT_FAST_INCRV(session,
+	    &lsm_tree->stats, lsm_bytes_flushed, chunk->size);
+	if ((ret = __wt_lsm_tree_set_chunk_keys(session, chunk)) == 0)
+		keys = 1;
+	WT_RET_NOTFOUND_OK(ret);
+
+	/*
+	 * Create the chunk's Bloom filter while the chunk is still in memory,
+	 * so the chunk isn't read again to create it.  Another thread can be
+	 * flushing the same chunk: see if we win the race to switch on the
+	 * "busy" flag and recheck the chunk still needs a Bloom filter.
+	 */
+	if (!FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF) &&
+	    chunk->count != 0 && WT_ATOMIC_CAS4(chunk->bloom_busy, 0, 1)) {
+		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
+			chunk->bloom_busy = 0;
+		else {
+			bloom = 1;
+			if ((ret =
+			    __lsm_bloom_flush(session, lsm_tree, chunk)) != 0) {
+				chunk->bloom_busy = 0;
+				return (ret);
+			}
+		}
+	}
 
 	/* Update the flush timestamp to help track ongoing progress. */
 	WT_RET(__wt_epoch(session, &lsm_tree->last_flush_ts));
 
 	/* Lock the tree, mark the chunk as on disk and update the metadata. */
 	WT_RET(__wt_lsm_tree_writelock(session, lsm_tree));
+	if (keys)
+		F_SET(chunk, WT_LSM_CHUNK_KEYS);
+	if (bloom)
+		__lsm_bloom_set(lsm_tree, chunk);
 	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
 	ret = __wt_lsm_meta_write(session, lsm_tree);
 	++lsm_tree->dsk_gen;
@@ -339,18 +373,24 @@ __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session,
 	/* Update the throttle time. */
 	__wt_lsm_tree_throttle(session, lsm_tree, 1);
 	WT_TRET(__wt_lsm_tree_writeunlock(session, lsm_tree));
+	if (bloom)
+		chunk->bloom_busy = 0;
 
 	if (ret != 0)
 		WT_RET_MSG(session, ret, "LSM metadata write");
+	if (bloom)
+		WT_STAT_FAST_INCR(session, &lsm_tree->stats, bloom_flush);
 
 	/*
 	 * Clear the "cache resident" flag so the primary can be evicted and
 	 * eventually closed.  Only do this once the checkpoint has succeeded:
 	 * otherwise, accessing the leaf page during the checkpoint can trigger
-	 * forced eviction.
+	 * forced eviction.  Pages created from here on don't need arenas, the
+	 * chunk is no longer updated.
 	 */
 	WT_RET(__wt_session_get_btree(session, chunk->uri, NULL, NULL, 0));
 	__wt_btree_evictable(session, 1);
+	S2BT(session)->page_arena = 0;
 	WT_RET(__wt_session_release_btree(session));
 
 	/* Make sure we aren't pinning a transaction ID. */
@@ -359,47 +399,37 @@ __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session,
 	WT_RET(__wt_verbose(session, WT_VERB_LSM, "LSM worker checkpointed %s",
 	    chunk->uri));
 
-	/* Schedule a bloom filter create for our newly flushed chunk. */
-	if (!FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF))
-		WT_RET(__wt_lsm_manager_push_entry(
-		    session, WT_LSM_WORK_BLOOM, 0, lsm_tree));
-	else
-		WT_RET(__wt_lsm_manager_push_entry(
-		    session, WT_LSM_WORK_MERGE, 0, lsm_tree));
+	/* The chunk has its Bloom filter, if any: schedule a merge. */
+	WT_RET(__wt_lsm_manager_push_entry(
+	    session, WT_LSM_WORK_MERGE, 0, lsm_tree));
 	return (0);
 }
 
 /*
- * __lsm_bloom_create --
- *	Create a bloom filter for a chunk of the LSM tree that has been
- *	checkpointed but not yet been merged.
+ * __lsm_bloom_fill --
+ *	Create a Bloom filter for a chunk of the LSM tree from the keys
+ *	returned by a cursor.
  */
 static int
-__lsm_bloom_create(WT_SESSION_IMPL *session,
-    WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk, u_int chunk_off)
+__lsm_bloom_fill(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk, WT_CURSOR *src)
 {
 	WT_BLOOM *bloom;
-	WT_CURSOR *src;
+	WT_DECL_ITEM(prefix);
 	WT_DECL_RET;
 	WT_ITEM key;
 	uint64_t insert_count;
+	int blocked;
 
 	WT_RET(__wt_lsm_tree_setup_bloom(session, lsm_tree, chunk));
 
 	bloom = NULL;
-	/*
-	 * This is merge-like activity, and we don't want compacts to give up
-	 * because we are creating a bunch of bloom filters before merging.
-	 */
-	++lsm_tree->merge_progressing;
-	WT_RET(__wt_bloom_create(session, chunk->bloom_uri,
+	WT_RET(__wt_scr_alloc(session, 0, &prefix));
+	blocked = FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_BLOCKED) ? 1 : 0;
+	WT_ERR(__wt_bloom_create(session, chunk->bloom_uri,
 	    lsm_tree->bloom_config, chunk->count,
-	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count, &bloom));
-
-	/* Open a special merge cursor just on this chunk. */
-	WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
-	F_SET(src, WT_CURSTD_RAW);
-	WT_ERR(__wt_clsm_init_merge(src, chunk_off, chunk->id, 1));
+	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count,
+	    blocked ? WT_BLOOM_BLOCKED : 0, &bloom));
 
 	/*
 	 * Setup so that we don't hold pages we read into cache, and so
@@ -410,38 +440,109 @@ __lsm_bloom_create(WT_SESSION_IMPL *session,
 	F_SET(session, WT_SESSION_NO_CACHE | WT_SESSION_NO_CACHE_CHECK);
 	for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
 		WT_ERR(src->get_key(src, &key));
-		WT_ERR(__wt_bloom_insert(bloom, &key));
+		WT_ERR(__wt_lsm_tree_bloom_insert(
+		    session, lsm_tree, bloom, &key, prefix));
 	}
 	WT_ERR_NOTFOUND_OK(ret);
-	WT_TRET(src->close(src));
 
-	WT_TRET(__wt_bloom_finalize(bloom));
-	WT_ERR(ret);
+	WT_ERR(__wt_bloom_finalize(bloom));
 
 	F_CLR(session, WT_SESSION_NO_CACHE);
 
-	/* Load the new Bloom filter into cache. */
-	WT_CLEAR(key);
-	WT_ERR_NOTFOUND_OK(__wt_bloom_get(bloom, &key));
+	/* Load the new Bloom filter into cache, or into memory if blocked. */
+	if (blocked)
+		WT_ERR(__wt_lsm_tree_bloom_load(session, chunk));
+	else {
+		WT_CLEAR(key);
+		WT_ERR_NOTFOUND_OK(__wt_bloom_get(bloom, &key));
+	}
 
 	WT_ERR(__wt_verbose(session, WT_VERB_LSM,
 	    "LSM worker created bloom filter %s. "
 	    "Expected %" PRIu64 " items, got %" PRIu64,
 	    chunk->bloom_uri, chunk->count, insert_count));
 
-	/* Ensure the bloom filter is in the metadata. */
-	WT_ERR(__wt_lsm_tree_writelock(session, lsm_tree));
+err:	if (bloom != NULL)
+		WT_TRET(__wt_bloom_close(bloom));
+	__wt_scr_free(session, &prefix);
+	F_CLR(session, WT_SESSION_NO_CACHE | WT_SESSION_NO_CACHE_CHECK);
+	return (ret);
+}
+
+/*
+ * __lsm_bloom_set --
+ *	Mark a chunk as having a Bloom filter; called with the LSM tree locked.
+ */
+static void
+__lsm_bloom_set(WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
 	F_SET(chunk, WT_LSM_CHUNK_BLOOM);
+	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_BLOCKED))
+		F_SET(chunk, WT_LSM_CHUNK_BLOOM_BLOCKED);
+}
+
+/*
+ * __lsm_bloom_create --
+ *	Create a bloom filter for a chunk of the LSM tree that has been
+ *	checkpointed but not yet been merged.
+ */
+static int
+__lsm_bloom_create(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk, u_int chunk_off)
+{
+	WT_CURSOR *src;
+	WT_DECL_RET;
+
+	/*
+	 * This is merge-like activity, and we don't want compacts to give up
+	 * because we are creating a bunch of bloom filters before merging.
+	 */
+	++lsm_tree->merge_progressing;
+
+	/* Open a special merge cursor just on this chunk. */
+	WT_RET(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
+	F_SET(src, WT_CURSTD_RAW);
+	if ((ret = __wt_clsm_init_merge(src, &chunk, 1, chunk_off != 0)) == 0)
+		ret = __lsm_bloom_fill(session, lsm_tree, chunk, src);
+	WT_TRET(src->close(src));
+	WT_RET(ret);
+
+	/* Ensure the bloom filter is in the metadata. */
+	WT_RET(__wt_lsm_tree_writelock(session, lsm_tree));
+	__lsm_bloom_set(lsm_tree, chunk);
 	ret = __wt_lsm_meta_write(session, lsm_tree);
 	++lsm_tree->dsk_gen;
 	WT_TRET(__wt_lsm_tree_writeunlock(session, lsm_tree));
 
 	if (ret != 0)
-		WT_ERR_MSG(session, ret, "LSM bloom worker metadata write");
+		WT_RET_MSG(session, ret, "LSM bloom worker metadata write");
+	return (0);
+}
 
-err:	if (bloom != NULL)
-		WT_TRET(__wt_bloom_close(bloom));
-	F_CLR(session, WT_SESSION_NO_CACHE | WT_SESSION_NO_CACHE_CHECK);
+/*
+ * __lsm_bloom_flush --
+ *	Create a Bloom filter for a chunk being flushed, from the chunk's pages
+ *	still in memory, rather than reading the chunk back from disk later.
+ */
+static int
+__lsm_bloom_flush(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_CURSOR *src;
+	WT_DECL_RET;
+	const char *cfg[] = {
+	    WT_CONFIG_BASE(session, session_open_cursor), "raw", NULL };
+
+	/*
+	 * Every update in the chunk is visible, and the chunk's pages can't
+	 * be evicted until the flush completes, so a cursor on the chunk
+	 * reads its keys from memory.  Removed keys are tombstones in the
+	 * chunk, they are included in the filter, as they would be by a
+	 * merge cursor on a chunk that isn't the oldest.
+	 */
+	WT_RET(__wt_open_cursor(session, chunk->uri, NULL, cfg, &src));
+	ret = __lsm_bloom_fill(session, lsm_tree, chunk, src);
+	WT_TRET(src->close(src));
 	return (ret);
 }
 
@@ -595,6 +696,9 @@ __wt_lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		 * tree that we haven't already skipped over.
 		 */
 		WT_ASSERT(session, lsm_tree->old_chunks[skipped] == chunk);
+		__wt_bloom_blocks_free(session, &chunk->bloom_blocks);
+		__wt_buf_free(session, &chunk->min_key);
+		__wt_buf_free(session, &chunk->max_key);
 		__wt_free(session, chunk->bloom_uri);
 		__wt_free(session, chunk->uri);
 		__wt_free(session, lsm_tree->old_chunks[skipped]);
@@ -32,6 +32,13 @@ typedef struct {
 	uint64_t skipped_txn;
 	uint32_t orig_write_gen;
 
+	/*
+	 * When writing old versions to the lookaside table, the oldest running
+	 * transaction ID when reconciliation started: older updates are
+	 * committed.
+	 */
+	uint64_t las_running;
+
 	/*
 	 * If page updates are skipped because they are as yet unresolved, or
 	 * the page has updates we cannot discard, the page is left "dirty":
@@ -303,6 +310,7 @@ static int  __rec_col_var(WT_SESSION_IMPL *,
 static int  __rec_col_var_helper(WT_SESSION_IMPL *, WT_RECONCILE *,
 		WT_SALVAGE_COOKIE *, WT_ITEM *, int, uint8_t, uint64_t);
 static int  __rec_destroy_session(WT_SESSION_IMPL *);
+static int  __rec_las_remove(WT_SESSION_IMPL *, WT_BOUNDARY *);
 static int  __rec_root_write(WT_SESSION_IMPL *, WT_PAGE *, uint32_t);
 static int  __rec_row_int(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
 static int  __rec_row_leaf(WT_SESSION_IMPL *,
@@ -318,6 +326,8 @@ static int  __rec_split_row_promote(
 		WT_SESSION_IMPL *, WT_RECONCILE *, WT_ITEM *, uint8_t);
 static int  __rec_split_write(WT_SESSION_IMPL *,
 		WT_RECONCILE *, WT_BOUNDARY *, WT_ITEM *, int);
+static int  __rec_update_las(
+		WT_SESSION_IMPL *, WT_RECONCILE *, uint32_t, WT_BOUNDARY *);
 static int  __rec_write_init(WT_SESSION_IMPL *,
 		WT_REF *, uint32_t, WT_SALVAGE_COOKIE *, void *);
 static int  __rec_write_wrapup(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
@@ -598,9 +608,11 @@ __rec_write_init(WT_SESSION_IMPL *session,
 	WT_BTREE *btree;
 	WT_PAGE *page;
 	WT_RECONCILE *r;
+	WT_TXN_GLOBAL *txn_global;
 
 	btree = S2BT(session);
 	page = ref->page;
+	txn_global = &S2C(session)->txn_global;
 
 	if ((r = *(WT_RECONCILE **)reconcilep) == NULL) {
 		WT_RET(__wt_calloc_one(session, &r));
@@ -689,7 +701,22 @@ __rec_write_init(WT_SESSION_IMPL *session,
 	 * Running transactions may update the page after we write it, so
 	 * this is the highest ID we can be confident we will see.
 	 */
-	r->skipped_txn = S2C(session)->txn_global.last_running;
+	r->skipped_txn = txn_global->last_running;
+
+	/* Track the newest transaction ID written for this page. */
+	r->max_txn = WT_TXN_NONE;
+
+	/*
+	 * Writing old versions to the lookaside table requires updates be
+	 * committed before the checkpoint's snapshot is taken: read the oldest
+	 * running ID before checking for a checkpoint (the checkpoint sets its
+	 * flag before taking its snapshot).
+	 */
+	if (F_ISSET(r, WT_SKIP_UPDATE_LAS)) {
+		WT_ORDERED_READ(r->las_running, txn_global->last_running);
+		if (txn_global->checkpoint_running)
+			return (EBUSY);
+	}
 
 	return (0);
 }
@@ -881,7 +908,15 @@ __rec_txn_read(WT_SESSION_IMPL *session, WT_RECONCILE *r,
 		 * reconciled until modified again.
 		 */
 		if (*updp == NULL) {
-			if (__wt_txn_visible(session, txnid))
+			/*
+			 * Writing old versions to the lookaside table: write
+			 * the newest update, it had better be committed.
+			 */
+			if (F_ISSET(r, WT_SKIP_UPDATE_LAS)) {
+				if (!TXNID_LT(txnid, r->las_running))
+					return (EBUSY);
+				*updp = upd;
+			} else if (__wt_txn_visible(session, txnid))
 				*updp = upd;
 			else
 				skipped = 1;
@@ -909,6 +944,15 @@ __rec_txn_read(WT_SESSION_IMPL *session, WT_RECONCILE *r,
 	if (__wt_txn_visible_all(session, max_txn) && !skipped)
 		return (0);
 
+	/*
+	 * If writing old versions to the lookaside table, save the update list
+	 * so the versions running transactions may need can be written once
+	 * the block's address is known.  The page is written with the newest
+	 * committed values, it can be marked clean.
+	 */
+	if (F_ISSET(r, WT_SKIP_UPDATE_LAS))
+		return (__rec_skip_update_save(session, r, ins, rip));
+
 	/*
 	 * If some updates are not globally visible, or were skipped, the page
 	 * cannot be marked clean.
@@ -986,7 +1030,8 @@ __rec_txn_read(WT_SESSION_IMPL *session, WT_RECONCILE *r,
 		 * running transaction in the system, ensuring the on-page value
 		 * will be ignored.
 		 */
-		WT_RET(__wt_update_alloc(session, &ovfl, &upd_ovfl, &notused));
+		WT_RET(__wt_update_alloc(
+		    session, page, &ovfl, &upd_ovfl, &notused));
 		upd_ovfl->txnid = WT_TXN_NONE;
 		for (upd = upd_list; upd->next != NULL; upd = upd->next)
 			;
@@ -2834,12 +2879,21 @@ skip_check_complete:
 		r->skip[j] = r->skip[i];
 	r->skip_next = j;
 
+	/*
+	 * If writing old versions to the lookaside table, the block is written
+	 * and the saved update lists are copied into the lookaside table keyed
+	 * by the block's address.  Empty blocks can't be written, give up.
+	 */
+	if (F_ISSET(r, WT_SKIP_UPDATE_LAS) &&
+	    bnd->skip != NULL && dsk->u.entries == 0)
+		WT_ERR(EBUSY);
+
 	/*
 	 * If we had to skip updates in order to build this disk image, we can't
 	 * actually write it. Instead, we will re-instantiate the page using the
 	 * disk image and the list of updates we skipped.
 	 */
-	if (bnd->skip != NULL) {
+	if (bnd->skip != NULL && !F_ISSET(r, WT_SKIP_UPDATE_LAS)) {
 		/*
 		 * If the buffer is compressed (raw compression was configured),
 		 * we have to decompress it so we can instantiate it later. It's
@@ -2871,10 +2925,13 @@ skip_check_complete:
 	 * previous reconciliation of the page split or if we will split this
 	 * time, but that test won't calculate a checksum on the first block
 	 * the first time the page splits.
+	 *
+	 * Blocks with lookaside table records are always written, the records
+	 * are keyed by the new block's address.
 	 */
 	bnd_slot = (uint32_t)(bnd - r->bnd);
-	if (bnd_slot > 1 ||
-	    (F_ISSET(mod, WT_PM_REC_MULTIBLOCK) && mod->mod_multi != NULL)) {
+	if (bnd->skip == NULL && (bnd_slot > 1 ||
+	    (F_ISSET(mod, WT_PM_REC_MULTIBLOCK) && mod->mod_multi != NULL))) {
 		/*
 		 * There are page header fields which need to be cleared to get
 		 * consistent checksums: specifically, the write generation and
@@ -2905,11 +2962,181 @@ skip_check_complete:
 	WT_ERR(__wt_strndup(session, addr, addr_size, &bnd->addr.addr));
 	bnd->addr.size = (uint8_t)addr_size;
 
+	/*
+	 * Lookaside table records are keyed by block address, and the block
+	 * the records were written for may have been freed without being read
+	 * back, for example, if a later reconciliation of the page replaced
+	 * it.  Discard any records for a re-used address before the block
+	 * can be read.
+	 */
+	if (dsk->type == WT_PAGE_ROW_LEAF &&
+	    S2C(session)->las_entries != 0 &&
+	    !F_ISSET(btree, WT_BTREE_LOOKASIDE))
+		WT_ERR(__rec_las_remove(session, bnd));
+
+	/*
+	 * Copy the saved update lists into the lookaside table, then discard
+	 * them, the block is written.  Blocks with lookaside table records
+	 * must be read before they're discarded: set the address type so the
+	 * page can't be fast-deleted.
+	 */
+	if (F_ISSET(r, WT_SKIP_UPDATE_LAS) && bnd->skip != NULL) {
+		bnd->addr.type = WT_ADDR_LEAF;
+		WT_ERR(__rec_update_las(session, r, btree->id, bnd));
+
+		__wt_free(session, bnd->skip);
+		bnd->skip_next = 0;
+		bnd->skip_allocated = 0;
+	}
+
 done:
 err:	__wt_scr_free(session, &key);
 	return (ret);
 }
 
+/*
+ * __rec_update_las --
+ *	Copy a block's saved update lists into the lookaside table.
+ */
+static int
+__rec_update_las(WT_SESSION_IMPL *session,
+    WT_RECONCILE *r, uint32_t btree_id, WT_BOUNDARY *bnd)
+{
+	WT_CELL *cell;
+	WT_CELL_UNPACK unpack;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(key);
+	WT_DECL_ITEM(value);
+	WT_DECL_RET;
+	WT_ITEM las_addr, las_value;
+	WT_PAGE *page;
+	WT_UPDATE *upd;
+	WT_UPD_SKIPPED *list;
+	uint64_t block_txn, las_counter;
+	uint32_t i;
+	uint8_t upd_type;
+
+	cursor = NULL;
+	page = r->page;
+	las_counter = 0;
+
+	/*
+	 * Find the newest transaction ID saved for the block: once it's
+	 * globally visible, none of the block's records can be read.
+	 */
+	block_txn = WT_TXN_NONE;
+	for (i = 0, list = bnd->skip; i < bnd->skip_next; ++i, ++list)
+		for (upd = list->ins == NULL ?
+		    WT_ROW_UPDATE(page, list->rip) : list->ins->upd;
+		    upd != NULL; upd = upd->next)
+			if (upd->txnid != WT_TXN_ABORTED &&
+			    TXNID_LT(block_txn, upd->txnid))
+				block_txn = upd->txnid;
+
+	/* The lookaside table may have been closed underneath us. */
+	__wt_las_cursor(session, &cursor);
+	if (cursor == NULL)
+		return (EBUSY);
+
+	WT_ERR(__wt_scr_alloc(session, 0, &key));
+	WT_ERR(__wt_scr_alloc(session, 0, &value));
+
+	las_addr.data = bnd->addr.addr;
+	las_addr.size = bnd->addr.size;
+	for (i = 0, list = bnd->skip; i < bnd->skip_next; ++i, ++list) {
+		if (list->ins == NULL) {
+			WT_ERR(__wt_row_leaf_key(
+			    session, page, list->rip, key, 0));
+			upd = WT_ROW_UPDATE(page, list->rip);
+		} else {
+			key->data = WT_INSERT_KEY(list->ins);
+			key->size = WT_INSERT_KEY_SIZE(list->ins);
+			upd = list->ins->upd;
+		}
+
+		/*
+		 * Write the update list, newest first, stopping after the first
+		 * complete value every transaction can read.
+		 */
+		for (; upd != NULL; upd = upd->next) {
+			if (upd->txnid == WT_TXN_ABORTED)
+				continue;
+			if (WT_UPDATE_DELETED_ISSET(upd)) {
+				upd_type = WT_UPDATE_DELETED;
+				las_value.data = "";
+				las_value.size = 0;
+			} else {
+				upd_type = upd->type;
+				las_value.data = WT_UPDATE_DATA(upd);
+				las_value.size = upd->size;
+			}
+			WT_ERR(__wt_las_insert(session, cursor,
+			    btree_id, &las_addr, las_counter++, block_txn,
+			    upd->txnid, upd_type, key, &las_value));
+
+			if (upd_type != WT_UPDATE_MODIFIED &&
+			    __wt_txn_visible_all(session, upd->txnid))
+				break;
+		}
+		if (upd != NULL)
+			continue;
+
+		/*
+		 * No complete value in the list is visible to everyone: write
+		 * the original on-page value (or a deleted record for inserted
+		 * keys, which have no original value), with a transaction ID
+		 * every transaction can read.
+		 */
+		if (list->ins != NULL) {
+			upd_type = WT_UPDATE_DELETED;
+			value->data = "";
+			value->size = 0;
+		} else {
+			upd_type = WT_UPDATE_STANDARD;
+			if ((cell = __wt_row_leaf_value_cell(
+			    page, list->rip, NULL)) == NULL) {
+				value->data = "";
+				value->size = 0;
+			} else {
+				__wt_cell_unpack(cell, &unpack);
+				WT_ERR(__wt_page_cell_data_ref(
+				    session, page, &unpack, value));
+			}
+		}
+		WT_ERR(__wt_las_insert(session, cursor,
+		    btree_id, &las_addr, las_counter++, block_txn,
+		    WT_TXN_NONE, upd_type, key, value));
+	}
+
+	WT_STAT_FAST_CONN_INCR(session, cache_write_lookaside);
+	WT_STAT_FAST_DATA_INCR(session, cache_write_lookaside);
+
+err:	WT_TRET(__wt_las_cursor_close(session, &cursor));
+	__wt_scr_free(session, &key);
+	__wt_scr_free(session, &value);
+	return (ret);
+}
+
+/*
+ * __rec_las_remove --
+ *	Remove the lookaside table records for a block.
+ */
+static int
+__rec_las_remove(WT_SESSION_IMPL *session, WT_BOUNDARY *bnd)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+
+	__wt_las_cursor(session, &cursor);
+	if (cursor == NULL)
+		return (0);
+
+	ret = __wt_las_remove_block(session,
+	    cursor, S2BT(session)->id, bnd->addr.addr, bnd->addr.size);
+	WT_TRET(__wt_las_cursor_close(session, &cursor));
+	return (ret);
+}
+
 /*
  * __wt_bulk_init --
  *	Bulk insert initialization.
@@ -4468,13 +4695,13 @@ __rec_row_leaf(WT_SESSION_IMPL *session,
 			 * build the value's WT_CELL chunk from the most recent
 			 * update value.
 			 */
-			if (upd->size == 0) {
+			WT_ERR(__wt_update_value(session, upd, tmpval));
+			if (tmpval->size == 0) {
 				val->buf.data = NULL;
 				val->cell_len = val->len = val->buf.size = 0;
 			} else {
 				WT_ERR(__rec_cell_build_val(session, r,
-				    WT_UPDATE_DATA(upd), upd->size,
-				    (uint64_t)0));
+				    tmpval->data, tmpval->size, (uint64_t)0));
 				dictionary = 1;
 			}
 		}
@@ -4623,6 +4850,8 @@ static int
 __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_INSERT *ins)
 {
 	WT_BTREE *btree;
+	WT_DECL_ITEM(tmpval);
+	WT_DECL_RET;
 	WT_KV *key, *val;
 	WT_UPDATE *upd;
 	int ovfl_key;
@@ -4632,26 +4861,30 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_INSERT *ins)
 	key = &r->k;
 	val = &r->v;
 
+	/* Modified updates are built in a scratch buffer. */
+	WT_RET(__wt_scr_alloc(session, 0, &tmpval));
+
 	for (; ins != NULL; ins = WT_SKIP_NEXT(ins)) {
 		/* Look for an update. */
-		WT_RET(__rec_txn_read(session, r, ins, NULL, NULL, &upd));
+		WT_ERR(__rec_txn_read(session, r, ins, NULL, NULL, &upd));
 		if (upd == NULL || WT_UPDATE_DELETED_ISSET(upd))
 			continue;
 
-		if (upd->size == 0)			/* Build value cell. */
+		WT_ERR(__wt_update_value(session, upd, tmpval));
+		if (tmpval->size == 0)			/* Build value cell. */
 			val->len = 0;
 		else
-			WT_RET(__rec_cell_build_val(session, r,
-			    WT_UPDATE_DATA(upd), upd->size, (uint64_t)0));
+			WT_ERR(__rec_cell_build_val(session, r,
+			    tmpval->data, tmpval->size, (uint64_t)0));
 
 							/* Build key cell. */
-		WT_RET(__rec_cell_build_leaf_key(session, r,
+		WT_ERR(__rec_cell_build_leaf_key(session, r,
 		    WT_INSERT_KEY(ins), WT_INSERT_KEY_SIZE(ins), &ovfl_key));
 
 		/* Boundary: split or write the page. */
 		if (key->len + val->len > r->space_avail) {
 			if (r->raw_compression)
-				WT_RET(__rec_split_raw(
+				WT_ERR(__rec_split_raw(
 				    session, r, key->len + val->len));
 			else {
 				/*
@@ -4663,13 +4896,13 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_INSERT *ins)
 				if (r->key_pfx_compress_conf) {
 					r->key_pfx_compress = 0;
 					if (!ovfl_key)
-						WT_RET(
+						WT_ERR(
 						    __rec_cell_build_leaf_key(
 						    session,
 						    r, NULL, 0, &ovfl_key));
 				}
 
-				WT_RET(__rec_split(
+				WT_ERR(__rec_split(
 				    session, r, key->len + val->len));
 			}
 		}
@@ -4681,7 +4914,7 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_INSERT *ins)
 		else {
 			r->all_empty_value = 0;
 			if (btree->dictionary)
-				WT_RET(__rec_dict_replace(session, r, 0, val));
+				WT_ERR(__rec_dict_replace(session, r, 0, val));
 			__rec_copy_incr(session, r, val);
 		}
 
@@ -4689,7 +4922,8 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_INSERT *ins)
 		__rec_key_state_update(r, ovfl_key);
 	}
 
-	return (0);
+err:	__wt_scr_free(session, &tmpval);
+	return (ret);
 }
 
 /*
@@ -5013,7 +5247,12 @@ err:			__wt_scr_free(session, &tkey);
 		btree->modified = 1;
 		WT_FULL_BARRIER();
 	} else {
-		mod->rec_max_txn = r->max_txn;
+		/*
+		 * If old versions were written to the lookaside table, the
+		 * page no longer holds updates readers need.
+		 */
+		mod->rec_max_txn = F_ISSET(r, WT_SKIP_UPDATE_LAS) ?
+		    WT_TXN_NONE : r->max_txn;
 
 		if (WT_ATOMIC_CAS4(mod->write_gen, r->orig_write_gen, 0))
 			__wt_cache_dirty_decr(session, page);
@@ -5063,6 +5302,13 @@ __rec_write_wrapup_err(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 			if (bnd->addr.reuse)
 				bnd->addr.addr = NULL;
 			else {
+				/*
+				 * Remove any lookaside table records for the
+				 * block before freeing it: the address may be
+				 * re-used.
+				 */
+				if (F_ISSET(r, WT_SKIP_UPDATE_LAS))
+					WT_TRET(__rec_las_remove(session, bnd));
 				WT_TRET(bm->free(bm, session,
 				    bnd->addr.addr, bnd->addr.size));
 				__wt_free(session, bnd->addr.addr);
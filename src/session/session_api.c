@@ -100,10 +100,12 @@ __session_close(WT_SESSION *wt_session, const char *config)
 
 	/*
 	 * Also release any pinned transaction ID from a non-transactional
-	 * operation.
+	 * operation, and remove the session from the bitmap of writers.
 	 */
-	if (conn->txn_global.states != NULL)
+	if (conn->txn_global.states != NULL) {
 		__wt_txn_release_snapshot(session);
+		__wt_txn_writer_set(session, 0);
+	}
 
 	/* Close all open cursors. */
 	while ((cursor = TAILQ_FIRST(&session->cursors)) != NULL) {
@@ -775,15 +777,39 @@ err:	API_END_RET(session, ret);
 static int
 __session_commit_transaction(WT_SESSION *wt_session, const char *config)
 {
+	WT_CONFIG_ITEM cval;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	WT_TXN *txn;
+	int unfinished;
 
 	session = (WT_SESSION_IMPL *)wt_session;
+	txn = &session->txn;
+	unfinished = 0;
 	SESSION_API_CALL(session, commit_transaction, config, cfg);
+
+	/* Finishing a unit of a group transaction doesn't commit anything. */
+	WT_ERR(__wt_config_gets_def(session, cfg, "unit", 0, &cval));
+	if (cval.val != 0) {
+		ret = __wt_txn_unit_commit(session);
+		goto err;
+	}
+
+	/*
+	 * A group transaction can't commit while its current unit has changes
+	 * or a failed operation: the application must decide whether the unit
+	 * commits.  Refusing the commit doesn't fail the transaction, unless
+	 * an operation in the unit already did.
+	 */
+	if (F_ISSET(txn, TXN_GROUP) && (F_ISSET(txn, TXN_ERROR) ||
+	    txn->mod_count != txn->unit_mod_count)) {
+		unfinished = !F_ISSET(txn, TXN_ERROR);
+		WT_ERR_MSG(session, EINVAL,
+		    "group transaction has an unfinished unit");
+	}
+
 	WT_STAT_FAST_CONN_INCR(session, txn_commit);
 
-	txn = &session->txn;
 	if (F_ISSET(txn, TXN_ERROR)) {
 		__wt_errx(session, "failed transaction requires rollback");
 		ret = EINVAL;
@@ -796,7 +822,10 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
 		WT_TRET(__wt_txn_rollback(session, cfg));
 	}
 
-err:	API_END_RET(session, ret);
+err:	API_END(session, ret);
+	if (unfinished)
+		F_CLR(txn, TXN_ERROR);
+	return (ret);
 }
 
 /*
@@ -806,16 +835,23 @@ err:	API_END_RET(session, ret);
 static int
 __session_rollback_transaction(WT_SESSION *wt_session, const char *config)
 {
+	WT_CONFIG_ITEM cval;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 
 	session = (WT_SESSION_IMPL *)wt_session;
 	SESSION_API_CALL(session, rollback_transaction, config, cfg);
-	WT_STAT_FAST_CONN_INCR(session, txn_rollback);
+
+	WT_ERR(__wt_config_gets_def(session, cfg, "unit", 0, &cval));
+	if (cval.val == 0)
+		WT_STAT_FAST_CONN_INCR(session, txn_rollback);
 
 	WT_TRET(__wt_session_reset_cursors(session));
 
-	WT_TRET(__wt_txn_rollback(session, cfg));
+	if (cval.val != 0)
+		WT_TRET(__wt_txn_unit_rollback(session));
+	else
+		WT_TRET(__wt_txn_rollback(session, cfg));
 
 err:	API_END_RET(session, ret);
 }
@@ -852,6 +888,40 @@ __session_transaction_pinned_range(WT_SESSION *wt_session, uint64_t *prange)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __session_snapshot --
+ *	WT_SESSION->snapshot method.
+ */
+static int
+__session_snapshot(WT_SESSION *wt_session, const char *config)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	WT_TXN_GLOBAL *txn_global;
+	int has_create, has_drops;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	txn_global = &S2C(session)->txn_global;
+
+	SESSION_API_CALL(session, snapshot, config, cfg);
+
+	WT_ERR(__wt_txn_named_snapshot_config(
+	    session, cfg, &has_create, &has_drops));
+
+	/* Serialize changes to the named snapshots. */
+	WT_ERR(__wt_writelock(session, txn_global->nsnap_rwlock));
+
+	/* Drop any snapshots first, then create the new snapshot. */
+	if (has_drops)
+		ret = __wt_txn_named_snapshot_drop(session, cfg);
+	if (ret == 0 && has_create)
+		ret = __wt_txn_named_snapshot_begin(session, cfg);
+
+	WT_TRET(__wt_writeunlock(session, txn_global->nsnap_rwlock));
+
+err:	API_END_RET_NOTFOUND_MAP(session, ret);
+}
+
 /*
  * __session_checkpoint --
  *	WT_SESSION->checkpoint method.
@@ -1015,7 +1085,8 @@ __wt_open_session(WT_CONNECTION_IMPL *conn,
 		__session_commit_transaction,
 		__session_rollback_transaction,
 		__session_checkpoint,
-		__session_transaction_pinned_range
+		__session_transaction_pinned_range,
+		__session_snapshot
 	};
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session, *session_ret;
@@ -59,7 +59,11 @@ __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 	    "cache: overflow values cached in memory";
 	stats->cache_eviction_deepen.desc =
 	    "cache: page split during eviction deepened the tree";
+	stats->cache_write_lookaside.desc =
+	    "cache: page written requiring lookaside records";
 	stats->cache_read.desc = "cache: pages read into cache";
+	stats->cache_read_lookaside.desc =
+	    "cache: pages read into cache requiring lookaside entries";
 	stats->cache_eviction_split.desc =
 	    "cache: pages split during eviction";
 	stats->cache_write.desc = "cache: pages written from cache";
@@ -81,11 +85,14 @@ __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 	stats->cursor_create.desc = "cursor: create calls";
 	stats->cursor_insert_bytes.desc =
 	    "cursor: cursor-insert key and value bytes inserted";
+	stats->cursor_modify_bytes.desc =
+	    "cursor: cursor-modify packed modification bytes";
 	stats->cursor_remove_bytes.desc =
 	    "cursor: cursor-remove key bytes removed";
 	stats->cursor_update_bytes.desc =
 	    "cursor: cursor-update value bytes updated";
 	stats->cursor_insert.desc = "cursor: insert calls";
+	stats->cursor_modify.desc = "cursor: modify calls";
 	stats->cursor_next.desc = "cursor: next calls";
 	stats->cursor_prev.desc = "cursor: prev calls";
 	stats->cursor_remove.desc = "cursor: remove calls";
@@ -96,20 +103,44 @@ __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 	stats->bloom_false_positive.desc = "LSM: bloom filter false positives";
 	stats->bloom_hit.desc = "LSM: bloom filter hits";
 	stats->bloom_miss.desc = "LSM: bloom filter misses";
+	stats->bloom_prefix_miss.desc =
+	    "LSM: bloom filter misses for key prefixes";
 	stats->bloom_page_evict.desc =
 	    "LSM: bloom filter pages evicted from cache";
 	stats->bloom_page_read.desc =
 	    "LSM: bloom filter pages read into cache";
+	stats->bloom_flush.desc =
+	    "LSM: bloom filters created while flushing chunks";
 	stats->bloom_count.desc = "LSM: bloom filters in the LSM tree";
+	stats->lsm_amplification_write.desc =
+	    "LSM: bytes flushed and merged as a percentage of bytes flushed (write amplification)";
+	stats->lsm_bytes_flushed.desc = "LSM: bytes written flushing chunks";
+	stats->lsm_bytes_merged.desc = "LSM: bytes written merging chunks";
+	stats->lsm_amplification_space.desc =
+	    "LSM: chunk size as a percentage of the deepest level (space amplification)";
+	stats->lsm_amplification_read.desc =
+	    "LSM: chunks a query may search (read amplification)";
+	stats->lsm_backlog_predicted.desc =
+	    "LSM: chunks expected to be waiting to be flushed or merged";
 	stats->lsm_chunk_count.desc = "LSM: chunks in the LSM tree";
+	stats->lsm_merge_moved.desc =
+	    "LSM: chunks moved to the next level without merging";
+	stats->lsm_lookup_key_range.desc =
+	    "LSM: chunks skipped by queries outside the chunk key range";
 	stats->lsm_generation_max.desc =
 	    "LSM: highest merge generation in the LSM tree";
+	stats->lsm_work_queue_wait_max.desc =
+	    "LSM: longest time a tree maintenance operation waited in a queue (usecs)";
+	stats->lsm_throttle_delay.desc =
+	    "LSM: LSM write throttle delay per update (nsecs)";
 	stats->lsm_lookup_no_bloom.desc =
 	    "LSM: queries that could have benefited from a Bloom filter that did not exist";
-	stats->lsm_checkpoint_throttle.desc =
-	    "LSM: sleep for LSM checkpoint throttle";
-	stats->lsm_merge_throttle.desc = "LSM: sleep for LSM merge throttle";
+	stats->lsm_throttle.desc = "LSM: sleep for LSM write throttle (usecs)";
+	stats->lsm_work_queue_wait.desc =
+	    "LSM: time tree maintenance operations waited in a queue (usecs)";
 	stats->bloom_size.desc = "LSM: total size of bloom filters";
+	stats->lsm_work_units_done.desc =
+	    "LSM: tree maintenance operations executed";
 	stats->rec_dictionary.desc = "reconciliation: dictionary matches";
 	stats->rec_suffix_compression.desc =
 	    "reconciliation: internal page key bytes discarded using suffix compression";
@@ -180,7 +211,9 @@ __wt_stat_refresh_dsrc_stats(void *stats_arg)
 	stats->cache_read_overflow.v = 0;
 	stats->cache_overflow_value.v = 0;
 	stats->cache_eviction_deepen.v = 0;
+	stats->cache_write_lookaside.v = 0;
 	stats->cache_read.v = 0;
+	stats->cache_read_lookaside.v = 0;
 	stats->cache_eviction_split.v = 0;
 	stats->cache_write.v = 0;
 	stats->cache_eviction_clean.v = 0;
@@ -194,9 +227,11 @@ __wt_stat_refresh_dsrc_stats(void *stats_arg)
 	stats->cursor_insert_bulk.v = 0;
 	stats->cursor_create.v = 0;
 	stats->cursor_insert_bytes.v = 0;
+	stats->cursor_modify_bytes.v = 0;
 	stats->cursor_remove_bytes.v = 0;
 	stats->cursor_update_bytes.v = 0;
 	stats->cursor_insert.v = 0;
+	stats->cursor_modify.v = 0;
 	stats->cursor_next.v = 0;
 	stats->cursor_prev.v = 0;
 	stats->cursor_remove.v = 0;
@@ -207,15 +242,23 @@ __wt_stat_refresh_dsrc_stats(void *stats_arg)
 	stats->bloom_false_positive.v = 0;
 	stats->bloom_hit.v = 0;
 	stats->bloom_miss.v = 0;
+	stats->bloom_prefix_miss.v = 0;
 	stats->bloom_page_evict.v = 0;
 	stats->bloom_page_read.v = 0;
+	stats->bloom_flush.v = 0;
 	stats->bloom_count.v = 0;
+	stats->lsm_bytes_flushed.v = 0;
+	stats->lsm_bytes_merged.v = 0;
 	stats->lsm_chunk_count.v = 0;
+	stats->lsm_merge_moved.v = 0;
+	stats->lsm_lookup_key_range.v = 0;
 	stats->lsm_generation_max.v = 0;
+	stats->lsm_work_queue_wait_max.v = 0;
 	stats->lsm_lookup_no_bloom.v = 0;
-	stats->lsm_checkpoint_throttle.v = 0;
-	stats->lsm_merge_throttle.v = 0;
+	stats->lsm_throttle.v = 0;
+	stats->lsm_work_queue_wait.v = 0;
 	stats->bloom_size.v = 0;
+	stats->lsm_work_units_done.v = 0;
 	stats->rec_dictionary.v = 0;
 	stats->rec_suffix_compression.v = 0;
 	stats->rec_multiblock_internal.v = 0;
@@ -268,7 +311,9 @@ __wt_stat_aggregate_dsrc_stats(const void *child, const void *parent)
 	p->cache_read_overflow.v += c->cache_read_overflow.v;
 	p->cache_overflow_value.v += c->cache_overflow_value.v;
 	p->cache_eviction_deepen.v += c->cache_eviction_deepen.v;
+	p->cache_write_lookaside.v += c->cache_write_lookaside.v;
 	p->cache_read.v += c->cache_read.v;
+	p->cache_read_lookaside.v += c->cache_read_lookaside.v;
 	p->cache_eviction_split.v += c->cache_eviction_split.v;
 	p->cache_write.v += c->cache_write.v;
 	p->cache_eviction_clean.v += c->cache_eviction_clean.v;
@@ -282,9 +327,11 @@ __wt_stat_aggregate_dsrc_stats(const void *child, const void *parent)
 	p->cursor_insert_bulk.v += c->cursor_insert_bulk.v;
 	p->cursor_create.v += c->cursor_create.v;
 	p->cursor_insert_bytes.v += c->cursor_insert_bytes.v;
+	p->cursor_modify_bytes.v += c->cursor_modify_bytes.v;
 	p->cursor_remove_bytes.v += c->cursor_remove_bytes.v;
 	p->cursor_update_bytes.v += c->cursor_update_bytes.v;
 	p->cursor_insert.v += c->cursor_insert.v;
+	p->cursor_modify.v += c->cursor_modify.v;
 	p->cursor_next.v += c->cursor_next.v;
 	p->cursor_prev.v += c->cursor_prev.v;
 	p->cursor_remove.v += c->cursor_remove.v;
@@ -295,15 +342,24 @@ __wt_stat_aggregate_dsrc_stats(const void *child, const void *parent)
 	p->bloom_false_positive.v += c->bloom_false_positive.v;
 	p->bloom_hit.v += c->bloom_hit.v;
 	p->bloom_miss.v += c->bloom_miss.v;
+	p->bloom_prefix_miss.v += c->bloom_prefix_miss.v;
 	p->bloom_page_evict.v += c->bloom_page_evict.v;
 	p->bloom_page_read.v += c->bloom_page_read.v;
+	p->bloom_flush.v += c->bloom_flush.v;
 	p->bloom_count.v += c->bloom_count.v;
+	p->lsm_bytes_flushed.v += c->lsm_bytes_flushed.v;
+	p->lsm_bytes_merged.v += c->lsm_bytes_merged.v;
+	p->lsm_merge_moved.v += c->lsm_merge_moved.v;
+	p->lsm_lookup_key_range.v += c->lsm_lookup_key_range.v;
 	if (c->lsm_generation_max.v > p->lsm_generation_max.v)
 	    p->lsm_generation_max.v = c->lsm_generation_max.v;
+	if (c->lsm_work_queue_wait_max.v > p->lsm_work_queue_wait_max.v)
+	    p->lsm_work_queue_wait_max.v = c->lsm_work_queue_wait_max.v;
 	p->lsm_lookup_no_bloom.v += c->lsm_lookup_no_bloom.v;
-	p->lsm_checkpoint_throttle.v += c->lsm_checkpoint_throttle.v;
-	p->lsm_merge_throttle.v += c->lsm_merge_throttle.v;
+	p->lsm_throttle.v += c->lsm_throttle.v;
+	p->lsm_work_queue_wait.v += c->lsm_work_queue_wait.v;
 	p->bloom_size.v += c->bloom_size.v;
+	p->lsm_work_units_done.v += c->lsm_work_units_done.v;
 	p->rec_dictionary.v += c->rec_dictionary.v;
 	p->rec_suffix_compression.v += c->rec_suffix_compression.v;
 	p->rec_multiblock_internal.v += c->rec_multiblock_internal.v;
@@ -353,7 +409,11 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->block_byte_write.desc = "block-manager: bytes written";
 	stats->block_map_read.desc = "block-manager: mapped blocks read";
 	stats->block_byte_map_read.desc = "block-manager: mapped bytes read";
+	stats->cache_arena_alloc.desc =
+	    "cache: bytes allocated for page arenas";
 	stats->cache_bytes_inuse.desc = "cache: bytes currently in the cache";
+	stats->cache_bytes_bloom.desc =
+	    "cache: bytes in bloom filters loaded into memory";
 	stats->cache_bytes_read.desc = "cache: bytes read into cache";
 	stats->cache_bytes_write.desc = "cache: bytes written from cache";
 	stats->cache_eviction_checkpoint.desc =
@@ -376,12 +436,20 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "cache: hazard pointer blocked page eviction";
 	stats->cache_inmem_split.desc = "cache: in-memory page splits";
 	stats->cache_eviction_internal.desc = "cache: internal pages evicted";
+	stats->cache_lookaside_cursor_wait.desc =
+	    "cache: lookaside table cursor wait calls";
+	stats->cache_lookaside_insert.desc =
+	    "cache: lookaside table insert calls";
+	stats->cache_lookaside_remove.desc =
+	    "cache: lookaside table remove calls";
 	stats->cache_bytes_max.desc = "cache: maximum bytes configured";
 	stats->cache_eviction_maximum_page_size.desc =
 	    "cache: maximum page size at eviction";
 	stats->cache_eviction_dirty.desc = "cache: modified pages evicted";
 	stats->cache_eviction_deepen.desc =
 	    "cache: page split during eviction deepened the tree";
+	stats->cache_write_lookaside.desc =
+	    "cache: page written requiring lookaside records";
 	stats->cache_pages_inuse.desc =
 	    "cache: pages currently held in the cache";
 	stats->cache_eviction_force.desc =
@@ -391,6 +459,8 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->cache_eviction_app.desc =
 	    "cache: pages evicted by application threads";
 	stats->cache_read.desc = "cache: pages read into cache";
+	stats->cache_read_lookaside.desc =
+	    "cache: pages read into cache requiring lookaside entries";
 	stats->cache_eviction_fail.desc =
 	    "cache: pages selected for eviction unable to be evicted";
 	stats->cache_eviction_split.desc =
@@ -417,6 +487,9 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->write_io.desc = "connection: total write I/Os";
 	stats->cursor_create.desc = "cursor: cursor create calls";
 	stats->cursor_insert.desc = "cursor: cursor insert calls";
+	stats->cursor_modify.desc = "cursor: cursor modify calls";
+	stats->cursor_modify_delta.desc =
+	    "cursor: cursor modify calls stored as modifications";
 	stats->cursor_next.desc = "cursor: cursor next calls";
 	stats->cursor_prev.desc = "cursor: cursor prev calls";
 	stats->cursor_remove.desc = "cursor: cursor remove calls";
@@ -431,13 +504,26 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->dh_conn_tod.desc = "data-handle: connection time-of-death sets";
 	stats->dh_session_handles.desc = "data-handle: session dhandles swept";
 	stats->dh_session_sweeps.desc = "data-handle: session sweep attempts";
+	stats->log_prealloc_recycled.desc = "log: archived log files recycled";
 	stats->log_slot_closes.desc = "log: consolidated slot closures";
 	stats->log_slot_races.desc = "log: consolidated slot join races";
 	stats->log_slot_transitions.desc =
 	    "log: consolidated slot join transitions";
 	stats->log_slot_joins.desc = "log: consolidated slot joins";
+	stats->log_sync_commit_gt100.desc =
+	    "log: durable commit latency histogram: 100ms or more";
+	stats->log_sync_commit_lt100.desc =
+	    "log: durable commit latency histogram: 10ms to 100ms";
+	stats->log_sync_commit_lt10.desc =
+	    "log: durable commit latency histogram: 1ms to 10ms";
+	stats->log_sync_commit_lt1.desc =
+	    "log: durable commit latency histogram: less than 1ms";
 	stats->log_slot_toosmall.desc =
 	    "log: failed to find a slot large enough for record";
+	stats->log_group_commit_delay_time.desc =
+	    "log: group commit time spent waiting for committers (usecs)";
+	stats->log_group_commit_delays.desc =
+	    "log: group commit waits for additional committers";
 	stats->log_buffer_grow.desc = "log: log buffer size increases";
 	stats->log_bytes_payload.desc = "log: log bytes of payload data";
 	stats->log_bytes_written.desc = "log: log bytes written";
@@ -476,12 +562,14 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "log: yields waiting for previous log file close";
 	stats->lsm_work_queue_app.desc =
 	    "LSM: application work units currently queued";
+	stats->lsm_bloom_blocks_disk.desc =
+	    "LSM: bloom filters read from disk, over the memory limit";
+	stats->lsm_merge_ranges_helped.desc =
+	    "LSM: merge key ranges merged by helper threads";
 	stats->lsm_work_queue_manager.desc =
 	    "LSM: merge work units currently queued";
 	stats->lsm_rows_merged.desc = "LSM: rows merged in an LSM tree";
-	stats->lsm_checkpoint_throttle.desc =
-	    "LSM: sleep for LSM checkpoint throttle";
-	stats->lsm_merge_throttle.desc = "LSM: sleep for LSM merge throttle";
+	stats->lsm_throttle.desc = "LSM: sleep for LSM write throttle (usecs)";
 	stats->lsm_work_queue_switch.desc =
 	    "LSM: switch work units currently queued";
 	stats->lsm_work_units_discarded.desc =
@@ -510,6 +598,19 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "thread-yield: page acquire read blocked";
 	stats->page_sleep.desc =
 	    "thread-yield: page acquire time sleeping (usecs)";
+	stats->txn_group_unit_commit.desc =
+	    "transaction: group transaction units committed";
+	stats->txn_group_unit_rollback.desc =
+	    "transaction: group transaction units rolled back";
+	stats->txn_snapshots_created.desc =
+	    "transaction: number of named snapshots created";
+	stats->txn_snapshots_dropped.desc =
+	    "transaction: number of named snapshots dropped";
+	stats->txn_prune_updates.desc = "transaction: obsolete updates pruned";
+	stats->txn_snapshot_rebuild.desc =
+	    "transaction: read-committed snapshots rebuilt";
+	stats->txn_snapshot_reuse.desc =
+	    "transaction: read-committed snapshots reused";
 	stats->txn_begin.desc = "transaction: transaction begins";
 	stats->txn_checkpoint_running.desc =
 	    "transaction: transaction checkpoint currently running";
@@ -517,17 +618,44 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "transaction: transaction checkpoint max time (msecs)";
 	stats->txn_checkpoint_time_min.desc =
 	    "transaction: transaction checkpoint min time (msecs)";
+	stats->txn_checkpoint_file_time_max.desc =
+	    "transaction: transaction checkpoint most recent file max time (msecs)";
+	stats->txn_checkpoint_file_time_total.desc =
+	    "transaction: transaction checkpoint most recent file total time (msecs)";
 	stats->txn_checkpoint_time_recent.desc =
 	    "transaction: transaction checkpoint most recent time (msecs)";
 	stats->txn_checkpoint_time_total.desc =
 	    "transaction: transaction checkpoint total time (msecs)";
+	stats->txn_checkpoint_write_rate.desc =
+	    "transaction: transaction checkpoint write rate (bytes per second)";
+	stats->txn_checkpoint_throttle_time.desc =
+	    "transaction: transaction checkpoint write throttle time (usecs)";
+	stats->txn_checkpoint_throttle.desc =
+	    "transaction: transaction checkpoint writes throttled";
 	stats->txn_checkpoint.desc = "transaction: transaction checkpoints";
 	stats->txn_fail_cache.desc =
 	    "transaction: transaction failures due to cache overflow";
 	stats->txn_pinned_range.desc =
 	    "transaction: transaction range of IDs currently pinned";
+	stats->txn_pinned_snapshot_range.desc =
+	    "transaction: transaction range of IDs currently pinned by named snapshots";
 	stats->txn_commit.desc = "transaction: transactions committed";
 	stats->txn_rollback.desc = "transaction: transactions rolled back";
+	stats->txn_prune_chain_max_after.desc =
+	    "transaction: update chain maximum length after the last pruning";
+	stats->txn_prune_chain_max_before.desc =
+	    "transaction: update chain maximum length before the last pruning";
+	stats->txn_prune_chain_after.desc =
+	    "transaction: update chain total length after pruning";
+	stats->txn_prune_chain_before.desc =
+	    "transaction: update chain total length before pruning";
+	stats->txn_prune_chains.desc = "transaction: update chains pruned";
+	stats->txn_prune_chain_long.desc =
+	    "transaction: update chains still at the prune length after pruning";
+	stats->txn_update_conflict.desc = "transaction: update conflicts";
+	stats->txn_prune_pages.desc =
+	    "transaction: update prune pages visited";
+	stats->txn_prune_passes.desc = "transaction: update prune passes";
 }
 
 void
@@ -556,6 +684,7 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->block_byte_write.v = 0;
 	stats->block_map_read.v = 0;
 	stats->block_byte_map_read.v = 0;
+	stats->cache_arena_alloc.v = 0;
 	stats->cache_bytes_read.v = 0;
 	stats->cache_bytes_write.v = 0;
 	stats->cache_eviction_checkpoint.v = 0;
@@ -569,13 +698,18 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->cache_eviction_hazard.v = 0;
 	stats->cache_inmem_split.v = 0;
 	stats->cache_eviction_internal.v = 0;
+	stats->cache_lookaside_cursor_wait.v = 0;
+	stats->cache_lookaside_insert.v = 0;
+	stats->cache_lookaside_remove.v = 0;
 	stats->cache_eviction_maximum_page_size.v = 0;
 	stats->cache_eviction_dirty.v = 0;
 	stats->cache_eviction_deepen.v = 0;
+	stats->cache_write_lookaside.v = 0;
 	stats->cache_eviction_force.v = 0;
 	stats->cache_eviction_force_delete.v = 0;
 	stats->cache_eviction_app.v = 0;
 	stats->cache_read.v = 0;
+	stats->cache_read_lookaside.v = 0;
 	stats->cache_eviction_fail.v = 0;
 	stats->cache_eviction_split.v = 0;
 	stats->cache_eviction_walk.v = 0;
@@ -593,6 +727,8 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->write_io.v = 0;
 	stats->cursor_create.v = 0;
 	stats->cursor_insert.v = 0;
+	stats->cursor_modify.v = 0;
+	stats->cursor_modify_delta.v = 0;
 	stats->cursor_next.v = 0;
 	stats->cursor_prev.v = 0;
 	stats->cursor_remove.v = 0;
@@ -606,11 +742,18 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->dh_conn_tod.v = 0;
 	stats->dh_session_handles.v = 0;
 	stats->dh_session_sweeps.v = 0;
+	stats->log_prealloc_recycled.v = 0;
 	stats->log_slot_closes.v = 0;
 	stats->log_slot_races.v = 0;
 	stats->log_slot_transitions.v = 0;
 	stats->log_slot_joins.v = 0;
+	stats->log_sync_commit_gt100.v = 0;
+	stats->log_sync_commit_lt100.v = 0;
+	stats->log_sync_commit_lt10.v = 0;
+	stats->log_sync_commit_lt1.v = 0;
 	stats->log_slot_toosmall.v = 0;
+	stats->log_group_commit_delay_time.v = 0;
+	stats->log_group_commit_delays.v = 0;
 	stats->log_buffer_grow.v = 0;
 	stats->log_bytes_payload.v = 0;
 	stats->log_bytes_written.v = 0;
@@ -635,9 +778,10 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->log_compress_mem.v = 0;
 	stats->log_compress_len.v = 0;
 	stats->log_close_yields.v = 0;
+	stats->lsm_bloom_blocks_disk.v = 0;
+	stats->lsm_merge_ranges_helped.v = 0;
 	stats->lsm_rows_merged.v = 0;
-	stats->lsm_checkpoint_throttle.v = 0;
-	stats->lsm_merge_throttle.v = 0;
+	stats->lsm_throttle.v = 0;
 	stats->lsm_work_units_discarded.v = 0;
 	stats->lsm_work_units_done.v = 0;
 	stats->lsm_work_units_created.v = 0;
@@ -649,9 +793,27 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->page_locked_blocked.v = 0;
 	stats->page_read_blocked.v = 0;
 	stats->page_sleep.v = 0;
+	stats->txn_group_unit_commit.v = 0;
+	stats->txn_group_unit_rollback.v = 0;
+	stats->txn_snapshots_created.v = 0;
+	stats->txn_snapshots_dropped.v = 0;
+	stats->txn_prune_updates.v = 0;
+	stats->txn_snapshot_rebuild.v = 0;
+	stats->txn_snapshot_reuse.v = 0;
 	stats->txn_begin.v = 0;
+	stats->txn_checkpoint_throttle_time.v = 0;
+	stats->txn_checkpoint_throttle.v = 0;
 	stats->txn_checkpoint.v = 0;
 	stats->txn_fail_cache.v = 0;
 	stats->txn_commit.v = 0;
 	stats->txn_rollback.v = 0;
+	stats->txn_prune_chain_max_after.v = 0;
+	stats->txn_prune_chain_max_before.v = 0;
+	stats->txn_prune_chain_after.v = 0;
+	stats->txn_prune_chain_before.v = 0;
+	stats->txn_prune_chains.v = 0;
+	stats->txn_prune_chain_long.v = 0;
+	stats->txn_update_conflict.v = 0;
+	stats->txn_prune_pages.v = 0;
+	stats->txn_prune_passes.v = 0;
 }
@@ -87,6 +87,63 @@ __wt_txn_update_oldest(WT_SESSION_IMPL *session)
 	__wt_txn_refresh(session, 0);
 }
 
+/*
+ * __txn_snap_min_valid --
+ *	Check a snap_min the session has published can't be missed by a thread
+ * moving the oldest ID forwards, and the oldest ID hasn't moved past it.
+ */
+static inline int
+__txn_snap_min_valid(WT_TXN_GLOBAL *txn_global, uint64_t snap_min)
+{
+	/*
+	 * The caller published its snap_min followed by a full barrier.  A
+	 * thread moving the oldest ID sets the scan count before reading the
+	 * sessions' snap_min values, and sets the oldest ID before clearing
+	 * the scan count: if the scan count is clear, either that thread will
+	 * see our snap_min, or it's finished and we'll see the new oldest ID.
+	 */
+	if (txn_global->scan_count != 0)
+		return (0);
+	WT_READ_BARRIER();
+	return (TXNID_LE(txn_global->oldest_id, snap_min));
+}
+
+/*
+ * __txn_snapshot_reuse --
+ *	Re-publish the session's previous snapshot if no transaction has
+ * committed since it was taken.
+ */
+static int
+__txn_snapshot_reuse(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *txn_state;
+
+	txn = &session->txn;
+	txn_global = &S2C(session)->txn_global;
+	txn_state = &txn_global->states[session->id];
+
+	if (txn->snapshot_gen != txn_global->commit_gen)
+		return (0);
+
+	/*
+	 * Transactions in the snapshot may have rolled back, check the oldest
+	 * ID hasn't moved past the snapshot.  Publish the snapshot's minimum
+	 * ID first, the same as a full refresh, so the oldest ID can't move
+	 * past it once checked.  If the check fails, the full refresh that
+	 * follows replaces the published value.
+	 */
+	txn_state->snap_min = txn->snap_min;
+	WT_FULL_BARRIER();
+	if (!__txn_snap_min_valid(txn_global, txn->snap_min) ||
+	    txn->snapshot_gen != txn_global->commit_gen)
+		return (0);
+
+	F_SET(txn, TXN_HAS_SNAPSHOT);
+	return (1);
+}
+
 /*
  * __wt_txn_refresh --
  *	Allocate a transaction ID and/or a snapshot.
@@ -98,16 +155,35 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 	WT_TXN *txn;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s, *txn_state;
-	uint64_t current_id, id, oldest_id;
+	uint64_t bits, commit_gen, current_id, id, oldest_id;
 	uint64_t prev_oldest_id, snap_min;
-	uint32_t i, n, oldest_session, session_cnt;
-	int32_t count;
+	uint32_t i, n, oldest_session, session_cnt, spins;
 
 	conn = S2C(session);
 	txn = &session->txn;
 	txn_global = &conn->txn_global;
 	txn_state = &txn_global->states[session->id];
 
+	/*
+	 * Read-committed operations take a new snapshot for each operation,
+	 * but if no transaction has committed since the session's previous
+	 * snapshot was taken, a new snapshot would see the same updates:
+	 * reuse it rather than scanning.
+	 */
+	if (get_snapshot && txn->isolation == TXN_ISO_READ_COMMITTED) {
+		if (__txn_snapshot_reuse(session)) {
+			WT_STAT_FAST_CONN_INCR(session, txn_snapshot_reuse);
+			return;
+		}
+		WT_STAT_FAST_CONN_INCR(session, txn_snapshot_rebuild);
+	}
+
+	/*
+	 * Read the commit generation before the snapshot: if a transaction
+	 * commits while we build it, the snapshot won't be reused.
+	 */
+	WT_ORDERED_READ(commit_gen, txn_global->commit_gen);
+
 	current_id = snap_min = txn_global->current;
 	prev_oldest_id = txn_global->oldest_id;
 
@@ -115,33 +191,79 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 	if (prev_oldest_id == current_id) {
 		if (get_snapshot) {
 			txn_state->snap_min = current_id;
+			WT_FULL_BARRIER();
 			__txn_sort_snapshot(session, 0, current_id);
+			txn->snapshot_gen = commit_gen;
 		}
 		/* Check that the oldest ID has not moved in the meantime. */
-		if (prev_oldest_id == txn_global->oldest_id &&
-		    txn_global->scan_count == 0)
+		if (__txn_snap_min_valid(txn_global, prev_oldest_id))
 			return;
 	}
 
 	/*
-	 * We're going to scan.  Increment the count of scanners to prevent the
-	 * oldest ID from moving forwards.  Spin if the count is negative,
-	 * which indicates that some thread is moving the oldest ID forwards.
+	 * We're going to scan.  Publish the oldest ID as a lower bound for our
+	 * snap_min to prevent the oldest ID from moving forwards: this doesn't
+	 * write any shared cache line, so threads taking snapshots don't
+	 * contend.  Spin if some thread is moving the oldest ID forwards, it
+	 * may not have seen the value we published.
+	 *
+	 * Threads only updating the oldest ID don't need the protection, they
+	 * check all of the sessions again with exclusive access.
 	 */
-	do {
-		if ((count = txn_global->scan_count) < 0)
+	if (get_snapshot)
+		for (;;) {
+			prev_oldest_id = txn_global->oldest_id;
+			txn_state->snap_min = prev_oldest_id;
+			WT_FULL_BARRIER();
+			if (__txn_snap_min_valid(txn_global, prev_oldest_id))
+				break;
 			WT_PAUSE();
-	} while (count < 0 ||
-	    !WT_ATOMIC_CAS4(txn_global->scan_count, count, count + 1));
+		}
+	else
+		prev_oldest_id = txn_global->oldest_id;
 
-	/* The oldest ID cannot change until the scan count goes to zero. */
-	prev_oldest_id = txn_global->oldest_id;
-	current_id = oldest_id = snap_min = txn_global->current;
+	/*
+	 * Read the current ID before the bitmap of writers: sessions allocating
+	 * IDs are added to the bitmap before the global counter moves past
+	 * their ID.
+	 */
+	WT_ORDERED_READ(current_id, txn_global->current);
+	oldest_id = snap_min = current_id;
 	oldest_session = 0;
 
-	/* Walk the array of concurrent transactions. */
+	/*
+	 * Walk the sessions that have allocated transaction IDs: the cost of
+	 * taking a snapshot depends on the number of writers, not on the
+	 * number of sessions.  Idle writers publish WT_TXN_NONE.
+	 */
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = n = 0, s = txn_global->states; i < session_cnt; i++, s++) {
+	for (bits = 0, i = n = 0; i < session_cnt; i++) {
+		/* Skip words of the bitmap without writers. */
+		if (i % 64 == 0 && (bits = txn_global->writers[i / 64]) == 0) {
+			i += 63;
+			continue;
+		}
+		if ((bits & WT_TXN_WRITER_BIT(i)) == 0)
+			continue;
+		s = &txn_global->states[i];
+
+		/*
+		 * If the session is allocating an ID, wait for it to publish
+		 * the ID, we may have seen the lower bound it publishes first.
+		 * Check the ID didn't change as we checked the flag.  The
+		 * window is a few instructions, but the allocating thread can
+		 * be descheduled inside it: spin for a while, then yield.
+		 */
+		for (spins = 0;; spins++) {
+			WT_ORDERED_READ(id, s->id);
+			if (!s->allocating && id == s->id)
+				break;
+			if (spins < WT_TXN_ALLOC_SPINS)
+				WT_PAUSE();
+			else
+				__wt_yield();
+		}
+
 		/*
 		 * Build our snapshot of any concurrent transaction IDs.
 		 *
@@ -153,7 +275,7 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 		 * keep spinning until it gets a valid one.
 		 */
 		if (s != txn_state &&
-		    (id = s->id) != WT_TXN_NONE &&
+		    id != WT_TXN_NONE &&
 		    TXNID_LE(prev_oldest_id, id)) {
 			if (get_snapshot)
 				txn->snapshot[n++] = id;
@@ -162,19 +284,15 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 		}
 
 		/*
-		 * Ignore the session's own snap_min: we are about to update
-		 * it.
+		 * Ignore the session's own snap_min: it's the lower bound we
+		 * published, we are about to update it.
 		 */
 		if (get_snapshot && s == txn_state)
 			continue;
 
 		/*
-		 * !!!
-		 * Note: Don't ignore snap_min values older than the previous
-		 * oldest ID.  Read-uncommitted operations publish snap_min
-		 * values without incrementing scan_count to protect the global
-		 * table.  See the comment in __wt_txn_cursor_op for
-		 * more details.
+		 * Track the oldest snap_min of the writers; the snap_min values
+		 * of readers are only checked when moving the oldest ID.
 		 */
 		if ((id = s->snap_min) != WT_TXN_NONE &&
 		    TXNID_LT(id, oldest_id)) {
@@ -187,6 +305,9 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 		oldest_id = snap_min;
 	if (txn->id != WT_TXN_NONE && TXNID_LT(txn->id, oldest_id))
 		oldest_id = txn->id;
+	if ((id = txn_global->nsnap_oldest_id) != WT_TXN_NONE &&
+	    TXNID_LT(id, oldest_id))
+		oldest_id = id;
 
 	/*
 	 * If we got a new snapshot, update the published snap_min for this
@@ -195,7 +316,7 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 	if (get_snapshot) {
 		WT_ASSERT(session, TXNID_LE(prev_oldest_id, snap_min));
 		WT_ASSERT(session, prev_oldest_id == txn_global->oldest_id);
-		txn_state->snap_min = snap_min;
+		WT_PUBLISH(txn_state->snap_min, snap_min);
 	}
 
 	/*
@@ -212,8 +333,20 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 	 * make sure nobody else is using an earlier ID.
 	 */
 	if (TXNID_LT(prev_oldest_id, oldest_id) &&
-	    (!get_snapshot || oldest_id - prev_oldest_id > 100) &&
-	    WT_ATOMIC_CAS4(txn_global->scan_count, 1, -1)) {
+	    (!get_snapshot || (oldest_id - prev_oldest_id > 100 &&
+	    current_id - txn_global->oldest_scan_id > 100)) &&
+	    WT_ATOMIC_CAS4(txn_global->scan_count, 0, -1)) {
+		/*
+		 * The oldest ID found so far ignores readers, check all of the
+		 * sessions.  Don't ignore snap_min values older than the
+		 * previous oldest ID.  Read-uncommitted operations publish
+		 * snap_min values without checking the scan count to protect
+		 * the global table.  See the comment in __wt_txn_cursor_op for
+		 * more details.  Only repeat the check during snapshot refresh
+		 * once more transactions have started, so a long-running reader
+		 * doesn't cause every snapshot to scan all sessions.
+		 */
+		txn_global->oldest_scan_id = current_id;
 		WT_ORDERED_READ(session_cnt, conn->session_cnt);
 		for (i = 0, s = txn_global->states; i < session_cnt; i++, s++) {
 			if ((id = s->id) != WT_TXN_NONE &&
@@ -223,9 +356,20 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 			    TXNID_LT(id, oldest_id))
 				oldest_id = id;
 		}
+
+		/*
+		 * Check the named snapshots again after the sessions: a session
+		 * creating a named snapshot publishes it before releasing its
+		 * own snap_min, and one beginning a transaction from a named
+		 * snapshot publishes its snap_min before the named snapshot
+		 * can be dropped.
+		 */
+		WT_ORDERED_READ(id, txn_global->nsnap_oldest_id);
+		if (id != WT_TXN_NONE && TXNID_LT(id, oldest_id))
+			oldest_id = id;
 		if (TXNID_LT(txn_global->oldest_id, oldest_id))
 			txn_global->oldest_id = oldest_id;
-		txn_global->scan_count = 0;
+		WT_PUBLISH(txn_global->scan_count, 0);
 	} else {
 		if (WT_VERBOSE_ISSET(session, WT_VERB_TRANSACTION) &&
 		    current_id - oldest_id > 10000 &&
@@ -239,12 +383,12 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 			    conn->sessions[oldest_session].txn.snap_min);
 			txn_global->oldest_session = oldest_session;
 		}
-		WT_ASSERT(session, txn_global->scan_count > 0);
-		(void)WT_ATOMIC_SUB4(txn_global->scan_count, 1);
 	}
 
-	if (get_snapshot)
+	if (get_snapshot) {
 		__txn_sort_snapshot(session, n, current_id);
+		txn->snapshot_gen = commit_gen;
+	}
 }
 
 /*
@@ -255,6 +399,7 @@ int
 __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
 	WT_TXN *txn;
 
 	txn = &session->txn;
@@ -284,11 +429,30 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 	if (!cval.val)
 		txn->txn_logsync = 0;
 
+	/* Group transactions are committed or rolled back in units. */
+	WT_RET(__wt_config_gets_def(session, cfg, "group", 0, &cval));
+	if (cval.val != 0) {
+		F_SET(txn, TXN_GROUP);
+		txn->unit_mod_count = 0;
+		txn->unit_logrec_size = 0;
+	}
+
+	/* Transactions using a named snapshot run at snapshot isolation. */
+	WT_RET(__wt_config_gets_def(session, cfg, "snapshot", 0, &cval));
+	if (cval.len != 0)
+		txn->isolation = TXN_ISO_SNAPSHOT;
+
 	F_SET(txn, TXN_RUNNING);
 	if (txn->isolation == TXN_ISO_SNAPSHOT) {
 		if (session->ncursors > 0)
 			WT_RET(__wt_session_copy_values(session));
-		__wt_txn_refresh(session, 1);
+		if (cval.len == 0)
+			__wt_txn_refresh(session, 1);
+		else if ((ret =
+		    __wt_txn_named_snapshot_get(session, &cval)) != 0) {
+			F_CLR(txn, TXN_RUNNING);
+			return (ret);
+		}
 	}
 	return (0);
 }
@@ -311,7 +475,12 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 	txn_global = &S2C(session)->txn_global;
 	txn_state = &txn_global->states[session->id];
 
-	/* Clear the transaction's ID from the global table. */
+	/*
+	 * Clear the transaction's ID from the global table.  The session stays
+	 * in the bitmap of writers: the published ID says whether it's running
+	 * a transaction, and leaving the bit set saves the next transaction in
+	 * the session an atomic update of a shared word.
+	 */
 	if (F_ISSET(txn, TXN_HAS_ID)) {
 		WT_ASSERT(session, txn_state->id != WT_TXN_NONE &&
 		    txn->id != WT_TXN_NONE);
@@ -332,7 +501,8 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 	 */
 	__wt_txn_release_snapshot(session);
 	txn->isolation = session->isolation;
-	F_CLR(txn, TXN_ERROR | TXN_HAS_ID | TXN_RUNNING);
+	F_CLR(txn, TXN_ERROR |
+	    TXN_GROUP | TXN_HAS_ID | TXN_RUNNING | TXN_UPDATE_CONFLICT);
 }
 
 /*
@@ -346,6 +516,7 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_TXN *txn;
 	WT_TXN_OP *op;
 	u_int i;
+	int did_write;
 
 	txn = &session->txn;
 	WT_ASSERT(session, !F_ISSET(txn, TXN_ERROR));
@@ -395,7 +566,104 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	if (session->ncursors > 0)
 		WT_RET(__wt_session_copy_values(session));
 
+	did_write = F_ISSET(txn, TXN_HAS_ID) ? 1 : 0;
 	__wt_txn_release(session);
+
+	/*
+	 * Once our ID is cleared from the global table, our updates are visible
+	 * to new snapshots: snapshots taken before now can no longer be reused.
+	 */
+	if (did_write)
+		(void)WT_ATOMIC_ADD8(S2C(session)->txn_global.commit_gen, 1);
+	return (0);
+}
+
+/*
+ * __txn_op_rollback --
+ *	Roll back a transactional operation and free its memory.
+ */
+static void
+__txn_op_rollback(WT_SESSION_IMPL *session, WT_TXN_OP *op)
+{
+	/* Metadata updates are never rolled back. */
+	if (op->fileid == WT_METAFILE_ID)
+		return;
+
+	switch (op->type) {
+	case TXN_OP_BASIC:
+	case TXN_OP_INMEM:
+		op->u.upd->txnid = WT_TXN_ABORTED;
+		break;
+	case TXN_OP_REF:
+		__wt_delete_page_rollback(session, op->u.ref);
+		break;
+	case TXN_OP_TRUNCATE_COL:
+	case TXN_OP_TRUNCATE_ROW:
+		/*
+		 * Nothing to do: these operations are only logged for
+		 * recovery.  The in-memory changes will be rolled back with a
+		 * combination of TXN_OP_REF and TXN_OP_INMEM operations.
+		 */
+		break;
+	}
+
+	/* Free any memory allocated for the operation. */
+	__wt_txn_op_free(session, op);
+}
+
+/*
+ * __wt_txn_unit_commit --
+ *	Finish the current unit of a group transaction: its changes commit
+ * with the group.
+ */
+int
+__wt_txn_unit_commit(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+	if (!F_ISSET(txn, TXN_GROUP))
+		WT_RET_MSG(session, EINVAL, "No group transaction is active");
+	if (F_ISSET(txn, TXN_ERROR))
+		WT_RET_MSG(session, EINVAL, "failed unit requires rollback");
+
+	txn->unit_mod_count = txn->mod_count;
+	txn->unit_logrec_size = txn->logrec == NULL ? 0 : txn->logrec->size;
+	WT_STAT_FAST_CONN_INCR(session, txn_group_unit_commit);
+	return (0);
+}
+
+/*
+ * __wt_txn_unit_rollback --
+ *	Roll back the current unit of a group transaction, keeping the changes
+ * made by the group's earlier units.
+ */
+int
+__wt_txn_unit_rollback(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+	WT_TXN_OP *op;
+	u_int i;
+
+	txn = &session->txn;
+	if (!F_ISSET(txn, TXN_GROUP))
+		WT_RET_MSG(session, EINVAL, "No group transaction is active");
+
+	for (i = txn->unit_mod_count,
+	    op = txn->mod + i; i < txn->mod_count; i++, op++)
+		__txn_op_rollback(session, op);
+	txn->mod_count = txn->unit_mod_count;
+
+	/* Discard the unit's log records. */
+	if (txn->logrec != NULL) {
+		if (txn->unit_logrec_size == 0)
+			__wt_logrec_free(session, &txn->logrec);
+		else
+			txn->logrec->size = txn->unit_logrec_size;
+	}
+
+	F_CLR(txn, TXN_ERROR);
+	WT_STAT_FAST_CONN_INCR(session, txn_group_unit_rollback);
 	return (0);
 }
 
@@ -423,33 +691,8 @@ __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
 		    txn->id, 0));
 
 	/* Rollback updates. */
-	for (i = 0, op = txn->mod; i < txn->mod_count; i++, op++) {
-		/* Metadata updates are never rolled back. */
-		if (op->fileid == WT_METAFILE_ID)
-			continue;
-
-		switch (op->type) {
-		case TXN_OP_BASIC:
-		case TXN_OP_INMEM:
-			op->u.upd->txnid = WT_TXN_ABORTED;
-			break;
-		case TXN_OP_REF:
-			__wt_delete_page_rollback(session, op->u.ref);
-			break;
-		case TXN_OP_TRUNCATE_COL:
-		case TXN_OP_TRUNCATE_ROW:
-			/*
-			 * Nothing to do: these operations are only logged for
-			 * recovery.  The in-memory changes will be rolled back
-			 * with a combination of TXN_OP_REF and TXN_OP_INMEM
-			 * operations.
-			 */
-			break;
-		}
-
-		/* Free any memory allocated for the operation. */
-		__wt_txn_op_free(session, op);
-	}
+	for (i = 0, op = txn->mod; i < txn->mod_count; i++, op++)
+		__txn_op_rollback(session, op);
 	txn->mod_count = 0;
 
 	__wt_txn_release(session);
@@ -484,6 +727,7 @@ __wt_txn_init(WT_SESSION_IMPL *session)
 	 * for eviction.
 	 */
 	txn->mod = NULL;
+	txn->snapshot_gen = 0;
 
 	txn->isolation = session->isolation;
 	return (0);
@@ -506,6 +750,9 @@ __wt_txn_stats_update(WT_SESSION_IMPL *session)
 
 	WT_STAT_SET(stats, txn_pinned_range,
 	    txn_global->current - txn_global->oldest_id);
+	WT_STAT_SET(stats, txn_pinned_snapshot_range,
+	    txn_global->nsnap_oldest_id == WT_TXN_NONE ?
+	    0 : txn_global->current - txn_global->nsnap_oldest_id);
 }
 
 /*
@@ -540,9 +787,17 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
 	txn_global = &conn->txn_global;
 	txn_global->current = txn_global->last_running =
 	    txn_global->oldest_id = WT_TXN_FIRST;
+	txn_global->commit_gen = 1;	/* Sessions start with no snapshot */
 
 	WT_RET(__wt_calloc_def(
 	    session, conn->session_size, &txn_global->states));
+	WT_RET(__wt_calloc_def(session,
+	    WT_TXN_WRITER_WORDS(conn->session_size), &txn_global->writers));
+
+	WT_RET(__wt_rwlock_alloc(session,
+	    &txn_global->nsnap_rwlock, "named snapshot lock"));
+	txn_global->nsnap_oldest_id = WT_TXN_NONE;
+	TAILQ_INIT(&txn_global->nsnaph);
 	for (i = 0, s = txn_global->states; i < conn->session_size; i++, s++)
 		s->id = s->snap_min = WT_TXN_NONE;
 
@@ -553,15 +808,22 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
  * __wt_txn_global_destroy --
  *	Destroy the global transaction state.
  */
-void
+int
 __wt_txn_global_destroy(WT_SESSION_IMPL *session)
 {
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	WT_TXN_GLOBAL *txn_global;
 
 	conn = S2C(session);
 	txn_global = &conn->txn_global;
 
-	if (txn_global != NULL)
+	if (txn_global != NULL) {
+		__wt_txn_named_snapshot_destroy(session);
+		WT_TRET(__wt_rwlock_destroy(
+		    session, &txn_global->nsnap_rwlock));
 		__wt_free(session, txn_global->states);
+		__wt_free(session, txn_global->writers);
+	}
+	return (ret);
 }
@@ -8,6 +8,8 @@
 
 #include "wt_internal.h"
 
+static int __checkpoint_files(WT_SESSION_IMPL *, const char *[]);
+
 /*
  * __wt_checkpoint_name_ok --
  *	Complain if the checkpoint name isn't acceptable.
@@ -167,6 +169,97 @@ err:	__wt_scr_free(session, &tmp);
 	return (ret);
 }
 
+/*
+ * __checkpoint_apply_next --
+ *	Apply the checkpoint's current operation to locked handles, until there
+ * are none left.  Called by the checkpoint's session and its workers.
+ */
+static int
+__checkpoint_apply_next(
+    WT_SESSION_IMPL *session, WT_SESSION_IMPL *ckpt_session)
+{
+	WT_CKPT_HANDLE *h;
+	WT_DECL_RET;
+	u_int i;
+
+	for (;;) {
+		i = WT_ATOMIC_ADD4(ckpt_session->ckpt_apply_next, 1) - 1;
+		if (i >= ckpt_session->ckpt_handle_next)
+			return (0);
+		h = &ckpt_session->ckpt_handle[i];
+		if (h->dhandle == NULL)
+			continue;
+
+		WT_WITH_DHANDLE(session, h->dhandle,
+		    ret = ckpt_session->ckpt_apply_handle_op == NULL ?
+		    ckpt_session->ckpt_apply_op(
+		    session, ckpt_session->ckpt_apply_cfg) :
+		    ckpt_session->ckpt_apply_handle_op(session, h));
+		if (ret != 0) {
+			/* Stop the other threads taking new handles. */
+			ckpt_session->ckpt_apply_next =
+			    ckpt_session->ckpt_handle_next;
+			return (ret);
+		}
+	}
+}
+
+/*
+ * __checkpoint_thread --
+ *	A checkpoint worker thread.
+ */
+static void *
+__checkpoint_thread(void *arg)
+{
+	WT_CKPT_WORKER *worker;
+
+	worker = arg;
+	worker->error = __checkpoint_apply_next(
+	    worker->session, worker->ckpt_session);
+	return (NULL);
+}
+
+/*
+ * __checkpoint_apply_locked --
+ *	Apply an operation to the handles locked for a checkpoint, concurrently
+ * with any checkpoint workers.
+ */
+static int
+__checkpoint_apply_locked(WT_SESSION_IMPL *session, const char *cfg[],
+    int (*op)(WT_SESSION_IMPL *, const char *[]),
+    int (*handle_op)(WT_SESSION_IMPL *, WT_CKPT_HANDLE *))
+{
+	WT_CKPT_WORKER *worker;
+	WT_DECL_RET;
+	u_int i;
+
+	session->ckpt_apply_op = op;
+	session->ckpt_apply_handle_op = handle_op;
+	session->ckpt_apply_cfg = cfg;
+	session->ckpt_apply_next = 0;
+
+	for (i = 0; i < session->ckpt_workers; ++i) {
+		worker = &session->ckpt_worker[i];
+		worker->error = 0;
+		WT_ERR(__wt_thread_create(
+		    session, &worker->tid, __checkpoint_thread, worker));
+		worker->tid_set = 1;
+	}
+
+	/* The checkpoint's session does its share of the work. */
+	ret = __checkpoint_apply_next(session, session);
+
+err:	for (i = 0; i < session->ckpt_workers; ++i) {
+		worker = &session->ckpt_worker[i];
+		if (!worker->tid_set)
+			continue;
+		WT_TRET(__wt_thread_join(session, worker->tid));
+		worker->tid_set = 0;
+		WT_TRET(worker->error);
+	}
+	return (ret);
+}
+
 /*
  * __checkpoint_apply --
  *	Apply an operation to all handles locked for a checkpoint.
@@ -178,22 +271,161 @@ __checkpoint_apply(WT_SESSION_IMPL *session, const char *cfg[],
 	WT_DECL_RET;
 	u_int i;
 
-	/* If we have already locked the handles, apply the operation. */
+	/* Busy handles are only found with the handle list lock held. */
 	for (i = 0; i < session->ckpt_handle_next; ++i) {
 		if (session->ckpt_handle[i].dhandle != NULL)
-			WT_WITH_DHANDLE(session,
-			    session->ckpt_handle[i].dhandle,
-			    ret = (*op)(session, cfg));
-		else
-			WT_WITH_DHANDLE_LOCK(session,
-			    ret = __wt_conn_btree_apply_single(session,
-			    session->ckpt_handle[i].name, NULL, op, cfg));
+			continue;
+		WT_WITH_DHANDLE_LOCK(session,
+		    ret = __wt_conn_btree_apply_single(session,
+		    session->ckpt_handle[i].name, NULL, op, cfg));
 		WT_RET(ret);
 	}
 
+	/* If we have already locked the handles, apply the operation. */
+	return (__checkpoint_apply_locked(session, cfg, op, NULL));
+}
+
+/*
+ * __checkpoint_workers_open --
+ *	Open sessions for the checkpoint workers.
+ */
+static int
+__checkpoint_workers_open(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CKPT_WORKER *worker;
+	u_int i, workers;
+
+	conn = S2C(session);
+
+	/* There's no point in more workers than files to share between. */
+	workers = conn->ckpt_workers;
+	if (session->ckpt_handle_next < workers + 1)
+		workers = session->ckpt_handle_next == 0 ?
+		    0 : session->ckpt_handle_next - 1;
+	if (workers == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, workers, &session->ckpt_worker));
+	for (i = 0; i < workers; ++i) {
+		worker = &session->ckpt_worker[i];
+		worker->ckpt_session = session;
+		WT_RET(__wt_open_internal_session(
+		    conn, "checkpoint-worker", 1, 0, &worker->session));
+		++session->ckpt_workers;
+
+		/*
+		 * Checkpoint does enough I/O it may be called upon to perform
+		 * slow operations for the block manager.
+		 */
+		F_SET(worker->session,
+		    WT_SESSION_CAN_WAIT | WT_SESSION_NO_CACHE_CHECK);
+	}
 	return (0);
 }
 
+/*
+ * __checkpoint_workers_close --
+ *	Close the checkpoint workers' sessions.
+ */
+static int
+__checkpoint_workers_close(WT_SESSION_IMPL *session)
+{
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	u_int i;
+
+	for (i = 0; i < session->ckpt_workers; ++i) {
+		wt_session = &session->ckpt_worker[i].session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
+	__wt_free(session, session->ckpt_worker);
+	session->ckpt_workers = 0;
+	return (ret);
+}
+
+/*
+ * __checkpoint_throttle --
+ *	Turn checkpoint write throttling on or off for the checkpoint's session
+ * and its workers.
+ */
+static void
+__checkpoint_throttle(WT_SESSION_IMPL *session, int on)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t rate, target_usecs;
+	u_int i;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	if (!on) {
+		F_CLR(session, WT_SESSION_CHECKPOINT_THROTTLE);
+		for (i = 0; i < session->ckpt_workers; ++i)
+			F_CLR(session->ckpt_worker[i].session,
+			    WT_SESSION_CHECKPOINT_THROTTLE);
+		return;
+	}
+
+	/*
+	 * If configured, set the rate so the data currently dirty in the cache
+	 * is written in the target percentage of the checkpoint period.
+	 */
+	__wt_spin_lock(session, &conn->ckpt_write_lock);
+	if (conn->ckpt_write_target != 0 && conn->ckpt_usecs != 0) {
+		target_usecs =
+		    (uint64_t)conn->ckpt_usecs * conn->ckpt_write_target / 100;
+		rate = (uint64_t)((double)__wt_cache_dirty_inuse(cache) *
+		    WT_MILLION / target_usecs);
+		conn->ckpt_write_rate = WT_MAX(rate, conn->ckpt_write_rate_min);
+		WT_STAT_FAST_CONN_SET(
+		    session, txn_checkpoint_write_rate, conn->ckpt_write_rate);
+	}
+	conn->ckpt_write_next = 0;
+	__wt_spin_unlock(session, &conn->ckpt_write_lock);
+
+	F_SET(session, WT_SESSION_CHECKPOINT_THROTTLE);
+	for (i = 0; i < session->ckpt_workers; ++i)
+		F_SET(session->ckpt_worker[i].session,
+		    WT_SESSION_CHECKPOINT_THROTTLE);
+}
+
+/*
+ * __checkpoint_workers_snapshot --
+ *	Give the checkpoint workers the checkpoint's snapshot, or take it away.
+ */
+static void
+__checkpoint_workers_snapshot(WT_SESSION_IMPL *session, int set)
+{
+	WT_TXN *txn, *wtxn;
+	u_int i;
+
+	txn = &session->txn;
+	for (i = 0; i < session->ckpt_workers; ++i) {
+		wtxn = &session->ckpt_worker[i].session->txn;
+		if (!set) {
+			F_CLR(wtxn, TXN_HAS_SNAPSHOT);
+			wtxn->isolation = TXN_ISO_READ_COMMITTED;
+			continue;
+		}
+
+		/*
+		 * The workers don't publish the snapshot: the checkpoint's
+		 * session keeps the oldest ID from moving past it until the
+		 * workers are done.
+		 */
+		wtxn->isolation = TXN_ISO_SNAPSHOT;
+		wtxn->snap_min = txn->snap_min;
+		wtxn->snap_max = txn->snap_max;
+		if ((wtxn->snapshot_count = txn->snapshot_count) != 0)
+			memcpy(wtxn->snapshot, txn->snapshot,
+			    txn->snapshot_count * sizeof(*txn->snapshot));
+		wtxn->snapshot_gen = 0;
+		F_SET(wtxn, TXN_HAS_SNAPSHOT);
+	}
+}
+
 /*
  * __checkpoint_data_source --
  *	Checkpoint all data sources.
@@ -311,6 +543,7 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_ISOLATION saved_isolation;
 	const char *txn_cfg[] =
 	    { WT_CONFIG_BASE(session, session_begin_transaction),
@@ -322,6 +555,7 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	conn = S2C(session);
 	saved_isolation = session->isolation;
 	txn = &session->txn;
+	txn_global = &conn->txn_global;
 	full = logging = tracking = 0;
 
 	/* Ensure the metadata table is open before taking any locks. */
@@ -344,6 +578,9 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 		    session, cfg, __wt_checkpoint_list, NULL))));
 	WT_ERR(ret);
 
+	/* Start sessions for any checkpoint workers. */
+	WT_ERR(__checkpoint_workers_open(session));
+
 	/*
 	 * Update the global oldest ID so we do all possible cleanup.
 	 *
@@ -357,6 +594,7 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 
 	/* Flush dirty leaf pages before we start the checkpoint. */
 	session->isolation = txn->isolation = TXN_ISO_READ_COMMITTED;
+	__checkpoint_throttle(session, 1);
 	WT_ERR(__checkpoint_apply(session, cfg, __checkpoint_write_leaves));
 
 	/*
@@ -381,6 +619,14 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 		WT_ERR(__wt_txn_checkpoint_log(
 		    session, full, WT_TXN_LOG_CKPT_PREPARE, NULL));
 
+	/*
+	 * Stop eviction writing pages using the lookaside table before taking
+	 * the checkpoint's snapshot: those pages hold the newest committed
+	 * values, which may be newer than the checkpoint's snapshot.
+	 */
+	txn_global->checkpoint_running = 1;
+	WT_FULL_BARRIER();
+
 	/*
 	 * Start a snapshot transaction for the checkpoint.
 	 *
@@ -399,7 +645,8 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 		logging = 1;
 	}
 
-	WT_ERR(__checkpoint_apply(session, cfg, __wt_checkpoint));
+	WT_ERR(__checkpoint_files(session, cfg));
+	__checkpoint_throttle(session, 0);
 
 	/* Commit the transaction before syncing the file(s). */
 	WT_ERR(__wt_txn_commit(session, NULL));
@@ -448,12 +695,14 @@ err:	/*
 	 * overwritten the checkpoint, so what ends up on disk is not
 	 * consistent.
 	 */
+	__checkpoint_throttle(session, 0);
 	session->isolation = txn->isolation = TXN_ISO_READ_UNCOMMITTED;
 	if (tracking)
 		WT_TRET(__wt_meta_track_off(session, ret != 0));
 
 	if (F_ISSET(txn, TXN_RUNNING))
 		WT_TRET(__wt_txn_rollback(session, NULL));
+	txn_global->checkpoint_running = 0;
 
 	/* Tell logging that we have finished a database checkpoint. */
 	if (logging)
@@ -480,6 +729,8 @@ err:	/*
 
 	session->isolation = txn->isolation = saved_isolation;
 
+	WT_TRET(__checkpoint_workers_close(session));
+
 	return (ret);
 }
 
@@ -575,14 +826,15 @@ __drop_to(WT_CKPT *ckptbase, const char *name, size_t len)
 }
 
 /*
- * __checkpoint_worker --
- *	Checkpoint a tree.
+ * __checkpoint_prepare --
+ *	Prepare a tree's checkpoint: figure out which checkpoints to add and
+ * drop, and if the tree needs to be flushed.  On error, the caller resolves
+ * the checkpoint to clean up.
  */
 static int
-__checkpoint_worker(
-    WT_SESSION_IMPL *session, const char *cfg[], int is_checkpoint)
+__checkpoint_prepare(WT_SESSION_IMPL *session,
+    const char *cfg[], int is_checkpoint, WT_CKPT_HANDLE *h)
 {
-	WT_BM *bm;
 	WT_BTREE *btree;
 	WT_CKPT *ckpt, *ckptbase;
 	WT_CONFIG dropconf;
@@ -590,21 +842,13 @@ __checkpoint_worker(
 	WT_CONNECTION_IMPL *conn;
 	WT_DATA_HANDLE *dhandle;
 	WT_DECL_RET;
-	WT_LSN ckptlsn;
 	const char *name;
-	int deleted, fake_ckpt, force, hot_backup_locked, was_modified;
-	char *name_alloc;
+	int deleted, force;
 
 	btree = S2BT(session);
-	bm = btree->bm;
 	conn = S2C(session);
-	ckpt = ckptbase = NULL;
 	dhandle = session->dhandle;
-	name_alloc = NULL;
-	hot_backup_locked = 0;
-	name_alloc = NULL;
-	fake_ckpt = 0;
-	was_modified = btree->modified;
+	h->was_modified = btree->modified;
 
 	/*
 	 * Set the checkpoint LSN to the maximum LSN so that if logging is
@@ -613,37 +857,39 @@ __checkpoint_worker(
 	 * real checkpoint LSN will be assigned later for this checkpoint and
 	 * overwrite this.
 	 */
-	WT_MAX_LSN(&ckptlsn);
+	WT_MAX_LSN(&h->ckptlsn);
 
 	/* Get the list of checkpoints for this file. */
-	WT_RET(__wt_meta_ckptlist_get(session, dhandle->name, &ckptbase));
+	WT_RET(__wt_meta_ckptlist_get(session, dhandle->name, &h->ckptbase));
+	ckptbase = h->ckptbase;
 
 	/* This may be a named checkpoint, check the configuration. */
 	cval.len = 0;
 	if (cfg != NULL)
-		WT_ERR(__wt_config_gets(session, cfg, "name", &cval));
+		WT_RET(__wt_config_gets(session, cfg, "name", &cval));
 	if (cval.len == 0)
 		name = WT_CHECKPOINT;
 	else {
-		WT_ERR(__wt_checkpoint_name_ok(session, cval.str, cval.len));
-		WT_ERR(__wt_strndup(session, cval.str, cval.len, &name_alloc));
-		name = name_alloc;
+		WT_RET(__wt_checkpoint_name_ok(session, cval.str, cval.len));
+		WT_RET(__wt_strndup(
+		    session, cval.str, cval.len, &h->name_alloc));
+		name = h->name_alloc;
 	}
 
 	/* We may be dropping specific checkpoints, check the configuration. */
 	if (cfg != NULL) {
 		cval.len = 0;
-		WT_ERR(__wt_config_gets(session, cfg, "drop", &cval));
+		WT_RET(__wt_config_gets(session, cfg, "drop", &cval));
 		if (cval.len != 0) {
-			WT_ERR(__wt_config_subinit(session, &dropconf, &cval));
+			WT_RET(__wt_config_subinit(session, &dropconf, &cval));
 			while ((ret =
 			    __wt_config_next(&dropconf, &k, &v)) == 0) {
 				/* Disallow unsafe checkpoint names. */
 				if (v.len == 0)
-					WT_ERR(__wt_checkpoint_name_ok(
+					WT_RET(__wt_checkpoint_name_ok(
 					    session, k.str, k.len));
 				else
-					WT_ERR(__wt_checkpoint_name_ok(
+					WT_RET(__wt_checkpoint_name_ok(
 					    session, v.str, v.len));
 
 				if (v.len == 0)
@@ -653,12 +899,12 @@ __checkpoint_worker(
 				else if (WT_STRING_MATCH("to", k.str, k.len))
 					__drop_to(ckptbase, v.str, v.len);
 				else
-					WT_ERR_MSG(session, EINVAL,
+					WT_RET_MSG(session, EINVAL,
 					    "unexpected value for checkpoint "
 					    "key: %.*s",
 					    (int)k.len, k.str);
 			}
-			WT_ERR_NOTFOUND_OK(ret);
+			WT_RET_NOTFOUND_OK(ret);
 		}
 	}
 
@@ -693,13 +939,15 @@ __checkpoint_worker(
 	if (!btree->modified && cfg != NULL) {
 		ret = __wt_config_gets(session, cfg, "force", &cval);
 		if (ret != 0 && ret != WT_NOTFOUND)
-			WT_ERR(ret);
+			WT_RET(ret);
 		if (ret == 0 && cval.val != 0)
 			force = 1;
 	}
 	if (!btree->modified && !force) {
-		if (!is_checkpoint)
-			goto done;
+		if (!is_checkpoint) {
+			h->skip = 1;
+			return (0);
+		}
 
 		deleted = 0;
 		WT_CKPT_FOREACH(ckptbase, ckpt)
@@ -717,25 +965,31 @@ __checkpoint_worker(
 		    (strcmp(name, (ckpt - 1)->name) == 0 ||
 		    (WT_PREFIX_MATCH(name, WT_CHECKPOINT) &&
 		    WT_PREFIX_MATCH((ckpt - 1)->name, WT_CHECKPOINT))) &&
-		    deleted < 2)
-			goto done;
+		    deleted < 2) {
+			h->skip = 1;
+			return (0);
+		}
 	}
 
 	/* Add a new checkpoint entry at the end of the list. */
 	WT_CKPT_FOREACH(ckptbase, ckpt)
 		;
-	WT_ERR(__wt_strdup(session, name, &ckpt->name));
+	WT_RET(__wt_strdup(session, name, &ckpt->name));
 	F_SET(ckpt, WT_CKPT_ADD);
 
 	/*
 	 * We can't delete checkpoints if a backup cursor is open.  WiredTiger
 	 * checkpoints are uniquely named and it's OK to have multiple of them
 	 * in the system: clear the delete flag for them, and otherwise fail.
-	 * Hold the lock until we're done (blocking hot backups from starting),
-	 * we don't want to race with a future hot backup.
+	 *
+	 * We don't want to race with a future hot backup: hot backups start
+	 * while holding the schema lock, so if we hold it, we only need the
+	 * hot backup lock for the check and again to update the metadata.
+	 * Otherwise, hold the lock until we're done, blocking hot backups from
+	 * starting.
 	 */
 	__wt_spin_lock(session, &conn->hot_backup_lock);
-	hot_backup_locked = 1;
+	h->hot_backup_locked = 1;
 	if (conn->hot_backup)
 		WT_CKPT_FOREACH(ckptbase, ckpt) {
 			if (!F_ISSET(ckpt, WT_CKPT_DELETE))
@@ -744,12 +998,16 @@ __checkpoint_worker(
 				F_CLR(ckpt, WT_CKPT_DELETE);
 				continue;
 			}
-			WT_ERR_MSG(session, EBUSY,
+			WT_RET_MSG(session, EBUSY,
 			    "checkpoint %s blocked by hot backup: it would "
 			    "delete an existing checkpoint, and checkpoints "
 			    "cannot be deleted during a hot backup",
 			    ckpt->name);
 		}
+	if (F_ISSET(session, WT_SESSION_SCHEMA_LOCKED)) {
+		h->hot_backup_locked = 0;
+		__wt_spin_unlock(session, &conn->hot_backup_lock);
+	}
 
 	/*
 	 * Lock the checkpoints that will be deleted.
@@ -779,7 +1037,7 @@ __checkpoint_worker(
 				F_CLR(ckpt, WT_CKPT_DELETE);
 				continue;
 			}
-			WT_ERR_MSG(session, ret,
+			WT_RET_MSG(session, ret,
 			    "checkpoints cannot be dropped when in-use");
 		}
 
@@ -818,15 +1076,15 @@ __checkpoint_worker(
 			 */
 			WT_CKPT_FOREACH(ckptbase, ckpt)
 				if (!F_ISSET(ckpt, WT_CKPT_ADD | WT_CKPT_FAKE))
-					WT_ERR_MSG(session, ret,
+					WT_RET_MSG(session, ret,
 					    "block-manager checkpoint found "
 					    "for a bulk-loaded file");
-			fake_ckpt = 1;
-			goto fake;
+			h->fake_ckpt = 1;
+			return (0);
 		case WT_BTREE_SALVAGE:
 		case WT_BTREE_UPGRADE:
 		case WT_BTREE_VERIFY:
-			WT_ERR_MSG(session, EINVAL,
+			WT_RET_MSG(session, EINVAL,
 			    "checkpoints are blocked during salvage, upgrade "
 			    "or verify operations");
 		}
@@ -846,8 +1104,8 @@ __checkpoint_worker(
 	 */
 	if (is_checkpoint)
 		if (btree->bulk_load_ok) {
-			fake_ckpt = 1;
-			goto fake;
+			h->fake_ckpt = 1;
+			return (0);
 		}
 
 	/*
@@ -860,7 +1118,7 @@ __checkpoint_worker(
 	 * are no dirty pages), we perform a checkpoint without any writes, no
 	 * checkpoint is created, and then things get bad.
 	 */
-	WT_ERR(__wt_page_modify_init(session, btree->root.page));
+	WT_RET(__wt_page_modify_init(session, btree->root.page));
 	__wt_page_modify_set(session, btree->root.page);
 
 	/*
@@ -878,34 +1136,100 @@ __checkpoint_worker(
 
 	/* Tell logging that a file checkpoint is starting. */
 	if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
-		WT_ERR(__wt_txn_checkpoint_log(
-		    session, 0, WT_TXN_LOG_CKPT_START, &ckptlsn));
+		WT_RET(__wt_txn_checkpoint_log(
+		    session, 0, WT_TXN_LOG_CKPT_START, &h->ckptlsn));
 
-	/* Flush the file from the cache, creating the checkpoint. */
-	if (is_checkpoint)
-		WT_ERR(__wt_cache_op(session, ckptbase, WT_SYNC_CHECKPOINT));
-	else
-		WT_ERR(__wt_cache_op(session, ckptbase, WT_SYNC_CLOSE));
+	h->flush = is_checkpoint ? WT_SYNC_CHECKPOINT : WT_SYNC_CLOSE;
+	return (0);
+}
+
+/*
+ * __checkpoint_flush --
+ *	Flush a tree from the cache, creating the checkpoint.  Checkpoints of
+ * different trees can be flushed concurrently.
+ */
+static int
+__checkpoint_flush(WT_SESSION_IMPL *session, WT_CKPT_HANDLE *h)
+{
+	struct timespec start, stop;
+	WT_BTREE *btree;
+	WT_CKPT *ckpt;
+	WT_DECL_RET;
+	int throttle;
+
+	btree = S2BT(session);
+
+	if (h->flush == 0)
+		return (0);
+
+	/*
+	 * Don't throttle writes if the checkpoint holds the hot backup lock
+	 * while the tree is flushed: threads starting a hot backup would spin
+	 * for as long as we sleep.  Database checkpoints don't hold the lock
+	 * while flushing, they hold the schema lock instead.
+	 */
+	throttle = F_ISSET(session, WT_SESSION_CHECKPOINT_THROTTLE) ? 1 : 0;
+	if (h->hot_backup_locked)
+		F_CLR(session, WT_SESSION_CHECKPOINT_THROTTLE);
+
+	WT_ERR(__wt_epoch(session, &start));
+	WT_ERR(__wt_cache_op(session, h->ckptbase, h->flush));
 
 	/*
 	 * All blocks being written have been written; set the object's write
 	 * generation.
 	 */
-	WT_CKPT_FOREACH(ckptbase, ckpt)
+	WT_CKPT_FOREACH(h->ckptbase, ckpt)
 		if (F_ISSET(ckpt, WT_CKPT_ADD))
 			ckpt->write_gen = btree->write_gen;
 
-fake:	/*
+	WT_ERR(__wt_epoch(session, &stop));
+	h->msecs = WT_TIMEDIFF(stop, start) / WT_MILLION;
+
+err:	if (throttle)
+		F_SET(session, WT_SESSION_CHECKPOINT_THROTTLE);
+	return (ret);
+}
+
+/*
+ * __checkpoint_resolve --
+ *	Resolve a tree's checkpoint: update the tree's metadata unless the
+ * checkpoint failed, and clean up.
+ */
+static int
+__checkpoint_resolve(WT_SESSION_IMPL *session,
+    int is_checkpoint, WT_CKPT_HANDLE *h, int error)
+{
+	WT_BM *bm;
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	btree = S2BT(session);
+	bm = btree->bm;
+	conn = S2C(session);
+
+	if ((ret = error) != 0 || h->skip)
+		goto err;
+
+	/*
 	 * If we're faking a checkpoint and logging is enabled, recovery should
 	 * roll forward any changes made between now and the next checkpoint,
 	 * so set the checkpoint LSN to the beginning of time.
 	 */
-	if (fake_ckpt && FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
-		WT_INIT_LSN(&ckptlsn);
+	if (h->fake_ckpt && FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
+		WT_INIT_LSN(&h->ckptlsn);
 
-	/* Update the object's metadata. */
+	/*
+	 * Update the object's metadata, blocking hot backups from starting
+	 * until the blocks of any deleted checkpoints are available for re-use.
+	 */
+	if (!h->hot_backup_locked) {
+		__wt_spin_lock(session, &conn->hot_backup_lock);
+		h->hot_backup_locked = 1;
+	}
 	WT_ERR(__wt_meta_ckptlist_set(
-	    session, dhandle->name, ckptbase, &ckptlsn));
+	    session, session->dhandle->name, h->ckptbase, &h->ckptlsn));
 
 	/*
 	 * If we wrote a checkpoint (rather than faking one), pages may be
@@ -914,32 +1238,126 @@ fake:	/*
 	 * is being discarded, in which case the handle will be gone by the
 	 * time we try to apply or unroll the meta tracking event.
 	 */
-	if (!fake_ckpt) {
+	if (!h->fake_ckpt) {
 		if (WT_META_TRACKING(session) && is_checkpoint)
 			WT_ERR(__wt_meta_track_checkpoint(session));
 		else
 			WT_ERR(bm->checkpoint_resolve(bm, session));
 	}
 
+	h->hot_backup_locked = 0;
+	__wt_spin_unlock(session, &conn->hot_backup_lock);
+
 	/* Tell logging that the checkpoint is complete. */
 	if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ENABLED))
 		WT_ERR(__wt_txn_checkpoint_log(
 		    session, 0, WT_TXN_LOG_CKPT_STOP, NULL));
 
-done: err:
-	/*
+err:	/*
 	 * If the checkpoint didn't complete successfully, make sure the
 	 * tree is marked dirty.
 	 */
-	if (ret != 0 && !btree->modified && was_modified)
+	if (ret != 0 && !btree->modified && h->was_modified)
 		btree->modified = 1;
 
-	if (hot_backup_locked)
+	if (h->hot_backup_locked) {
+		h->hot_backup_locked = 0;
 		__wt_spin_unlock(session, &conn->hot_backup_lock);
+	}
+
+	__wt_meta_ckptlist_free(session, h->ckptbase);
+	__wt_free(session, h->name_alloc);
+
+	return (ret);
+}
+
+/*
+ * __checkpoint_worker --
+ *	Checkpoint a tree.
+ */
+static int
+__checkpoint_worker(
+    WT_SESSION_IMPL *session, const char *cfg[], int is_checkpoint)
+{
+	WT_CKPT_HANDLE h;
+	WT_DECL_RET;
+
+	WT_CLEAR(h);
+	h.dhandle = session->dhandle;
 
-	__wt_meta_ckptlist_free(session, ckptbase);
-	__wt_free(session, name_alloc);
+	if ((ret = __checkpoint_prepare(session, cfg, is_checkpoint, &h)) == 0)
+		ret = __checkpoint_flush(session, &h);
+	return (__checkpoint_resolve(session, is_checkpoint, &h, ret));
+}
+
+/*
+ * __checkpoint_files --
+ *	Checkpoint the files involved in a database checkpoint: the checkpoint's
+ * session prepares and resolves each file's checkpoint, the files are flushed
+ * concurrently by any checkpoint workers.
+ */
+static int
+__checkpoint_files(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CKPT_HANDLE *h;
+	WT_DECL_RET;
+	uint64_t msecs_max, msecs_total;
+	u_int i, prepared;
+
+	/* Busy handles are checkpointed one at a time. */
+	for (i = 0; i < session->ckpt_handle_next; ++i) {
+		h = &session->ckpt_handle[i];
+		if (h->dhandle != NULL)
+			continue;
+		WT_WITH_DHANDLE_LOCK(session,
+		    ret = __wt_conn_btree_apply_single(
+		    session, h->name, NULL, __wt_checkpoint, cfg));
+		WT_RET(ret);
+	}
 
+	/*
+	 * Hot backups can't start while we hold the schema lock: each file's
+	 * checkpoint only takes the hot backup lock to check for a running
+	 * backup and to update its metadata, not while it's flushed.
+	 */
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
+	for (prepared = 0; prepared < session->ckpt_handle_next;) {
+		h = &session->ckpt_handle[prepared++];
+		if (h->dhandle == NULL)
+			continue;
+		WT_WITH_DHANDLE(session, h->dhandle,
+		    ret = __checkpoint_prepare(session, cfg, 1, h));
+		if (ret != 0)
+			break;
+	}
+
+	/* The workers flush files using the checkpoint's snapshot. */
+	if (ret == 0) {
+		__checkpoint_workers_snapshot(session, 1);
+		ret = __checkpoint_apply_locked(
+		    session, cfg, NULL, __checkpoint_flush);
+		__checkpoint_workers_snapshot(session, 0);
+	}
+
+	/* Update the metadata, or clean up if anything failed. */
+	msecs_max = msecs_total = 0;
+	for (i = 0; i < prepared; ++i) {
+		h = &session->ckpt_handle[i];
+		if (h->dhandle == NULL)
+			continue;
+		if (h->msecs > msecs_max)
+			msecs_max = h->msecs;
+		msecs_total += h->msecs;
+		WT_WITH_DHANDLE(session, h->dhandle,
+		    ret = __checkpoint_resolve(session, 1, h, ret));
+	}
+
+	if (ret == 0) {
+		WT_STAT_FAST_CONN_SET(
+		    session, txn_checkpoint_file_time_max, msecs_max);
+		WT_STAT_FAST_CONN_SET(
+		    session, txn_checkpoint_file_time_total, msecs_total);
+	}
 	return (ret);
 }
 
@@ -16,6 +16,7 @@ static int
 __txn_op_log(WT_SESSION_IMPL *session,
     WT_ITEM *logrec, WT_TXN_OP *op, WT_CURSOR_BTREE *cbt)
 {
+	WT_DECL_ITEM(full);
 	WT_DECL_RET;
 	WT_ITEM key, value;
 	WT_UPDATE *upd;
@@ -30,8 +31,9 @@ __txn_op_log(WT_SESSION_IMPL *session,
 	 * Log the operation.  It must be one of the following:
 	 * 1) column store remove;
 	 * 2) column store insert/update;
-	 * 3) row store remove; or
-	 * 4) row store insert/update.
+	 * 3) row store remove;
+	 * 4) row store modify; or
+	 * 5) row store insert/update.
 	 */
 	if (cbt->btree->type != BTREE_ROW) {
 		WT_ASSERT(session, cbt->ins != NULL);
@@ -50,12 +52,28 @@ __txn_op_log(WT_SESSION_IMPL *session,
 		if (WT_UPDATE_DELETED_ISSET(upd))
 			WT_ERR(__wt_logop_row_remove_pack(session, logrec,
 			    op->fileid, &key));
-		else
+		else if (WT_UPDATE_MODIFIED_ISSET(upd) &&
+		    __wt_modify_idempotent(value.data, value.size))
+			WT_ERR(__wt_logop_row_modify_pack(session, logrec,
+			    op->fileid, &key, &value));
+		else if (WT_UPDATE_MODIFIED_ISSET(upd)) {
+			/*
+			 * Recovery can replay a record whose change is already
+			 * in the checkpoint: modifications that change the
+			 * value's length aren't safe to apply twice, log the
+			 * complete value.
+			 */
+			WT_ERR(__wt_scr_alloc(session, 0, &full));
+			WT_ERR(__wt_modify_value(session, upd, full));
+			WT_ERR(__wt_logop_row_put_pack(session, logrec,
+			    op->fileid, &key, full));
+		} else
 			WT_ERR(__wt_logop_row_put_pack(session, logrec,
 			    op->fileid, &key, &value));
 	}
 
 err:	__wt_buf_free(session, &key);
+	__wt_scr_free(session, &full);
 	return (ret);
 }
 
@@ -0,0 +1,318 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __nsnap_destroy --
+ *	Free a named snapshot.
+ */
+static void
+__nsnap_destroy(WT_SESSION_IMPL *session, WT_NAMED_SNAPSHOT *nsnap)
+{
+	__wt_free(session, nsnap->name);
+	__wt_free(session, nsnap->snapshot);
+	__wt_free(session, nsnap);
+}
+
+/*
+ * __nsnap_oldest_update --
+ *	Update the oldest ID required by the named snapshots.
+ */
+static void
+__nsnap_oldest_update(WT_SESSION_IMPL *session)
+{
+	WT_NAMED_SNAPSHOT *nsnap;
+	WT_TXN_GLOBAL *txn_global;
+	uint64_t oldest_id;
+
+	txn_global = &S2C(session)->txn_global;
+
+	oldest_id = WT_TXN_NONE;
+	TAILQ_FOREACH(nsnap, &txn_global->nsnaph, q)
+		if (oldest_id == WT_TXN_NONE ||
+		    TXNID_LT(nsnap->snap_min, oldest_id))
+			oldest_id = nsnap->snap_min;
+	WT_PUBLISH(txn_global->nsnap_oldest_id, oldest_id);
+}
+
+/*
+ * __nsnap_drop_one --
+ *	Drop a single named snapshot.
+ */
+static int
+__nsnap_drop_one(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *name)
+{
+	WT_NAMED_SNAPSHOT *found;
+	WT_TXN_GLOBAL *txn_global;
+
+	txn_global = &S2C(session)->txn_global;
+
+	TAILQ_FOREACH(found, &txn_global->nsnaph, q)
+		if (WT_STRING_MATCH(found->name, name->str, name->len))
+			break;
+	if (found == NULL)
+		WT_RET_MSG(session, EINVAL,
+		    "named snapshot '%.*s' not found",
+		    (int)name->len, name->str);
+
+	TAILQ_REMOVE(&txn_global->nsnaph, found, q);
+	__nsnap_destroy(session, found);
+	WT_STAT_FAST_CONN_INCR(session, txn_snapshots_dropped);
+	return (0);
+}
+
+/*
+ * __nsnap_drop_to --
+ *	Drop named snapshots in creation order, up to the given name (or all
+ * named snapshots, if no name is given).
+ */
+static int
+__nsnap_drop_to(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *name, int inclusive)
+{
+	WT_NAMED_SNAPSHOT *last, *nsnap;
+	WT_TXN_GLOBAL *txn_global;
+
+	txn_global = &S2C(session)->txn_global;
+
+	/* Find the last snapshot to drop, check the name before dropping. */
+	last = NULL;
+	if (name != NULL) {
+		TAILQ_FOREACH(last, &txn_global->nsnaph, q)
+			if (WT_STRING_MATCH(last->name, name->str, name->len))
+				break;
+		if (last == NULL)
+			WT_RET_MSG(session, EINVAL,
+			    "named snapshot '%.*s' not found",
+			    (int)name->len, name->str);
+	}
+
+	while ((nsnap = TAILQ_FIRST(&txn_global->nsnaph)) != NULL) {
+		if (nsnap == last && !inclusive)
+			break;
+		TAILQ_REMOVE(&txn_global->nsnaph, nsnap, q);
+		__nsnap_destroy(session, nsnap);
+		WT_STAT_FAST_CONN_INCR(session, txn_snapshots_dropped);
+		if (nsnap == last)
+			break;
+	}
+	return (0);
+}
+
+/*
+ * __wt_txn_named_snapshot_config --
+ *	Check the configuration for a named snapshot call.
+ */
+int
+__wt_txn_named_snapshot_config(WT_SESSION_IMPL *session,
+    const char *cfg[], int *has_create, int *has_drops)
+{
+	WT_CONFIG_ITEM all_config, before_config, names_config, to_config;
+	WT_CONFIG_ITEM cval;
+	int n;
+
+	*has_create = *has_drops = 0;
+
+	WT_RET(__wt_config_gets_def(session, cfg, "name", 0, &cval));
+	if (cval.len != 0)
+		*has_create = 1;
+
+	WT_RET(__wt_config_gets_def(session, cfg, "drop.all", 0, &all_config));
+	WT_RET(__wt_config_gets_def(
+	    session, cfg, "drop.before", 0, &before_config));
+	WT_RET(__wt_config_gets_def(
+	    session, cfg, "drop.names", 0, &names_config));
+	WT_RET(__wt_config_gets_def(session, cfg, "drop.to", 0, &to_config));
+
+	n = (all_config.val != 0 ? 1 : 0) +
+	    (before_config.len != 0 ? 1 : 0) + (to_config.len != 0 ? 1 : 0);
+	if (n > 1)
+		WT_RET_MSG(session, EINVAL,
+		    "only one of the drop all, before and to configurations "
+		    "may be specified");
+	if (n != 0 || names_config.len != 0)
+		*has_drops = 1;
+
+	if (!*has_create && !*has_drops)
+		WT_RET_MSG(session, EINVAL,
+		    "WT_SESSION::snapshot requires a name or drop "
+		    "configuration");
+	return (0);
+}
+
+/*
+ * __wt_txn_named_snapshot_begin --
+ *	Begin a named in-memory snapshot.  Called with the named snapshot lock
+ * held for writing.
+ */
+int
+__wt_txn_named_snapshot_begin(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	WT_NAMED_SNAPSHOT *nsnap;
+	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
+	int started_txn;
+	const char *txn_cfg[] = { WT_CONFIG_BASE(session,
+	    session_begin_transaction), "isolation=snapshot", NULL };
+
+	txn = &session->txn;
+	txn_global = &S2C(session)->txn_global;
+	nsnap = NULL;
+	started_txn = 0;
+
+	WT_RET(__wt_config_gets_def(session, cfg, "name", 0, &cval));
+	WT_ASSERT(session, cval.len != 0);
+
+	if (F_ISSET(txn, TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL,
+		    "named snapshots cannot be created in a running "
+		    "transaction");
+
+	TAILQ_FOREACH(nsnap, &txn_global->nsnaph, q)
+		if (WT_STRING_MATCH(nsnap->name, cval.str, cval.len))
+			WT_RET_MSG(session, EINVAL,
+			    "named snapshot '%.*s' already exists",
+			    (int)cval.len, cval.str);
+
+	/* Take a snapshot, the same as a snapshot isolation transaction. */
+	WT_RET(__wt_txn_begin(session, txn_cfg));
+	started_txn = 1;
+
+	WT_ERR(__wt_calloc_one(session, &nsnap));
+	WT_ERR(__wt_strndup(session, cval.str, cval.len, &nsnap->name));
+	nsnap->snap_min = txn->snap_min;
+	nsnap->snap_max = txn->snap_max;
+	if (txn->snapshot_count > 0) {
+		WT_ERR(__wt_calloc_def(
+		    session, txn->snapshot_count, &nsnap->snapshot));
+		memcpy(nsnap->snapshot, txn->snapshot,
+		    txn->snapshot_count * sizeof(*nsnap->snapshot));
+	}
+	nsnap->snapshot_count = txn->snapshot_count;
+
+	/*
+	 * Publish the oldest ID the named snapshot needs while the snapshot
+	 * transaction is still running and holding it in place.
+	 */
+	TAILQ_INSERT_TAIL(&txn_global->nsnaph, nsnap, q);
+	__nsnap_oldest_update(session);
+	WT_STAT_FAST_CONN_INCR(session, txn_snapshots_created);
+	nsnap = NULL;
+
+err:	if (started_txn)
+		WT_TRET(__wt_txn_rollback(session, NULL));
+	if (nsnap != NULL)
+		__nsnap_destroy(session, nsnap);
+
+	return (ret);
+}
+
+/*
+ * __wt_txn_named_snapshot_drop --
+ *	Drop named snapshots.  Called with the named snapshot lock held for
+ * writing.
+ */
+int
+__wt_txn_named_snapshot_drop(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG objectconf;
+	WT_CONFIG_ITEM all_config, before_config, k, names_config, to_config, v;
+	WT_DECL_RET;
+
+	WT_RET(__wt_config_gets_def(session, cfg, "drop.all", 0, &all_config));
+	WT_RET(__wt_config_gets_def(
+	    session, cfg, "drop.before", 0, &before_config));
+	WT_RET(__wt_config_gets_def(
+	    session, cfg, "drop.names", 0, &names_config));
+	WT_RET(__wt_config_gets_def(session, cfg, "drop.to", 0, &to_config));
+
+	if (all_config.val != 0)
+		WT_ERR(__nsnap_drop_to(session, NULL, 1));
+	else if (before_config.len != 0)
+		WT_ERR(__nsnap_drop_to(session, &before_config, 0));
+	else if (to_config.len != 0)
+		WT_ERR(__nsnap_drop_to(session, &to_config, 1));
+
+	if (names_config.len != 0) {
+		WT_ERR(__wt_config_subinit(
+		    session, &objectconf, &names_config));
+		while ((ret = __wt_config_next(&objectconf, &k, &v)) == 0)
+			WT_ERR(__nsnap_drop_one(session, &k));
+		WT_ERR_NOTFOUND_OK(ret);
+	}
+
+	/* Snapshots may have been dropped even if there was an error. */
+err:	__nsnap_oldest_update(session);
+	return (ret);
+}
+
+/*
+ * __wt_txn_named_snapshot_get --
+ *	Set up a transaction's snapshot from a named snapshot.
+ */
+int
+__wt_txn_named_snapshot_get(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *nameval)
+{
+	WT_DECL_RET;
+	WT_NAMED_SNAPSHOT *nsnap;
+	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *txn_state;
+
+	txn = &session->txn;
+	txn_global = &S2C(session)->txn_global;
+	txn_state = WT_SESSION_TXN_STATE(session);
+
+	/*
+	 * Publish the snapshot's oldest ID before releasing the lock: until
+	 * then, the named snapshot keeps the oldest ID from moving past it.
+	 */
+	WT_RET(__wt_readlock(session, txn_global->nsnap_rwlock));
+	TAILQ_FOREACH(nsnap, &txn_global->nsnaph, q)
+		if (WT_STRING_MATCH(nsnap->name, nameval->str, nameval->len)) {
+			WT_PUBLISH(txn_state->snap_min, nsnap->snap_min);
+			txn->snap_min = nsnap->snap_min;
+			txn->snap_max = nsnap->snap_max;
+			if ((txn->snapshot_count = nsnap->snapshot_count) != 0)
+				memcpy(txn->snapshot, nsnap->snapshot,
+				    nsnap->snapshot_count *
+				    sizeof(*nsnap->snapshot));
+			txn->snapshot_gen = 0;
+			F_SET(txn, TXN_HAS_SNAPSHOT);
+			break;
+		}
+	WT_TRET(__wt_readunlock(session, txn_global->nsnap_rwlock));
+	WT_RET(ret);
+
+	if (nsnap == NULL)
+		WT_RET_MSG(session, EINVAL,
+		    "named snapshot '%.*s' not found",
+		    (int)nameval->len, nameval->str);
+	return (0);
+}
+
+/*
+ * __wt_txn_named_snapshot_destroy --
+ *	Destroy all named snapshots on connection close.
+ */
+void
+__wt_txn_named_snapshot_destroy(WT_SESSION_IMPL *session)
+{
+	WT_NAMED_SNAPSHOT *nsnap;
+	WT_TXN_GLOBAL *txn_global;
+
+	txn_global = &S2C(session)->txn_global;
+	txn_global->nsnap_oldest_id = WT_TXN_NONE;
+
+	while ((nsnap = TAILQ_FIRST(&txn_global->nsnaph)) != NULL) {
+		TAILQ_REMOVE(&txn_global->nsnaph, nsnap, q);
+		__nsnap_destroy(session, nsnap);
+	}
+}
@@ -8,8 +8,48 @@
 
 #include "wt_internal.h"
 
-/* State maintained during recovery. */
+typedef struct __wt_recovery WT_RECOVERY;
+
+/*
+ * WT_RECOVERY_OP --
+ *	A copy of a log operation queued for a recovery worker.
+ */
+typedef struct __wt_recovery_op {
+	TAILQ_ENTRY(__wt_recovery_op) q;
+
+	WT_LSN	 lsn;			/* LSN of the commit record */
+	size_t	 size;			/* Operation size */
+	uint8_t	*data;			/* Operation, packed as in the log */
+} WT_RECOVERY_OP;
+
+/*
+ * WT_RECOVERY_WORKER --
+ *	A thread applying the log operations for a subset of files during
+ * recovery.  Each file is handled by a single worker, so the operations
+ * for any one file are applied in log order.
+ */
 typedef struct {
+	WT_RECOVERY	*r;		/* Recovery state */
+	WT_SESSION_IMPL	*session;	/* Worker session */
+	u_int		 id;		/* Worker ID */
+
+	wt_thread_t	 tid;		/* Worker thread */
+	int		 tid_set;	/* Worker thread set */
+
+	WT_SPINLOCK	 lock;		/* Locked: queue, done */
+	WT_CONDVAR	*work_cond;	/* Work queued */
+	WT_CONDVAR	*space_cond;	/* Queue space available */
+
+#define	WT_RECOVERY_QUEUE_MAX	1000	/* Queued operations per worker */
+	TAILQ_HEAD(__wt_recovery_qh, __wt_recovery_op) qh;
+	u_int		 qlen;		/* Queue length */
+
+	int		 done;		/* No more work will be queued */
+	int		 error;		/* Error applying an operation */
+} WT_RECOVERY_WORKER;
+
+/* State maintained during recovery. */
+struct __wt_recovery {
 	WT_SESSION_IMPL *session;
 
 	/* Files from the metadata, indexed by file ID. */
@@ -30,7 +70,13 @@ typedef struct {
 					 * Set during the first recovery pass,
 					 * when only the metadata is recovered.
 					 */
-} WT_RECOVERY;
+
+	WT_RECOVERY_WORKER *workers;	/* Workers applying operations */
+	u_int nworkers;			/* Number of workers */
+
+#define	WT_RECOVERY_PROGRESS	10000	/* Records between progress calls */
+	uint64_t records;		/* Log records processed */
+};
 
 /*
  * __recovery_cursor --
@@ -103,17 +149,16 @@ __recovery_cursor(WT_SESSION_IMPL *session, WT_RECOVERY *r,
  *	Apply a transactional operation during recovery.
  */
 static int
-__txn_op_apply(
+__txn_op_apply(WT_SESSION_IMPL *session,
     WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
 {
 	WT_CURSOR *cursor, *start, *stop;
+	WT_DECL_ITEM(modify);
 	WT_DECL_RET;
 	WT_ITEM key, start_key, stop_key, value;
-	WT_SESSION_IMPL *session;
 	uint64_t recno, start_recno, stop_recno;
 	uint32_t fileid, mode, optype, opsize;
 
-	session = r->session;
 	cursor = NULL;
 
 	/* Peek at the size and the type. */
@@ -179,6 +224,31 @@ __txn_op_apply(
 		WT_ERR(cursor->insert(cursor));
 		break;
 
+	case WT_LOGOP_ROW_MODIFY:
+		WT_ERR(__wt_logop_row_modify_unpack(session, pp, end,
+		    &fileid, &key, &value));
+		GET_RECOVERY_CURSOR(session, r, lsnp, fileid, &cursor);
+		__wt_cursor_set_raw_key(cursor, &key);
+		/*
+		 * Only modifications that can be applied more than once are
+		 * logged, the checkpoint can hold this change or later ones:
+		 * if the checkpoint holds a later remove of the record, the
+		 * remove is replayed after this record, skip it.
+		 */
+		if ((ret = cursor->search(cursor)) == WT_NOTFOUND) {
+			ret = 0;
+			break;
+		}
+		WT_ERR(ret);
+		WT_ERR(__wt_scr_alloc(session, 0, &modify));
+		WT_ERR(__wt_buf_set(session,
+		    modify, cursor->value.data, cursor->value.size));
+		WT_ERR(__wt_modify_apply(
+		    session, modify, value.data, value.size));
+		__wt_cursor_set_raw_value(cursor, modify);
+		WT_ERR(cursor->insert(cursor));
+		break;
+
 	case WT_LOGOP_ROW_REMOVE:
 		WT_ERR(__wt_logop_row_remove_unpack(session, pp, end,
 		    &fileid, &key));
@@ -237,6 +307,220 @@ __txn_op_apply(
 
 err:	if (ret != 0)
 		__wt_err(session, ret, "Operation failed during recovery");
+	__wt_scr_free(session, &modify);
+	return (ret);
+}
+
+/*
+ * __recovery_worker --
+ *	Thread to apply the operations queued for a recovery worker.
+ */
+static void *
+__recovery_worker(void *arg)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_RECOVERY *r;
+	WT_RECOVERY_OP *op;
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	const uint8_t *p;
+	u_int i;
+	int done;
+
+	worker = arg;
+	r = worker->r;
+	session = worker->session;
+
+	for (;;) {
+		__wt_spin_lock(session, &worker->lock);
+		if ((op = TAILQ_FIRST(&worker->qh)) != NULL) {
+			TAILQ_REMOVE(&worker->qh, op, q);
+			--worker->qlen;
+		}
+		done = worker->done;
+		__wt_spin_unlock(session, &worker->lock);
+
+		if (op == NULL) {
+			if (done)
+				break;
+			WT_ERR(__wt_cond_wait(
+			    session, worker->work_cond, 10000));
+			continue;
+		}
+		WT_ERR(__wt_cond_signal(session, worker->space_cond));
+
+		p = op->data;
+		ret = __txn_op_apply(session, r, &op->lsn, &p, p + op->size);
+		__wt_free(session, op);
+		WT_ERR(ret);
+	}
+
+err:	/*
+	 * The cursors cached for this worker's files belong to its session,
+	 * close them here.
+	 */
+	for (i = worker->id; i < r->nfiles; i += r->nworkers)
+		if ((c = r->files[i].c) != NULL) {
+			r->files[i].c = NULL;
+			WT_TRET(c->close(c));
+		}
+	if (ret != 0) {
+		worker->error = ret;
+		__wt_err(session, ret, "recovery worker error");
+	}
+	return (NULL);
+}
+
+/*
+ * __recovery_op_queue --
+ *	Queue an operation for the worker responsible for its file.
+ */
+static int
+__recovery_op_queue(
+    WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+{
+	WT_RECOVERY_OP *op;
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	uint32_t fileid, optype, opsize;
+
+	session = r->session;
+
+	/* Every log operation starts with its type, size and file ID. */
+	WT_RET(__wt_struct_unpack(session, *pp, WT_PTRDIFF(end, *pp),
+	    "III", &optype, &opsize, &fileid));
+
+	/*
+	 * Operations that won't be applied (including operations on files
+	 * without a cached cursor) are handled here, it's cheaper than
+	 * copying them.
+	 */
+	if (fileid == WT_METAFILE_ID ||
+	    fileid >= r->nfiles || r->files[fileid].uri == NULL ||
+	    LOG_CMP(lsnp, &r->files[fileid].ckpt_lsn) < 0)
+		return (__txn_op_apply(session, r, lsnp, pp, end));
+
+	if (opsize > WT_PTRDIFF(end, *pp))
+		WT_RET_MSG(session, WT_ERROR,
+		    "log operation at LSN %" PRIu32 "/%" PRIuMAX
+		    " extends past the end of the record",
+		    lsnp->file, (uintmax_t)lsnp->offset);
+	WT_RET(__wt_calloc(session, 1, sizeof(*op) + opsize, &op));
+	op->lsn = *lsnp;
+	op->size = opsize;
+	op->data = (uint8_t *)(op + 1);
+	memcpy(op->data, *pp, opsize);
+	*pp += opsize;
+
+	worker = &r->workers[fileid % r->nworkers];
+	__wt_spin_lock(session, &worker->lock);
+	while (worker->qlen >= WT_RECOVERY_QUEUE_MAX && worker->error == 0) {
+		__wt_spin_unlock(session, &worker->lock);
+		(void)__wt_cond_wait(session, worker->space_cond, 1000);
+		__wt_spin_lock(session, &worker->lock);
+	}
+	TAILQ_INSERT_TAIL(&worker->qh, op, q);
+	++worker->qlen;
+	__wt_spin_unlock(session, &worker->lock);
+
+	/* Stop reading the log if the worker failed. */
+	if (worker->error != 0)
+		return (worker->error);
+	return (__wt_cond_signal(session, worker->work_cond));
+}
+
+/*
+ * __recovery_workers_start --
+ *	Start the recovery workers.
+ */
+static int
+__recovery_workers_start(WT_RECOVERY *r, u_int nworkers)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = r->session;
+	conn = S2C(session);
+
+	WT_RET(__wt_calloc_def(session, nworkers, &r->workers));
+	for (i = 0; i < nworkers; i++) {
+		worker = &r->workers[i];
+		worker->r = r;
+		worker->id = i;
+		TAILQ_INIT(&worker->qh);
+		++r->nworkers;
+		WT_RET(__wt_spin_init(
+		    session, &worker->lock, "recovery worker"));
+		WT_RET(__wt_cond_alloc(session,
+		    "recovery work", 0, &worker->work_cond));
+		WT_RET(__wt_cond_alloc(session,
+		    "recovery space", 0, &worker->space_cond));
+		WT_RET(__wt_open_session(conn, NULL, NULL, &worker->session));
+		F_SET(worker->session, WT_SESSION_NO_LOGGING);
+	}
+
+	for (i = 0; i < r->nworkers; i++) {
+		worker = &r->workers[i];
+		WT_RET(__wt_thread_create(
+		    session, &worker->tid, __recovery_worker, worker));
+		worker->tid_set = 1;
+	}
+	return (0);
+}
+
+/*
+ * __recovery_workers_stop --
+ *	Wait for the recovery workers to drain their queues and shut them
+ * down.
+ */
+static int
+__recovery_workers_stop(WT_RECOVERY *r)
+{
+	WT_DECL_RET;
+	WT_RECOVERY_OP *op;
+	WT_RECOVERY_WORKER *worker;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = r->session;
+	if (r->workers == NULL)
+		return (0);
+
+	for (i = 0; i < r->nworkers; i++) {
+		worker = &r->workers[i];
+		__wt_spin_lock(session, &worker->lock);
+		worker->done = 1;
+		__wt_spin_unlock(session, &worker->lock);
+		WT_TRET(__wt_cond_signal(session, worker->work_cond));
+	}
+
+	for (i = 0; i < r->nworkers; i++) {
+		worker = &r->workers[i];
+		if (worker->tid_set) {
+			WT_TRET(__wt_thread_join(session, worker->tid));
+			worker->tid_set = 0;
+		}
+		WT_TRET(worker->error);
+
+		/* Discard anything left after an error. */
+		while ((op = TAILQ_FIRST(&worker->qh)) != NULL) {
+			TAILQ_REMOVE(&worker->qh, op, q);
+			__wt_free(session, op);
+		}
+		if (worker->session != NULL) {
+			wt_session = &worker->session->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+		}
+		WT_TRET(__wt_cond_destroy(session, &worker->work_cond));
+		WT_TRET(__wt_cond_destroy(session, &worker->space_cond));
+		__wt_spin_destroy(session, &worker->lock);
+	}
+	__wt_free(session, r->workers);
+	r->nworkers = 0;
 	return (ret);
 }
 
@@ -248,11 +532,12 @@ static int
 __txn_commit_apply(
     WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
 {
-	WT_UNUSED(lsnp);
-
 	/* The logging subsystem zero-pads records. */
 	while (*pp < end && **pp)
-		WT_RET(__txn_op_apply(r, lsnp, pp, end));
+		if (r->nworkers == 0 || r->metadata_only)
+			WT_RET(__txn_op_apply(r->session, r, lsnp, pp, end));
+		else
+			WT_RET(__recovery_op_queue(r, lsnp, pp, end));
 
 	return (0);
 }
@@ -275,6 +560,10 @@ __txn_log_recover(WT_SESSION_IMPL *session,
 	end = (const uint8_t *)logrec->data + logrec->size;
 	WT_UNUSED(firstrecord);
 
+	/* Report progress through the main recovery pass. */
+	if (!r->metadata_only && ++r->records % WT_RECOVERY_PROGRESS == 0)
+		WT_RET(__wt_progress(session, "recovery", r->records));
+
 	/* First, peek at the log record type. */
 	WT_RET(__wt_logrec_read(session, &p, end, &rectype));
 
@@ -491,17 +780,28 @@ __wt_txn_recover(WT_SESSION_IMPL *session)
 	 */
 	if (needs_rec && FLD_ISSET(conn->log_flags, WT_CONN_LOG_RECOVER_ERR))
 		WT_ERR(WT_RUN_RECOVERY);
+
+	/*
+	 * With multiple recovery threads, this thread reads the log and
+	 * hands operations to workers by file ID.
+	 */
+	if (needs_rec && conn->log_recover_threads > 1)
+		WT_ERR(__recovery_workers_start(&r, conn->log_recover_threads));
+
 	/*
 	 * Always run recovery even if it was a clean shutdown.
 	 * We can consider skipping it in the future.
 	 */
 	if (WT_IS_INIT_LSN(&r.ckpt_lsn))
-		WT_ERR(__wt_log_scan(session, NULL,
+		ret = __wt_log_scan(session, NULL,
 		    WT_LOGSCAN_FIRST | WT_LOGSCAN_RECOVER,
-		    __txn_log_recover, &r));
+		    __txn_log_recover, &r);
 	else
-		WT_ERR(__wt_log_scan(session, &r.ckpt_lsn,
-		    WT_LOGSCAN_RECOVER, __txn_log_recover, &r));
+		ret = __wt_log_scan(session, &r.ckpt_lsn,
+		    WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
+	WT_TRET(__recovery_workers_stop(&r));
+	WT_ERR(ret);
+	WT_ERR(__wt_progress(session, "recovery", r.records));
 
 	conn->next_file_id = r.max_fileid;
 
@@ -513,7 +813,8 @@ __wt_txn_recover(WT_SESSION_IMPL *session)
 	WT_ERR(session->iface.checkpoint(&session->iface, "force=1"));
 
 done:
-err:	WT_TRET(__recovery_free(&r));
+err:	WT_TRET(__recovery_workers_stop(&r));
+	WT_TRET(__recovery_free(&r));
 	__wt_free(session, config);
 	WT_TRET(session->iface.close(&session->iface, NULL));
 
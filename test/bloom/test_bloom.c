@@ -155,7 +155,7 @@ run(void)
 	sess = (WT_SESSION_IMPL *)g.wt_session;
 
 	if ((ret = __wt_bloom_create(
-	    sess, uri, NULL, g.c_ops, g.c_factor, g.c_k, &bloomp)) != 0)
+	    sess, uri, NULL, g.c_ops, g.c_factor, g.c_k, 0, &bloomp)) != 0)
 		die(ret, "__wt_bloom_create");
 
 	item.size = g.c_key_max;
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_checkpoint03.py
+#   Checkpoint: files are checkpointed concurrently by checkpoint workers
+#
+
+import wiredtiger, wttest
+from helper import key_populate, simple_populate
+
+class test_checkpoint03(wttest.WiredTigerTestCase):
+    ntables = 20
+    nentries = 1000
+
+    scenarios = [
+        ('workers-0', dict(workers=0)),
+        ('workers-1', dict(workers=1)),
+        ('workers-4', dict(workers=4)),
+        ('workers-20', dict(workers=20)),
+    ]
+
+    # Overrides WiredTigerTestCase, add extra config params
+    def setUpConnectionOpen(self, dir):
+        self.conn_config = \
+            'log=(enabled),checkpoint=(workers=%d)' % self.workers
+        return wttest.WiredTigerTestCase.setUpConnectionOpen(self, dir)
+
+    def uri(self, i):
+        return 'table:test_checkpoint03.%d' % i
+
+    def check(self, ckpt):
+        for i in range(self.ntables):
+            c = self.session.open_cursor(self.uri(i), None, ckpt)
+            count = 0
+            for k, v in c:
+                count += 1
+            c.close()
+            self.assertEqual(count, self.nentries + (1 if i == 0 else 0))
+
+    def test_checkpoint_workers(self):
+        for i in range(self.ntables):
+            simple_populate(self, self.uri(i),
+                'key_format=S,value_format=S', self.nentries)
+
+        # A database checkpoint, a named checkpoint and a target checkpoint.
+        self.session.checkpoint()
+        c = self.session.open_cursor(self.uri(0), None)
+        c[key_populate(c, self.nentries + 1)] = 'extra'
+        c.close()
+        self.session.checkpoint('name=ckpt')
+        self.session.checkpoint(
+            'target=("' + self.uri(1) + '","' + self.uri(2) + '")')
+        self.check('checkpoint=ckpt')
+
+        # Everything is there after the database is reopened.
+        self.reopen_conn()
+        self.check(None)
+        self.check('checkpoint=ckpt')
+
+    def test_checkpoint_workers_config(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure('checkpoint=(workers=21)'),
+            '/Value too large/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_checkpoint04.py
+#   Checkpoint: checkpoint writes are throttled to the configured rate
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_checkpoint04(wttest.WiredTigerTestCase):
+    uri = 'table:test_checkpoint04'
+    nentries = 2000
+
+    scenarios = [
+        ('write-rate', dict(ckpt_config='write_rate=2MB', rate=2*1024*1024)),
+        ('write-target',
+            dict(ckpt_config='wait=10,write_target=10', rate=None)),
+    ]
+
+    # Overrides WiredTigerTestCase, add extra config params
+    def setUpConnectionOpen(self, dir):
+        self.conn_config = \
+            'statistics=(fast),checkpoint=(' + self.ckpt_config + ')'
+        return wttest.WiredTigerTestCase.setUpConnectionOpen(self, dir)
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def test_checkpoint_throttle(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            c[i] = str(i) * 500
+        c.close()
+
+        self.session.checkpoint()
+        self.assertGreater(
+            self.get_stat(stat.conn.txn_checkpoint_throttle), 0)
+        self.assertGreater(
+            self.get_stat(stat.conn.txn_checkpoint_throttle_time), 0)
+        rate = self.get_stat(stat.conn.txn_checkpoint_write_rate)
+        if self.rate != None:
+            self.assertEqual(rate, self.rate)
+        else:
+            self.assertGreater(rate, 0)
+
+        # The data is all there.
+        self.reopen_conn()
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            self.assertEqual(c[i], str(i) * 500)
+        c.close()
+
+    def test_checkpoint_throttle_reconfig(self):
+        self.conn.reconfigure('checkpoint=(write_rate=0)')
+        self.assertEqual(
+            self.get_stat(stat.conn.txn_checkpoint_write_rate), 0)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure('checkpoint=(write_target=101)'),
+            '/Value too large/')
+
+if __name__ == '__main__':
+    wttest.run()
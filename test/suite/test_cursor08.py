@@ -0,0 +1,203 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cursor08.py
+#   Cursor modify operations
+#
+
+import os, shutil
+import wiredtiger, wttest
+
+class test_cursor08(wttest.WiredTigerTestCase):
+    nkeys = 20
+    nrounds = 30
+
+    scenarios = [
+        ('file', dict(uri='file:test_cursor08')),
+        ('table', dict(uri='table:test_cursor08')),
+    ]
+
+    # Overrides WiredTigerTestCase, add extra config params
+    def setUpConnectionOpen(self, dir):
+        self.conn_config = \
+                'log=(archive=false,enabled),' + \
+                'transaction_sync=(method=dsync,enabled)'
+        return wttest.WiredTigerTestCase.setUpConnectionOpen(self, dir)
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            if os.path.isfile(fullname):
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    # Apply a list of modifications to a string, the same way WiredTiger does.
+    def apply(self, value, entries):
+        for data, offset, size in entries:
+            if offset > len(value):
+                value += '\0' * (offset - len(value))
+            value = value[:offset] + data + value[offset + size:]
+        return value
+
+    def key(self, i):
+        return 'key%04d' % i
+
+    def check(self, expected):
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nkeys):
+            c.set_key(self.key(i))
+            self.assertEqual(c.search(), 0)
+            self.assertEqual(c.get_value(), expected[i])
+        count = 0
+        for k, v in c:
+            self.assertEqual(v, expected[int(k[3:])])
+            count += 1
+        self.assertEqual(count, self.nkeys)
+        c.close()
+
+    def test_modify(self):
+        ''' Check modifications are applied, logged and recovered. '''
+        self.session.create(self.uri, 'key_format=S,value_format=u')
+        self.session.checkpoint()
+
+        expected = []
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nkeys):
+            expected.append(('abcdefghijklmnopqrstuvwxyz' * 40) + str(i))
+            c.set_key(self.key(i))
+            c.set_value(expected[i])
+            c.insert()
+
+        # Mix insertions, replacements, deletions and appends past the end of
+        # the value, enough to exceed the number of modifications WiredTiger
+        # will stack on a single value.
+        for r in range(self.nrounds):
+            for i in range(self.nkeys):
+                entries = [
+                    ('R%dK%d' % (r, i), (r * 7 + i) % 50, r % 4),
+                    ('', (r * 13) % 30, r % 3),
+                    ('end', len(expected[i]) + r % 2, 0),
+                ]
+                c.set_key(self.key(i))
+                self.assertEqual(c.modify(entries), 0)
+                expected[i] = self.apply(expected[i], entries)
+                self.assertEqual(c.get_value(), expected[i])
+
+            # Roll back some modifications.
+            if r % 5 == 0:
+                self.session.begin_transaction()
+                c.set_key(self.key(0))
+                self.assertEqual(c.modify([('rollback', 0, 0)]), 0)
+                self.session.rollback_transaction()
+        c.close()
+        self.check(expected)
+
+        # Modifications are recovered from the log.
+        self.simulate_crash_restart(".", "RESTART")
+        self.check(expected)
+
+        # Modifications survive a checkpoint and restart.
+        self.session.checkpoint()
+        self.reopen_conn()
+        self.check(expected)
+
+    def test_modify_log(self):
+        ''' Check how modifications are logged and replayed. '''
+        self.session.create(self.uri, 'key_format=S,value_format=u')
+        c = self.session.open_cursor(self.uri, None)
+        c.set_key(self.key(0))
+        c.set_value('a' * 1000)
+        c.insert()
+        self.session.checkpoint()
+
+        # A modification that doesn't change the value's length is logged as
+        # a list of modifications, others are logged as the complete value.
+        c.set_key(self.key(0))
+        self.assertEqual(c.modify([('XYZ', 10, 3)]), 0)
+        c.set_key(self.key(0))
+        self.assertEqual(c.modify([('grow', 5, 0)]), 0)
+        expected = self.apply(self.apply('a' * 1000,
+            [('XYZ', 10, 3)]), [('grow', 5, 0)])
+        c.close()
+
+        lc = self.session.open_cursor(
+            'log:', None, 'log_operations=(row_modify)')
+        records = []
+        while lc.next() == 0:
+            records.append(lc.get_value())
+        lc.close()
+        self.assertEqual(len(records), 1)
+        txnid, rectype, optype, fileid, key, value = records[0]
+        self.assertEqual(optype, wiredtiger.WT_LOGOP_ROW_MODIFY)
+        self.assertNotEqual(fileid, 0)
+        self.assertEqual(key[:len(self.key(0))], self.key(0))
+        self.assertTrue('XYZ' in value)
+
+        # Replaying the log more than once gives the same value.
+        self.simulate_crash_restart(".", "RESTART")
+        self.simulate_crash_restart("RESTART", "RESTART2")
+        c = self.session.open_cursor(self.uri, None)
+        c.set_key(self.key(0))
+        self.assertEqual(c.search(), 0)
+        self.assertEqual(c.get_value(), expected)
+        c.close()
+
+    def test_modify_notfound(self):
+        ''' Modify fails if the record does not exist. '''
+        self.session.create(self.uri, 'key_format=S,value_format=u')
+        c = self.session.open_cursor(self.uri, None)
+        c.set_key(self.key(0))
+        self.assertEqual(c.modify([('abc', 0, 0)]), wiredtiger.WT_NOTFOUND)
+        c.set_key(self.key(0))
+        c.set_value('value')
+        c.insert()
+        c.set_key(self.key(0))
+        c.remove()
+        c.set_key(self.key(0))
+        self.assertEqual(c.modify([('abc', 0, 0)]), wiredtiger.WT_NOTFOUND)
+
+    def test_modify_notsup(self):
+        ''' Modify is only supported for raw byte string values. '''
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        c = self.session.open_cursor(self.uri, None)
+        c.set_key(self.key(0))
+        c.set_value('value')
+        c.insert()
+        c.set_key(self.key(0))
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: c.modify([('abc', 0, 0)]))
+
+if __name__ == '__main__':
+    wttest.run()
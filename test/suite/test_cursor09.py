@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cursor09.py
+#   Log cursors: targets, operation filters and log sequence number ranges
+#
+
+import wiredtiger, wttest
+
+class test_cursor09(wttest.WiredTigerTestCase):
+    uri1 = 'table:test_cursor09a'
+    uri2 = 'table:test_cursor09b'
+    nentries = 500
+
+    scenarios = [
+        ('batch1', dict(batch=1)),
+        ('batch64', dict(batch=64)),
+    ]
+
+    conn_config = 'log=(archive=false,enabled,file_max=100K)'
+
+    def walk(self, config):
+        c = self.session.open_cursor('log:', None,
+            config + ',log_batch=%d' % self.batch)
+        result = []
+        while c.next() == 0:
+            result.append((c.get_key(), c.get_value()))
+        c.close()
+        return result
+
+    def test_log_cursor_filter(self):
+        self.session.create(self.uri1, 'key_format=S,value_format=S')
+        self.session.create(self.uri2, 'key_format=S,value_format=S')
+        c1 = self.session.open_cursor(self.uri1, None)
+        c2 = self.session.open_cursor(self.uri2, None)
+        for i in range(self.nentries):
+            self.session.begin_transaction()
+            c1.set_key('key%06d' % i)
+            c1.set_value('value1')
+            c1.insert()
+            c2.set_key('key%06d' % i)
+            c2.set_value('value2')
+            c2.insert()
+            self.session.commit_transaction()
+        for i in range(0, self.nentries, 2):
+            c1.set_key('key%06d' % i)
+            c1.remove()
+        c1.close()
+        c2.close()
+
+        # Every operation is seen without filters.
+        all = self.walk('')
+        ops1 = [r for r in all if r[1][5] == 'value1']
+        ops2 = [r for r in all if r[1][5] == 'value2']
+        self.assertEqual(len(ops1), self.nentries)
+        self.assertEqual(len(ops2), self.nentries)
+
+        # Targets limit the cursor to a table's operations.
+        t1 = self.walk('target=("%s")' % self.uri1)
+        self.assertEqual(len(t1), self.nentries + self.nentries / 2)
+        self.assertEqual(
+            [r for r in t1 if r[1][5] == 'value1'], ops1)
+        t2 = self.walk('target=("%s")' % self.uri2)
+        self.assertEqual(t2, ops2)
+
+        # Operation types further limit the cursor.
+        r1 = self.walk(
+            'target=("%s"),log_operations=(row_remove)' % self.uri1)
+        self.assertEqual(len(r1), self.nentries / 2)
+        p = self.walk('log_operations=(row_put)')
+        self.assertEqual(len(p), 2 * self.nentries)
+
+        # A range of the log, starting at a previously returned key.
+        start = ops2[self.nentries / 2][0]
+        lsn = '(%d,%d)' % (start[0], start[1])
+        after = self.walk(
+            'target=("%s"),log_start_lsn=%s' % (self.uri2, lsn))
+        self.assertEqual(after, ops2[self.nentries / 2:])
+        before = self.walk(
+            'target=("%s"),log_stop_lsn=%s' % (self.uri2, lsn))
+        self.assertEqual(before, ops2[:self.nentries / 2])
+
+    def test_log_cursor_config_errors(self):
+        self.session.create(self.uri1, 'key_format=S,value_format=S')
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor('log:', None,
+            'target=("table:no_such_table")'))
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor('log:', None,
+            'log_start_lsn=(1,3)'))
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor('log:', None,
+            'log_operations=(no_such_op)'))
+
+if __name__ == '__main__':
+    wttest.run()
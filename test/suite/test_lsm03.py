@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm03.py
+#    Test LSM trees with blocked and bitmap Bloom filters.
+class test_lsm03(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm03'
+    nentries = 50000
+
+    # Loaded filters are limited to a tenth of the cache: with a small cache
+    # and large filters, some of them are read from disk.
+    scenarios = [
+        ('blocked', dict(blocked='true', cache='50MB', bits=16)),
+        ('blocked-disk', dict(blocked='true', cache='10MB', bits=200)),
+        ('bitmap', dict(blocked='false', cache='50MB', bits=16)),
+    ]
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),cache_size=' + self.cache)
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%010d' % i
+
+    # Search for every inserted key, and for keys that were never inserted.
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries * 2, 3):
+            cursor.set_key(self.key(i))
+            if i % 2 == 0:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), 'value' + str(i))
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+
+    def test_lsm_bloom(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'lsm=(chunk_size=1MB,bloom_blocked=' + self.blocked +
+            ',bloom_bit_count=' + str(self.bits) + ')')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries * 2, 2):
+            cursor[self.key(i)] = 'value' + str(i)
+        cursor.close()
+
+        # Compact so every chunk is on disk with a Bloom filter.
+        self.session.compact(self.uri, None)
+        self.check()
+
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        self.assertGreater(stat_cursor[stat.dsrc.bloom_count][2], 0)
+        self.assertGreater(stat_cursor[stat.dsrc.bloom_miss][2], 0)
+        stat_cursor.close()
+
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        disk = stat_cursor[stat.conn.lsm_bloom_blocks_disk][2]
+        stat_cursor.close()
+        if self.bits > 16:
+            self.assertGreater(disk, 0)
+        else:
+            self.assertEqual(disk, 0)
+
+        # Filters are read back in the format they were written.
+        self.reopen_conn()
+        self.check()
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm04.py
+#    Test LSM chunk key ranges skip chunks that can't contain a key.
+class test_lsm04(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm04'
+    nentries = 50000
+
+    # Disable merges so the tree has many chunks.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),lsm_manager=(merge=false)')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%010d' % i
+
+    def skipped(self):
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        skipped = stat_cursor[stat.dsrc.lsm_lookup_key_range][2]
+        stat_cursor.close()
+        return skipped
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+
+        # Point lookups, for inserted keys and for keys in between.
+        for i in range(0, self.nentries * 2, 7):
+            cursor.set_key(self.key(i))
+            if i % 2 == 0:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), 'value' + str(i))
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+
+        # Range scans from keys in between inserted keys.
+        for i in range(1, self.nentries * 2 - 10, 997):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.search_near(), 1)
+            self.assertEqual(cursor.get_key(), self.key(i + 1))
+            self.assertEqual(cursor.next(), 0)
+            self.assertEqual(cursor.get_key(), self.key(i + 3))
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.search_near(), 1)
+            self.assertEqual(cursor.prev(), 0)
+            self.assertEqual(cursor.get_key(), self.key(i - 1))
+
+        # A key past the end of the tree.
+        cursor.set_key(self.key(self.nentries * 2))
+        self.assertEqual(cursor.search_near(), -1)
+        self.assertEqual(cursor.get_key(), self.key(self.nentries * 2 - 2))
+        cursor.close()
+
+    def test_lsm_key_range(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,lsm=(chunk_size=512KB)')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries * 2, 2):
+            cursor[self.key(i)] = 'value' + str(i)
+        cursor.close()
+
+        # Flush the chunks, so their key ranges are known.
+        self.session.checkpoint(None)
+        self.check()
+        self.assertGreater(self.skipped(), 0)
+
+        # Key ranges are kept in the LSM tree's metadata.
+        self.reopen_conn()
+        self.check()
+        self.assertGreater(self.skipped(), 0)
+
+if __name__ == '__main__':
+    wttest.run()
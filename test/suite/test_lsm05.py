@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import random
+import wiredtiger, wttest
+
+# test_lsm05.py
+#    Test iterating LSM trees with many chunks, where keys are updated and
+#    removed in chunks other than the one in which they were inserted.
+class test_lsm05(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm05'
+    nkeys = 5000
+
+    # Disable merges so the tree has many chunks.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,lsm_manager=(merge=false)')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%06d' % i
+
+    def test_lsm_iterate(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,lsm=(chunk_size=512KB)')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        expect = {}
+        r = random.Random(5)
+        for i in range(60000):
+            k = r.randrange(self.nkeys)
+            if r.randrange(5) == 0:
+                cursor.set_key(self.key(k))
+                cursor.remove()
+                expect.pop(k, None)
+            else:
+                cursor[self.key(k)] = str(i) + 'x' * 100
+                expect[k] = str(i) + 'x' * 100
+            if i % 20000 == 0:
+                self.session.checkpoint(None)
+        self.session.checkpoint(None)
+
+        # Forward and backward scans see the newest version of each key.
+        keys = sorted(expect.keys())
+        self.assertEqual([int(k[3:]) for k, v in cursor], keys)
+        cursor.reset()
+        for k in reversed(keys):
+            self.assertEqual(cursor.prev(), 0)
+            self.assertEqual(cursor.get_key(), self.key(k))
+            self.assertEqual(cursor.get_value(), expect[k])
+        self.assertEqual(cursor.prev(), wiredtiger.WT_NOTFOUND)
+
+        # Change direction part-way through a scan.
+        for i in range(0, len(keys) - 10, 101):
+            cursor.set_key(self.key(keys[i]))
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.next(), 0)
+            self.assertEqual(cursor.get_key(), self.key(keys[i + 1]))
+            self.assertEqual(cursor.next(), 0)
+            self.assertEqual(cursor.get_key(), self.key(keys[i + 2]))
+            self.assertEqual(cursor.prev(), 0)
+            self.assertEqual(cursor.get_key(), self.key(keys[i + 1]))
+            self.assertEqual(cursor.prev(), 0)
+            self.assertEqual(cursor.get_key(), self.key(keys[i]))
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm07.py
+#    Test the leveled LSM merge policy.
+class test_lsm07(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm07'
+    nentries = 200000
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),lsm_manager=(worker_thread_max=4)')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%010d' % i
+
+    def present(self, i):
+        return i % 2 == 0 and (i < 20000 or i >= 30000)
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries, 7):
+            cursor.set_key(self.key(i))
+            if self.present(i):
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), 'update' + str(i))
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        expected = [i for i in range(self.nentries) if self.present(i)]
+        cursor.reset()
+        self.assertEqual([k for k, v in cursor], map(self.key, expected))
+        cursor.close()
+
+    def test_lsm_leveled(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'lsm=(chunk_size=512KB,merge_max=4,' +
+            'merge_policy=leveled,level_multiplier=4)')
+
+        # Insert and then update in scrambled orders, so the chunks' key
+        # ranges overlap and the merges find old versions of the records.
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries, 2):
+            k = (i * 7919) % self.nentries
+            cursor[self.key(k)] = 'value' + str(k)
+        for i in range(0, self.nentries, 2):
+            k = (i * 104729) % self.nentries
+            cursor[self.key(k)] = 'update' + str(k)
+        for i in range(20000, 30000, 2):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.remove(), 0)
+        cursor.close()
+
+        self.session.compact(self.uri, None)
+        self.check()
+
+        # Compaction leaves the records in a single level: queries search
+        # it and the in-memory chunk, and there are no old versions.
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        self.assertLessEqual(
+            stat_cursor[stat.dsrc.lsm_amplification_read][2], 2)
+        self.assertEqual(
+            stat_cursor[stat.dsrc.lsm_amplification_space][2], 100)
+        self.assertGreater(
+            stat_cursor[stat.dsrc.lsm_amplification_write][2], 100)
+        stat_cursor.close()
+
+        # The merge policy and levels are in the LSM tree's metadata.
+        self.reopen_conn()
+        self.check()
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time, wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm08.py
+#    Test LSM prefix searches and prefix Bloom filters.
+class test_lsm08(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm08'
+    ntenants = 20
+    nkeys = 2000
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),lsm_manager=(merge=false)')
+        self.pr(`conn`)
+        return conn
+
+    def prefix(self, t):
+        return 'tenant%03d' % t
+
+    def key(self, t, i):
+        return self.prefix(t) + '/%06d' % i
+
+    # Every third tenant has no keys.
+    def present(self, t):
+        return t < self.ntenants and t % 3 != 1
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, 'prefix_search=true')
+        for t in range(self.ntenants + 2):
+            cursor.set_key(self.prefix(t))
+            if not self.present(t):
+                self.assertEqual(
+                    cursor.search_near(), wiredtiger.WT_NOTFOUND)
+                continue
+            self.assertEqual(cursor.search_near(), 1)
+            keys = [cursor.get_key()]
+            while cursor.next() == 0:
+                keys.append(cursor.get_key())
+            self.assertEqual(
+                keys, [self.key(t, i) for i in range(self.nkeys)])
+
+            # Moving backwards leaves the prefix immediately.
+            cursor.set_key(self.prefix(t))
+            self.assertEqual(cursor.search_near(), 1)
+            self.assertEqual(cursor.prev(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+
+    def test_lsm_prefix_search(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'lsm=(chunk_size=512KB,bloom_prefix=9)')
+
+        # Load the tenants one at a time, so each chunk has few tenants.
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for t in range(self.ntenants):
+            if self.present(t):
+                for i in range(self.nkeys):
+                    cursor[self.key(t, i)] = 'value' * 10
+        cursor.close()
+        self.session.checkpoint()
+
+        # Searches for tenants without keys skip chunks once the flushed
+        # chunks have Bloom filters.
+        for i in range(60):
+            self.check()
+            stat_cursor = self.session.open_cursor(
+                'statistics:' + self.uri, None, None)
+            misses = stat_cursor[stat.dsrc.bloom_prefix_miss][2]
+            stat_cursor.close()
+            if misses > 0:
+                break
+            time.sleep(1)
+        self.assertGreater(misses, 0)
+
+        self.reopen_conn()
+        self.check()
+
+if __name__ == '__main__':
+    wttest.run()
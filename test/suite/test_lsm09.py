@@ -0,0 +1,82 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm09.py
+#    Test scheduling of LSM maintenance across many trees.
+class test_lsm09(wttest.WiredTigerTestCase):
+    ntrees = 20
+    nentries = 20000
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),lsm_manager=(worker_thread_max=4)')
+        self.pr(`conn`)
+        return conn
+
+    def uri(self, i):
+        return 'lsm:test_lsm09.' + str(i)
+
+    def test_lsm_scheduling(self):
+        for t in range(self.ntrees):
+            self.session.create(self.uri(t), 'key_format=i,value_format=S,' +
+                'lsm=(chunk_size=512KB)')
+
+        # Fill one tree far faster than the others: every tree still gets
+        # its maintenance done.
+        busy = self.session.open_cursor(self.uri(0), None, None)
+        for t in range(1, self.ntrees):
+            cursor = self.session.open_cursor(self.uri(t), None, None)
+            for i in range(self.nentries):
+                busy[t * self.nentries + i] = 'busy' + str(i) + 'x' * 100
+                if i % 10 == 0:
+                    cursor[i] = 'value' + str(i) + 'x' * 100
+            cursor.close()
+        busy.close()
+
+        for t in range(self.ntrees):
+            self.session.compact(self.uri(t), None)
+            stat_cursor = self.session.open_cursor(
+                'statistics:' + self.uri(t), None, None)
+            done = stat_cursor[stat.dsrc.lsm_work_units_done][2]
+            waited = stat_cursor[stat.dsrc.lsm_work_queue_wait][2]
+            waited_max = stat_cursor[stat.dsrc.lsm_work_queue_wait_max][2]
+            stat_cursor.close()
+            self.assertGreater(done, 0)
+            self.assertLessEqual(waited_max, waited)
+
+            cursor = self.session.open_cursor(self.uri(t), None, None)
+            if t != 0:
+                self.assertEqual(len([k for k, v in cursor]),
+                    self.nentries / 10)
+            cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time, wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm10.py
+#    Test throttling updates to an LSM tree.
+class test_lsm10(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm10'
+    nentries = 30000
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,cache_size=50MB,' +
+            'statistics=(fast),lsm_manager=(worker_thread_max=3)')
+        self.pr(`conn`)
+        return conn
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def test_lsm_throttle(self):
+        # A backlog target of a single chunk throttles updates as soon as
+        # flushes or merges fall behind.
+        self.session.create(self.uri, 'key_format=i,value_format=S,' +
+            'lsm=(chunk_size=512KB,merge_max=4,throttle_backlog=1)')
+
+        # A snapshot older than the chunks' switch transactions stops them
+        # being flushed, so the backlog grows with every switch.
+        self.session.create('table:pin', 'key_format=i,value_format=i')
+        session2 = self.conn.open_session()
+        session2.begin_transaction('isolation=snapshot')
+        pin_cursor = session2.open_cursor('table:pin', None, None)
+        self.assertEqual(pin_cursor.next(), wiredtiger.WT_NOTFOUND)
+
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nentries):
+            cursor[(i * 7919) % self.nentries] = 'value' + str(i) + 'x' * 100
+        cursor.close()
+
+        # Wait for the switches, then check updates are delayed.
+        for i in range(60):
+            if self.get_stat(stat.dsrc.lsm_chunk_count) >= 5:
+                break
+            time.sleep(1)
+        self.assertGreaterEqual(self.get_stat(stat.dsrc.lsm_chunk_count), 5)
+        self.assertGreater(self.get_stat(stat.dsrc.lsm_backlog_predicted), 1)
+        self.assertGreater(self.get_stat(stat.dsrc.lsm_throttle_delay), 0)
+
+        # The throttle winds down once the backlog is flushed and merged.
+        pin_cursor.close()
+        session2.rollback_transaction()
+        session2.close()
+        self.session.compact(self.uri, None)
+        self.assertEqual(self.get_stat(stat.dsrc.lsm_backlog_predicted), 0)
+
+        # The backlog target is in the LSM tree's metadata.
+        self.reopen_conn()
+        cursor = self.session.open_cursor('metadata:', None, None)
+        self.assertTrue('throttle_backlog=1' in cursor[self.uri])
+        cursor.close()
+
+        cursor = self.session.open_cursor(self.uri, None, None)
+        self.assertEqual(len([k for k, v in cursor]), self.nentries)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
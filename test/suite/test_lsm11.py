@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm11.py
+#    Test allocating the in-memory chunk's updates from page arenas.
+class test_lsm11(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm11'
+    nentries = 50000
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=50MB,statistics=(fast)')
+        self.pr(`conn`)
+        return conn
+
+    def test_lsm_page_arena(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,lsm=(chunk_size=1MB)')
+        cursor = self.session.open_cursor(self.uri, None, None)
+
+        # Insert, update and remove keys, in and out of order, so updates
+        # are replaced, pages split and chunks are switched and flushed.
+        for i in range(self.nentries):
+            cursor['%08d' % ((i * 7919) % self.nentries)] = 'a' * 100
+        for i in range(0, self.nentries, 2):
+            cursor['%08d' % i] = 'b' * 100
+        for i in range(0, self.nentries, 4):
+            cursor.set_key('%08d' % i)
+            self.assertEqual(cursor.remove(), 0)
+
+        # Updates in a rolled back transaction are discarded.
+        self.session.begin_transaction()
+        for i in range(1, self.nentries, 2):
+            cursor['%08d' % i] = 'c' * 100
+        self.session.rollback_transaction()
+        cursor.close()
+
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(stat_cursor[stat.conn.cache_arena_alloc][2], 0)
+        stat_cursor.close()
+
+        # Check the contents, before and after the tree is flushed.
+        for reopen in (False, True):
+            if reopen:
+                self.reopen_conn()
+            cursor = self.session.open_cursor(self.uri, None, None)
+            count = 0
+            for k, v in cursor:
+                i = int(k)
+                self.assertNotEqual(i % 4, 0)
+                self.assertEqual(v, ('b' if i % 2 == 0 else 'a') * 100)
+                count += 1
+            self.assertEqual(count, self.nentries - self.nentries / 4)
+            cursor.close()
+
+    # Repeatedly updating the same keys frees the obsolete updates, so the
+    # in-memory chunk doesn't grow until it's switched.
+    def test_lsm_page_arena_hot_keys(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,lsm=(chunk_size=1MB)')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(2000):
+            cursor['k%08d' % i] = 'a' * 100
+        for i in range(100000):
+            cursor['%08d' % (i % 10)] = chr(ord('a') + i % 26) * 100
+        for i in range(10):
+            self.assertEqual(cursor['%08d' % i],
+                chr(ord('a') + (99990 + i) % 26) * 100)
+        cursor.close()
+
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        self.assertEqual(stat_cursor[stat.dsrc.lsm_chunk_count][2], 1)
+        stat_cursor.close()
+
+        # The cache is charged for the arena blocks the inserts came from.
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreaterEqual(stat_cursor[stat.conn.cache_bytes_inuse][2],
+            stat_cursor[stat.conn.cache_arena_alloc][2])
+        stat_cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import os, re, time, wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm12.py
+#    Test creating Bloom filters while flushing LSM chunks.
+class test_lsm12(wttest.WiredTigerTestCase):
+    name = 'test_lsm12'
+    uri = 'lsm:' + name
+    nentries = 50000
+
+    # Merges are off, so every flushed chunk keeps the Bloom filter it was
+    # flushed with.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),lsm_manager=(merge=false)')
+        self.pr(`conn`)
+        return conn
+
+    def key(self, i):
+        return 'key%010d' % i
+
+    # Search for every inserted key, and for keys that were never inserted.
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries * 2, 3):
+            cursor.set_key(self.key(i))
+            if i % 2 == 0:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), 'value' + str(i))
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+
+    def stats(self):
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        ret = (stat_cursor[stat.dsrc.lsm_chunk_count][2],
+            stat_cursor[stat.dsrc.bloom_count][2],
+            stat_cursor[stat.dsrc.bloom_flush][2],
+            stat_cursor[stat.dsrc.bloom_miss][2])
+        stat_cursor.close()
+        return ret
+
+    def test_lsm_bloom_flush(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,lsm=(chunk_size=1MB)')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(0, self.nentries * 2, 2):
+            cursor[self.key(i)] = 'value' + str(i)
+        cursor.close()
+
+        # Wait for the chunks other than the primary to be flushed.  Every
+        # filter is created by a flush, not by a Bloom work unit reading the
+        # chunk back after the flush.
+        for i in range(60):
+            chunks, blooms, flushed, misses = self.stats()
+            if chunks > 2 and blooms == chunks - 1 and flushed == blooms:
+                break
+            time.sleep(1)
+        self.assertGreater(chunks, 2)
+        self.assertEqual(blooms, chunks - 1)
+        self.assertEqual(flushed, blooms)
+
+        # The chunks are marked as having Bloom filters, and the filters
+        # exist.
+        meta_cursor = self.session.open_cursor('metadata:', None, None)
+        meta = meta_cursor[self.uri]
+        meta_cursor.close()
+        ids = re.findall(r'id=(\d+),bloom\b', meta)
+        self.assertEqual(len(ids), blooms)
+        for id in ids:
+            self.assertTrue(
+                os.path.exists('%s-%06d.bf' % (self.name, int(id))))
+
+        # Lookups return the right results, and the filters skip chunks.
+        self.check()
+        self.assertGreater(self.stats()[3], 0)
+
+        self.reopen_conn()
+        self.check()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtscenario import number_scenarios
+
+# test_stat03.py
+#    Statistics: keys with update conflicts.
+class test_stat03(wttest.WiredTigerTestCase):
+    uri = 'file:test_stat03.wt'
+    conn_config = 'statistics=(fast),statistics_conflicts=(enabled,keys=3)'
+
+    keyfmt = [
+        ('recno', dict(keyfmt='r')),
+        ('string', dict(keyfmt='S')),
+    ]
+    scenarios = number_scenarios(keyfmt)
+
+    def key(self, i):
+        if self.keyfmt == 'r':
+            return i + 1
+        return 'key%04d' % i
+
+    # Fail an update of the key with a conflict, count times.
+    def conflict(self, i, count):
+        for n in range(count):
+            self.session.begin_transaction()
+            self.session2.begin_transaction('isolation=snapshot')
+            c = self.session.open_cursor(self.uri, None)
+            c[self.key(i)] = 'session1'
+            c2 = self.session2.open_cursor(self.uri, None)
+            c2.set_key(self.key(i))
+            c2.set_value('conflict')
+            self.assertRaises(wiredtiger.WiredTigerError, lambda: c2.update())
+            c2.close()
+            c.close()
+            self.session2.rollback_transaction()
+            self.session.commit_transaction()
+
+    # Return the conflict keys from a statistics cursor, in order.
+    def conflict_keys(self, config=None):
+        keys = []
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, config)
+        for desc, pvalue, value in stat_cursor.values():
+            if desc.startswith('transaction: update conflicts on key'):
+                keys.append((desc.split('"')[1], value))
+            elif desc == 'transaction: update conflicts':
+                total = value
+        stat_cursor.close()
+        return total, keys
+
+    def test_stat_conflicts(self):
+        self.session.create(self.uri,
+            'key_format=' + self.keyfmt + ',value_format=S')
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(10):
+            c[self.key(i)] = 'value'
+        c.close()
+
+        self.session2 = self.conn.open_session()
+        self.conflict(5, 10)
+        self.conflict(2, 5)
+        self.conflict(7, 1)
+
+        # The keys are returned in decreasing order of conflicts.
+        total, keys = self.conflict_keys()
+        self.assertEqual(total, 16)
+        self.assertEqual(keys,
+            [(str(self.key(5)), 10), (str(self.key(2)), 5),
+            (str(self.key(7)), 1)])
+
+        # A new key replaces the key with the fewest conflicts, inheriting
+        # its count.
+        self.conflict(8, 1)
+        total, keys = self.conflict_keys('statistics=(fast,clear)')
+        self.assertEqual(keys[2], (str(self.key(8)), 2))
+        self.assertEqual(len(keys), 3)
+
+        # Clearing statistics clears the keys.
+        total, keys = self.conflict_keys()
+        self.assertEqual(keys, [])
+
+        # Reconfiguring turns tracking off.
+        self.conn.reconfigure('statistics_conflicts=(enabled=false)')
+        self.conflict(1, 2)
+        total, keys = self.conflict_keys()
+        self.assertEqual(total, 2)
+        self.assertEqual(keys, [])
+        self.session2.close()
+
+if __name__ == '__main__':
+    wttest.run()
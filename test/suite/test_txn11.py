@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn11.py
+#   Transactions: recovery with multiple recovery threads
+#
+
+import os, shutil
+import wttest
+
+class test_txn11(wttest.WiredTigerTestCase):
+    tablecount = 5
+    nentries = 1000
+    create_params = 'key_format=i,value_format=i'
+
+    scenarios = [
+        ('threads1', dict(recover_threads=1)),
+        ('threads3', dict(recover_threads=3)),
+        ('threads8', dict(recover_threads=8)),
+    ]
+
+    # Overrides WiredTigerTestCase, add extra config params
+    def setUpConnectionOpen(self, dir):
+        self.conn_config = \
+                'log=(archive=false,enabled,file_max=100K,' + \
+                'recover_threads=%d),' % self.recover_threads + \
+                'transaction_sync=(method=dsync,enabled)'
+        return wttest.WiredTigerTestCase.setUpConnectionOpen(self, dir)
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            if os.path.isfile(fullname):
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    def uri(self, i):
+        return 'table:test_txn11_%d' % i
+
+    def test_recovery(self):
+        ''' Check changes to several tables are recovered in log order. '''
+        for t in range(self.tablecount):
+            self.session.create(self.uri(t), self.create_params)
+        self.session.checkpoint()
+
+        # Interleave the tables in the log, overwriting every key so
+        # applying operations out of order would be visible.
+        cursors = [self.session.open_cursor(self.uri(t), None, None)
+            for t in range(self.tablecount)]
+        for i in range(self.nentries):
+            for t, c in enumerate(cursors):
+                c.set_key(i % 100)
+                c.set_value(i + t)
+                c.insert()
+        for t, c in enumerate(cursors):
+            c.set_key(t)
+            c.remove()
+            c.close()
+
+        self.simulate_crash_restart(".", "RESTART")
+        for t in range(self.tablecount):
+            c = self.session.open_cursor(self.uri(t), None, None)
+            count = 0
+            for key, value in c:
+                self.assertNotEqual(key, t)
+                self.assertEqual(value, self.nentries - 100 + key + t)
+                count += 1
+            self.assertEqual(count, 99)
+            c.close()
+
+if __name__ == '__main__':
+    wttest.run()
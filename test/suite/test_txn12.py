@@ -0,0 +1,172 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_txn12.py
+#   Transactions: recycling archived log files
+#
+
+import glob, os, shutil, struct, time
+from wiredtiger import stat
+import wiredtiger, wttest
+
+class test_txn12(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn12'
+    nentries = 1000
+    rounds = 5
+
+    scenarios = [
+        ('recycle', dict(recycle='true')),
+        ('remove', dict(recycle='false')),
+    ]
+
+    # Overrides WiredTigerTestCase, add extra config params
+    def setUpConnectionOpen(self, dir):
+        self.conn_config = \
+                'log=(archive=true,enabled,file_max=100K,prealloc=true,' + \
+                'recycle=%s),' % self.recycle + \
+                'statistics=(fast),transaction_sync=(method=dsync,enabled)'
+        return wttest.WiredTigerTestCase.setUpConnectionOpen(self, dir)
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            if os.path.isfile(fullname):
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def check(self, count):
+        c = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for key, value in c:
+            self.assertEqual(key, i)
+            self.assertEqual(value, str(i) * 10)
+            i += 1
+        self.assertEqual(i, count)
+        c.close()
+
+    def test_recycle(self):
+        ''' Check archived log files are recycled and read back correctly. '''
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri, None, None)
+        for r in range(self.rounds):
+            for i in range(r * self.nentries, (r + 1) * self.nentries):
+                c.set_key(i)
+                c.set_value(str(i) * 10)
+                c.insert()
+            # Checkpoint and give the log server a chance to archive.
+            self.session.checkpoint()
+            time.sleep(2)
+        c.close()
+
+        recycled = self.get_stat(stat.conn.log_prealloc_recycled)
+        if self.recycle == 'true':
+            self.assertGreater(recycled, 0)
+        else:
+            self.assertEqual(recycled, 0)
+
+        # Write records into recycled log files after the checkpoint, they
+        # must be found by recovery, stale records must not.
+        c = self.session.open_cursor(self.uri, None, None)
+        count = (self.rounds + 1) * self.nentries
+        for i in range(self.rounds * self.nentries, count):
+            c.set_key(i)
+            c.set_value(str(i) * 10)
+            c.insert()
+        c.close()
+
+        self.simulate_crash_restart(".", "RESTART")
+        self.check(count)
+
+        # Crash again after more work, recovery must read past the log
+        # files found during the last recovery.
+        c = self.session.open_cursor(self.uri, None, None)
+        for i in range(count, count + self.nentries):
+            c.set_key(i)
+            c.set_value(str(i) * 10)
+            c.insert()
+        c.close()
+        count += self.nentries
+        self.simulate_crash_restart("RESTART", "RESTART2")
+        self.check(count)
+
+    # The log file header: a 16 byte record header, then the magic number
+    # followed by the major and minor versions.
+    def log_version(self, fname):
+        with open(fname, 'rb') as f:
+            f.seek(16)
+            return struct.unpack('<IHH', f.read(8))[1:]
+
+    def set_log_minor_version(self, fname, minorv):
+        with open(fname, 'r+b') as f:
+            f.seek(22)
+            f.write(struct.pack('<H', minorv))
+
+    def test_log_version(self):
+        ''' Check the log version written, and that newer ones are refused. '''
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nentries):
+            c.set_key(i)
+            c.set_value(str(i) * 10)
+            c.insert()
+        c.close()
+
+        # Only recycled log files use the newer log format.
+        logs = glob.glob('WiredTigerLog.*')
+        self.assertGreater(len(logs), 0)
+        for fname in logs:
+            if self.recycle == 'true':
+                self.assertEqual(self.log_version(fname), (1, 1))
+            else:
+                self.assertEqual(self.log_version(fname), (1, 0))
+
+        # A log file version this build doesn't know is an error, not a
+        # corrupted log to be truncated by recovery.
+        self.close_conn()
+        for fname in logs:
+            self.set_log_minor_version(fname, 99)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.setUpConnectionOpen('.'),
+            '/unsupported log file version/')
+
+if __name__ == '__main__':
+    wttest.run()
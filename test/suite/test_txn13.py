@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn13.py
+#   Transactions: named snapshots
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_txn13(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn13'
+    nsnapshots = 5
+    nrows = 100
+
+    conn_config = 'statistics=(fast)'
+
+    def count_rows(self, session, config):
+        session.begin_transaction(config)
+        c = session.open_cursor(self.uri, None)
+        count = 0
+        while c.next() == 0:
+            count += 1
+        c.close()
+        session.commit_transaction()
+        return count
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nsnapshots):
+            for j in range(self.nrows):
+                c[i * self.nrows + j] = j
+            self.session.snapshot('name=%d' % i)
+        c.close()
+
+    def check_snapshots(self, present):
+        session2 = self.conn.open_session()
+        for i in range(self.nsnapshots):
+            if i in present:
+                self.assertEqual(self.count_rows(
+                    session2, 'snapshot=%d' % i), (i + 1) * self.nrows)
+            else:
+                self.assertRaises(wiredtiger.WiredTigerError,
+                    lambda: session2.begin_transaction('snapshot=%d' % i))
+        session2.close()
+
+    def test_named_snapshot(self):
+        self.populate()
+        self.check_snapshots(range(self.nsnapshots))
+
+        # Snapshot reads don't change as the table is updated.
+        c = self.session.open_cursor(self.uri, None)
+        c[self.nsnapshots * self.nrows] = 0
+        c.close()
+        self.check_snapshots(range(self.nsnapshots))
+
+        # Named snapshots pin the oldest transaction ID.
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(
+            stat_cursor[stat.conn.txn_pinned_snapshot_range][2], 0)
+        stat_cursor.close()
+
+        self.session.snapshot('drop=(names=(1,3))')
+        self.check_snapshots([0, 2, 4])
+        self.session.snapshot('drop=(before=4)')
+        self.check_snapshots([4])
+        self.session.snapshot('drop=(to=4)')
+        self.check_snapshots([])
+
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertEqual(
+            stat_cursor[stat.conn.txn_pinned_snapshot_range][2], 0)
+        self.assertEqual(
+            stat_cursor[stat.conn.txn_snapshots_created][2], self.nsnapshots)
+        self.assertEqual(
+            stat_cursor[stat.conn.txn_snapshots_dropped][2], self.nsnapshots)
+        stat_cursor.close()
+
+    def test_named_snapshot_errors(self):
+        self.populate()
+        msg = '/already exists/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.snapshot('name=0'), msg)
+        msg = '/not found/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.snapshot('drop=(names=(none))'), msg)
+        msg = '/only one of the drop/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.snapshot('drop=(all,to=0)'), msg)
+
+        self.session.begin_transaction()
+        msg = '/running transaction/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.snapshot('name=new'), msg)
+        self.session.rollback_transaction()
+
+        self.session.snapshot('drop=(all)')
+        self.check_snapshots([])
+
+if __name__ == '__main__':
+    wttest.run()
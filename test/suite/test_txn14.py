@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn14.py
+#   Transactions: background pruning of update chains
+#
+
+import time
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import multiply_scenarios, number_scenarios
+
+class test_txn14(wttest.WiredTigerTestCase):
+    nupdates = 200
+
+    types = [
+        ('row', dict(uri='table:test_txn14', key_format='S')),
+        ('var', dict(uri='table:test_txn14', key_format='r')),
+    ]
+    scenarios = number_scenarios(multiply_scenarios('.', types))
+
+    conn_config = 'statistics=(fast),update_prune=(chain_max=10,wait=1)'
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def test_update_prune(self):
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S')
+        key = 'key' if self.key_format == 'S' else 1
+        c = self.session.open_cursor(self.uri, None)
+        c[key] = 'value0'
+
+        # A running transaction keeps the old updates in place.
+        session2 = self.conn.open_session()
+        session2.begin_transaction('isolation=snapshot')
+        c2 = session2.open_cursor(self.uri, None)
+        self.assertEqual(c2[key], 'value0')
+
+        for i in range(1, self.nupdates):
+            c[key] = 'value%d' % i
+        self.assertEqual(c2[key], 'value0')
+
+        # Once it completes, the prune server discards the obsolete updates.
+        c2.close()
+        session2.commit_transaction()
+        session2.close()
+
+        for i in range(30):
+            if self.get_stat(stat.conn.txn_prune_updates) > 0:
+                break
+            time.sleep(1)
+        self.assertGreater(self.get_stat(stat.conn.txn_prune_updates), 0)
+        self.assertGreaterEqual(self.get_stat(
+            stat.conn.txn_prune_chain_before), self.nupdates)
+        self.assertGreater(self.get_stat(stat.conn.txn_prune_pages), 0)
+        self.assertEqual(c[key], 'value%d' % (self.nupdates - 1))
+        c.close()
+
+    def test_update_prune_reconfig(self):
+        self.conn.reconfigure('update_prune=(wait=0)')
+        self.conn.reconfigure('update_prune=(chain_max=2,wait=1)')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn15.py
+#   Transactions: the lookaside table lets long-running readers see old
+#   values of records evicted from the cache
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_txn15(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn15'
+    nentries = 2000
+    nupdates = 5
+
+    conn_config = 'cache_size=1MB,lookaside=(enabled=true),statistics=(fast)'
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def value(self, i, round):
+        return ('%d-%d-' % (i, round)) * 50
+
+    def test_lookaside(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            c['%06d' % i] = self.value(i, 0)
+
+        # Start a long-running reader.
+        session2 = self.conn.open_session()
+        session2.begin_transaction('isolation=snapshot')
+        c2 = session2.open_cursor(self.uri, None)
+        self.assertEqual(c2['%06d' % 0], self.value(0, 0))
+
+        # Update every record until the updates overflow the cache: eviction
+        # has to write the old values into the lookaside table.
+        for round in range(1, self.nupdates + 1):
+            for i in range(self.nentries):
+                c['%06d' % i] = self.value(i, round)
+        self.assertGreater(self.get_stat(stat.conn.cache_write_lookaside), 0)
+
+        # The reader still sees the original values, the updater the newest.
+        for i in range(self.nentries):
+            self.assertEqual(c2['%06d' % i], self.value(i, 0))
+            self.assertEqual(c['%06d' % i], self.value(i, self.nupdates))
+        c2.close()
+        session2.commit_transaction()
+        session2.close()
+        c.close()
+
+        # Once the reader is done, a checkpoint and re-open see the newest
+        # values.
+        self.session.checkpoint()
+        self.reopen_conn()
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            self.assertEqual(c['%06d' % i], self.value(i, self.nupdates))
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn16.py
+#   Transactions: group transactions commit or roll back independent units
+#   and commit the surviving units together
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_txn16(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn16'
+    conn_config = 'log=(enabled),statistics=(fast)'
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def check(self, expected):
+        c = self.session.open_cursor(self.uri, None)
+        actual = dict((k, v) for k, v in c)
+        c.close()
+        self.assertEqual(actual, expected)
+
+    # Unit configuration is an error outside a group transaction.
+    def test_group_config(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        self.session.begin_transaction()
+        msg = '/No group transaction is active/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.commit_transaction('unit=true'), msg)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.rollback_transaction('unit=true'), msg)
+        self.session.rollback_transaction()
+
+    # A group transaction can't commit while a unit is unfinished: the
+    # application decides whether the unit commits or rolls back.
+    def test_group_unfinished(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        c = self.session.open_cursor(self.uri, None)
+        for commit_unit in (True, False):
+            self.session.begin_transaction('group=true')
+            c['unit1'] = 'value1'
+            self.session.commit_transaction('unit=true')
+            c['unit2'] = 'value2'
+            self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+                lambda: self.session.commit_transaction(),
+                '/group transaction has an unfinished unit/')
+
+            # The unit is committed or rolled back, then the group commits.
+            if commit_unit:
+                self.session.commit_transaction('unit=true')
+            else:
+                self.session.rollback_transaction('unit=true')
+            self.session.commit_transaction()
+            if commit_unit:
+                self.check({ 'unit1' : 'value1', 'unit2' : 'value2' })
+                c.set_key('unit2')
+                self.assertEqual(c.remove(), 0)
+            else:
+                self.check({ 'unit1' : 'value1' })
+        c.close()
+
+    def test_group(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+
+        # A concurrent transaction updates a key the group will conflict on.
+        session2 = self.conn.open_session()
+        c2 = session2.open_cursor(self.uri, None)
+        session2.begin_transaction()
+        c2['conflict'] = 'session2'
+
+        c = self.session.open_cursor(self.uri, None)
+        self.session.begin_transaction('group=true,isolation=snapshot')
+        c['unit1'] = 'value1'
+        self.session.commit_transaction('unit=true')
+
+        # The failed unit can't be committed, it has to be rolled back.
+        c['unit2'] = 'value2'
+        c.set_key('conflict')
+        c.set_value('value2')
+        self.assertRaises(wiredtiger.WiredTigerError, lambda: c.update())
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.commit_transaction('unit=true'))
+        self.session.rollback_transaction('unit=true')
+
+        # Later units see the changes made by earlier units.
+        self.assertEqual(c['unit1'], 'value1')
+        c['unit3'] = 'value3'
+        self.session.commit_transaction('unit=true')
+
+        # Nothing is visible to other transactions until the group commits.
+        c2.set_key('unit1')
+        self.assertEqual(c2.search(), wiredtiger.WT_NOTFOUND)
+        session2.rollback_transaction()
+        self.session.commit_transaction()
+        session2.close()
+        c.close()
+
+        self.assertEqual(
+            self.get_stat(stat.conn.txn_group_unit_commit), 2)
+        self.assertEqual(
+            self.get_stat(stat.conn.txn_group_unit_rollback), 1)
+
+        expected = { 'unit1' : 'value1', 'unit3' : 'value3' }
+        self.check(expected)
+
+        # Recovery replays the group's single commit record.
+        self.reopen_conn()
+        self.check(expected)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn17.py
+#   Transactions: read-committed operations reuse the previous snapshot
+#   until a transaction commits
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_txn17(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn17'
+    conn_config = 'statistics=(fast)'
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def search(self, c, key):
+        c.set_key(key)
+        self.assertEqual(c.search(), 0)
+        value = c.get_value()
+        c.reset()
+        return value
+
+    def test_snapshot_reuse(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        c = self.session.open_cursor(self.uri, None)
+        c['key'] = 'value1'
+
+        # Without commits, read-committed operations reuse the snapshot.
+        reuse = self.get_stat(stat.conn.txn_snapshot_reuse)
+        for i in range(100):
+            self.assertEqual(self.search(c, 'key'), 'value1')
+        self.assertGreaterEqual(
+            self.get_stat(stat.conn.txn_snapshot_reuse), reuse + 100)
+
+        # An uncommitted update isn't visible, a committed update is.
+        session2 = self.conn.open_session()
+        c2 = session2.open_cursor(self.uri, None)
+        session2.begin_transaction()
+        c2['key'] = 'value2'
+        self.assertEqual(self.search(c, 'key'), 'value1')
+        rebuild = self.get_stat(stat.conn.txn_snapshot_rebuild)
+        session2.commit_transaction()
+        self.assertEqual(self.search(c, 'key'), 'value2')
+        self.assertGreater(
+            self.get_stat(stat.conn.txn_snapshot_rebuild), rebuild)
+
+        # A rolled back update is never visible.
+        session2.begin_transaction()
+        c2['key'] = 'value3'
+        self.assertEqual(self.search(c, 'key'), 'value2')
+        session2.rollback_transaction()
+        for i in range(10):
+            self.assertEqual(self.search(c, 'key'), 'value2')
+        session2.close()
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn18.py
+#   Transactions: adaptive group commit delay
+#
+
+import os, shutil, threading
+from wiredtiger import stat
+import wiredtiger, wttest
+
+class test_txn18(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn18'
+    nthreads = 4
+    nentries = 500
+
+    # Overrides WiredTigerTestCase, add extra config params
+    def setUpConnectionOpen(self, dir):
+        self.conn_config = 'log=(enabled),statistics=(fast),' + \
+            'transaction_sync=(enabled,method=fsync,group_commit_delay=1000)'
+        return wttest.WiredTigerTestCase.setUpConnectionOpen(self, dir)
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            if os.path.isfile(fullname):
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def commit_thread(self, id):
+        session = self.conn.open_session()
+        c = session.open_cursor(self.uri, None, None)
+        for i in range(self.nentries):
+            session.begin_transaction()
+            c[id * self.nentries + i] = id
+            session.commit_transaction()
+        c.close()
+        session.close()
+
+    def test_group_commit(self):
+        ''' Check durable commits from concurrent threads. '''
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        threads = [threading.Thread(target=self.commit_thread, args=(i,))
+            for i in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        # Every durable commit is counted in the latency histogram, and
+        # no commit waited longer than the configured maximum.
+        commits = self.get_stat(stat.conn.log_sync_commit_lt1) + \
+            self.get_stat(stat.conn.log_sync_commit_lt10) + \
+            self.get_stat(stat.conn.log_sync_commit_lt100) + \
+            self.get_stat(stat.conn.log_sync_commit_gt100)
+        self.assertGreaterEqual(commits, self.nthreads * self.nentries)
+        self.assertLessEqual(
+            self.get_stat(stat.conn.log_group_commit_delay_time),
+            self.get_stat(stat.conn.log_group_commit_delays) * 1000)
+
+        # Every commit is durable.
+        self.simulate_crash_restart(".", "RESTART")
+        c = self.session.open_cursor(self.uri, None, None)
+        count = 0
+        for key, value in c:
+            self.assertEqual(value, key / self.nentries)
+            count += 1
+        self.assertEqual(count, self.nthreads * self.nentries)
+        c.close()
+
+    def test_group_commit_config(self):
+        ''' Check the group commit delay is bounded. '''
+        os.mkdir('BADCONFIG')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('BADCONFIG',
+            'create,transaction_sync=(group_commit_delay=1000000)'),
+            '/Value too large/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn19.py
+#   Transactions: snapshots see running writers in any word of the bitmap
+#   of writers
+#
+
+import wiredtiger, wttest
+
+class test_txn19(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn19'
+    conn_config = 'session_max=200'
+    nsessions = 150
+
+    # Session IDs are allocated from the lowest free slot: the writers are
+    # opened after more than 64 and 128 other sessions.
+    writers = (70, 100, 140)
+
+    def check(self, session, expected):
+        c = session.open_cursor(self.uri, None)
+        actual = dict((k, v) for k, v in c)
+        c.close()
+        self.assertEqual(actual, expected)
+
+    def test_writers_bitmap(self):
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        sessions = [self.conn.open_session() for i in range(self.nsessions)]
+
+        # Leave uncommitted updates in sessions with high IDs.
+        for i in self.writers:
+            sessions[i].begin_transaction()
+            c = sessions[i].open_cursor(self.uri, None)
+            c[i] = i
+            c.close()
+
+        # A snapshot reader on a low session ID doesn't see the updates.
+        self.session.begin_transaction('isolation=snapshot')
+        self.check(self.session, {})
+
+        # Commit one of the writers: the reader's snapshot doesn't change,
+        # a new snapshot sees the committed update, but not the others.
+        sessions[self.writers[1]].commit_transaction()
+        self.check(self.session, {})
+        self.session.commit_transaction()
+        self.session.begin_transaction('isolation=snapshot')
+        self.check(self.session, { self.writers[1] : self.writers[1] })
+        self.session.commit_transaction()
+
+        # Once every writer commits, a new snapshot sees all the updates.
+        for i in self.writers:
+            if i != self.writers[1]:
+                sessions[i].commit_transaction()
+        self.session.begin_transaction('isolation=snapshot')
+        self.check(self.session, dict((i, i) for i in self.writers))
+        self.session.commit_transaction()
+
+        for s in sessions:
+            s.close()
+
+if __name__ == '__main__':
+    wttest.run()
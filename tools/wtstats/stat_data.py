@@ -3,6 +3,7 @@
 no_scale_per_second_list = [
     'async: maximum work queue length',
     'cache: bytes currently in the cache',
+    'cache: bytes in bloom filters loaded into memory',
     'cache: maximum bytes configured',
     'cache: maximum page size at eviction',
     'cache: pages currently held in the cache',
@@ -22,9 +23,15 @@ no_scale_per_second_list = [
     'transaction: transaction checkpoint currently running',
     'transaction: transaction checkpoint max time (msecs)',
     'transaction: transaction checkpoint min time (msecs)',
+    'transaction: transaction checkpoint most recent file max time (msecs)',
+    'transaction: transaction checkpoint most recent file total time (msecs)',
     'transaction: transaction checkpoint most recent time (msecs)',
     'transaction: transaction checkpoint total time (msecs)',
+    'transaction: transaction checkpoint write rate (bytes per second)',
     'transaction: transaction range of IDs currently pinned',
+    'transaction: transaction range of IDs currently pinned by named snapshots',
+    'transaction: update chain maximum length after the last pruning',
+    'transaction: update chain maximum length before the last pruning',
     'block-manager: checkpoint size',
     'block-manager: file allocation unit size',
     'block-manager: file magic number',
@@ -48,14 +55,21 @@ no_scale_per_second_list = [
     'btree: row-store leaf pages',
     'cache: overflow values cached in memory',
     'LSM: bloom filters in the LSM tree',
+    'LSM: bytes flushed and merged as a percentage of bytes flushed (write amplification)',
+    'LSM: chunk size as a percentage of the deepest level (space amplification)',
+    'LSM: chunks a query may search (read amplification)',
+    'LSM: chunks expected to be waiting to be flushed or merged',
     'LSM: chunks in the LSM tree',
     'LSM: highest merge generation in the LSM tree',
+    'LSM: longest time a tree maintenance operation waited in a queue (usecs)',
+    'LSM: LSM write throttle delay per update (nsecs)',
     'LSM: total size of bloom filters',
     'reconciliation: maximum blocks required for a page',
     'session: open cursor count',
 ]
 no_clear_list = [
     'cache: bytes currently in the cache',
+    'cache: bytes in bloom filters loaded into memory',
     'cache: maximum bytes configured',
     'cache: pages currently held in the cache',
     'cache: percentage overhead',
@@ -72,9 +86,18 @@ no_clear_list = [
     'transaction: transaction checkpoint currently running',
     'transaction: transaction checkpoint max time (msecs)',
     'transaction: transaction checkpoint min time (msecs)',
+    'transaction: transaction checkpoint most recent file max time (msecs)',
+    'transaction: transaction checkpoint most recent file total time (msecs)',
     'transaction: transaction checkpoint most recent time (msecs)',
     'transaction: transaction checkpoint total time (msecs)',
+    'transaction: transaction checkpoint write rate (bytes per second)',
     'transaction: transaction range of IDs currently pinned',
+    'transaction: transaction range of IDs currently pinned by named snapshots',
+    'LSM: bytes flushed and merged as a percentage of bytes flushed (write amplification)',
+    'LSM: chunk size as a percentage of the deepest level (space amplification)',
+    'LSM: chunks a query may search (read amplification)',
+    'LSM: chunks expected to be waiting to be flushed or merged',
+    'LSM: LSM write throttle delay per update (nsecs)',
     'session: open cursor count',
 ]
 prefix_list = [